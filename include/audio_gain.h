@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Регулятор громкости audio_task без зависимостей от Arduino/IDF (собирается и
+// на хосте, test/native). Громкость в Q15: 32768 = 1.0 (100%), коэффициент
+// считается один раз при старте звука.
+
+constexpr uint16_t AUDIO_GAIN_UNITY_Q15 = 32768U;
+constexpr int32_t AUDIO_GAIN_ROUND_Q15 = 1 << 14;
+
+constexpr uint16_t volumePercentToGainQ15(uint8_t volumePercent) {
+    return (volumePercent >= 100U)
+               ? AUDIO_GAIN_UNITY_Q15
+               : static_cast<uint16_t>((static_cast<uint32_t>(volumePercent) * AUDIO_GAIN_UNITY_Q15 + 50U) / 100U);
+}
+
+static inline int16_t scaleSampleQ15(int16_t sample, int32_t gainQ15) {
+    return static_cast<int16_t>((static_cast<int32_t>(sample) * gainQ15 + AUDIO_GAIN_ROUND_Q15) >> 15);
+}
+
+// Умножение на Q15 и сдвиг вместо деления на 100 на каждый отсчёт. Усиление
+// строго меньше 1.0 (100% пропускается), поэтому результат не выходит за int16
+// и насыщение не требуется.
+void applyGainToInterleavedBuffer(int16_t* samples, size_t sampleCount, uint16_t gainQ15);
+
+// Прежний вариант с делением - эталон для audio bench и тестов: расхождение
+// с Q15 не больше 1 LSB (Q15 округляет, деление отбрасывает дробь)
+void applyVolumePercentReference(int16_t* samples, size_t sampleCount, uint8_t volumePercent);
@@ -43,3 +43,6 @@ bool audioIsPlaying();
 AudioTestSource audioGetLastTestSource();
 const char* audioTestSourceName(AudioTestSource source);
 const char* audioStartStatusName(AudioStartStatus status);
+void audioRunGainBenchmark();
+void audioPrintPipelineStats();
+void audioResetPipelineStats();
@@ -22,6 +22,7 @@
 #define AUDIO_I2S_BCLK_PIN 48   // I2S BCLK
 #define AUDIO_I2S_LRCLK_PIN 47  // I2S WS/LRCLK
 #define AUDIO_I2S_DOUT_PIN 38    // I2S DOUT (data to DAC)
+#define AUDIO_DMA_BUFFER_COUNT 6 // Глубина кольца DMA, буферов по 256 кадров (16 мс при 16 кГц)
 
 // microSD (SPI mode)
 #define SD_SPI_SCK_PIN 18
@@ -83,7 +84,7 @@ struct TimeConfig {
     bool automatic_localtime;         // true = ezTime (online), false = локальная таблица (offline)
     
     // === ВЫЧИСЛЯЕМЫЕ ЗНАЧЕНИЯ (автоматически обновляются) ===
-    int8_t current_offset;            // Текущее смещение UTC в часах (напр. +3, +4)
+    int8_t current_offset;            // Текущее смещение UTC в целых часах; с минутами - TimeSnapshot::offsetSec
     bool current_dst_active;          // Текущий статус DST (true/false)
     
     // === РУЧНАЯ НАСТРОЙКА TIMEZONE (для option 100) ===
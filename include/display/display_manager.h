@@ -43,6 +43,9 @@ class DisplayManager {
 public:
     void begin();
     void setBrightness(uint8_t level);
+    // Автояркость: датчик света -> PWM на OE (config.brightness_control_enabled, пороги min/max)
+    void serviceBrightness(uint32_t nowMs);
+    uint8_t brightnessLevel() const;
     void showTime(uint8_t hours, uint8_t minutes, uint8_t seconds, bool showColon);
     void showUniformDigits(uint8_t digit);
     void testPattern();
@@ -52,10 +55,16 @@ public:
                              uint8_t alarm1Hour, uint8_t alarm1Minute,
                              uint8_t alarm2Hour, uint8_t alarm2Minute);
 
+    // Замер SQW -> LATCH: вызывается перед updateFromLocalTime() секундного тика
+    // (sqwEdgeUs = 0, если тик не от SQW).
+    void markSecondTick(uint32_t sqwEdgeUs, uint32_t tickStartUs);
+
     // Фоновое обслуживание неблокирующих анимаций отображения (soft-transition).
     void serviceAnimations(uint32_t nowMs);
     void stopAnimations();
     bool hasActiveAnimation() const;
+    // Период обслуживания анимации для display-task (0 = анимации нет, можно спать дольше)
+    uint32_t animationServiceIntervalMs(uint32_t nowMs) const;
 
     // Возможности активного backend'а
     bool isNixieClockType() const;
@@ -89,6 +98,10 @@ public:
 
     // Единая диагностика выводимого кадра
     DisplayDebugInfo getDebugInfo() const;
+    // Прогон "disp bench" (только Nixie6): ticks секундных тиков от localStart на реальной шине,
+    // каждый 10-й — со сменой экрана; по трассе защёлок печатает кадры/тик, цену CPU
+    // и декодированную последовательность разрядов. Вызывать из loop (тики в это время не идут).
+    bool runLatchBench(time_t localStart, uint16_t ticks);
 
     // Слой событий для кнопок/энкодера
     bool handleAction(DisplayAction action);
@@ -125,6 +138,9 @@ private:
 
     bool sleepOverrideUntilSchedule_ = false;
 
+    uint8_t brightnessLevel_ = 255;
+    uint32_t nextBrightnessUpdateMs_ = 0;
+
     struct AntiPoisonRuntimeState {
         bool active = false;
         uint8_t pass = 0;
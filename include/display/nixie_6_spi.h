@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include <atomic>
 #include <time.h>
 #include "display/display_manager.h"
 
@@ -63,7 +64,7 @@ public:
     // Конфигурация
     void setMainModeTimeoutMs(uint32_t timeoutMs);
 
-    // Диагностика
+    // Диагностика (читают опубликованный снимок, без блокировок)
     Nixie6View currentView() const;
     Nixie6Frame currentFrame() const;
     uint32_t packedFrame() const;
@@ -72,19 +73,37 @@ public:
     // Вывод кадра в 74HC595
     void pushFrame();
 
-    // Неблокирующая анимация перехода времени (старый кадр -> новый кадр)
+    // Неблокирующая анимация перехода времени (старый кадр -> новый кадр).
+    // serviceTransition() никогда не ждёт писателя: если шина занята, слот пропускается.
     void serviceTransition(uint32_t nowMs);
     void cancelTransition();
     bool isTransitionActive() const;
+    // Через сколько мс нужен следующий serviceTransition() (0 = обслуживание не требуется).
+    // В DMA-режиме слоты выдаёт железо, и задача просыпается только к концу перехода.
+    uint32_t transitionServiceIntervalMs(uint32_t nowMs) const;
 
 private:
     enum class MainMode : uint8_t { Time = 0, Date, Alarm1, Alarm2 };
+
+    // Состояние, которое писатель публикует для читателей (disp_refresh/диагностика).
+    struct PublishedState {
+        Nixie6View view = Nixie6View::DefaultTime;
+        Nixie6Frame frame{};
+        uint32_t frameOutput = 0;
+        uint32_t transitionId = 0;
+        bool transitionActive = false;
+        uint32_t transitionStartMs = 0;
+        uint16_t transitionDurationMs = 0;
+        uint32_t transitionTarget = 0;
+        uint8_t fromWire[4] = {0, 0, 0, 0};
+        uint8_t toWire[4] = {0, 0, 0, 0};
+    };
     enum class AuxMode : uint8_t { Pressure = 0, Humidity, Temperature };
 
     uint8_t latchPin_;
     uint8_t sckPin_;
     uint8_t mosiPin_;
-    uint8_t brightness_ = 128;
+    uint8_t brightness_ = 255;
 
     bool editPlaceholder_ = false;
     bool secondaryBranchActive_ = false;
@@ -123,17 +142,106 @@ private:
                                       bool showMsSeparator = true) const;
 
     void maybeStartTimeTransition(const tm& previousTm, const tm& newTm, uint32_t nowMs);
-    Nixie6Frame frameForOutputNow(uint32_t nowMs) const;
+
+    // Вызываются под мьютексом писателя
+    Nixie6View viewLocked() const;
+    Nixie6Frame buildCurrentFrame() const;
+    void pushFrameLocked();
+    void publishState();
+    void retireCompletedTransition();
+
+    PublishedState readPublishedState() const;
+    bool isPendingTransition(const PublishedState& s) const;
 
     void writeBit(bool value);
     void shiftOut32(uint32_t value);
+    void shiftOutWire(const uint8_t* tx);  // 4 байта уже в формате шины
 
     bool softTransitionEnabled_ = true;
     bool transitionActive_ = false;
     uint32_t transitionStartMs_ = 0;
     uint16_t transitionDurationMs_ = 150;
-    Nixie6Frame transitionFrom_{};
     Nixie6Frame transitionTo_{};
+    uint8_t transitionFromWire_[4] = {0, 0, 0, 0};
+    uint8_t transitionToWire_[4] = {0, 0, 0, 0};
+    uint32_t transitionId_ = 0;
+    // id перехода, финальный кадр которого уже выведен (сервисом или DMA)
+    std::atomic<uint32_t> completedTransitionId_{0};
+
+    // Двойной буфер снимка: чётный счётчик = слот (seq/2)&1 готов
+    PublishedState published_[2];
+    std::atomic<uint32_t> publishSeq_{0};
+
+    // Слоты перехода без DMA: esp_timer с частотой слотов (вызываются под шиной)
+    static void slotTimerThunk(void* arg);
+    void onSlotTimer();
+    void outputTransitionSlot(const PublishedState& s);
+
+    // DMA-движок перехода (кольцо транзакций на HSPI, дозаполняется по мере отработки)
+    bool startDmaTransition(const PublishedState& s, uint32_t nowMs);
+    bool queueDmaTransaction(uint8_t frameIdx, uint16_t lengthBytes);
+    void fillDmaRing(uint32_t nowMs);
+    void drainDmaTransactions();
+
+    std::atomic<bool> dmaSequenceQueued_{false};
+    uint16_t dmaInFlight_ = 0;
+    uint32_t dmaQueuedTarget_ = 0;
+    uint32_t dmaQueuedTransitionId_ = 0;
+    std::atomic<uint32_t> dmaWakeAtMs_{0};  // дозаполнение кольца или конец последовательности
+    std::atomic<bool> dmaPushPending_{false};
+    uint32_t dmaPendingValue_ = 0;
+};
+
+// Учёт трафика шины индикации (команда "disp stat").
+struct Nixie6BusStats {
+    uint32_t pushes = 0;         // запросы вывода кадра в регистр
+    uint32_t skippedPushes = 0;  // из них пропущены: кадр совпал с уже защёлкнутым
+    uint32_t latches = 0;        // импульсы LATCH (включая транзакции DMA)
+    uint32_t dmaSequences = 0;   // последовательности перехода, отданные DMA
+    uint32_t dmaUnderruns = 0;   // кольцо DMA опустело раньше дозаполнения
+    uint64_t busBytes = 0;       // байт на шине (с заполнителями DMA)
+    uint64_t busTimeUs = 0;      // расчётное время занятости шины
+    uint32_t sinceMs = 0;        // millis() последнего сброса счётчиков
+};
+
+// Счётчики синхронизации драйвера (для меню информации).
+struct Nixie6LockStats {
+    uint32_t writerLocks = 0;      // захваты мьютекса писателя
+    uint32_t writerContended = 0;  // из них пришлось ждать
+    uint32_t busContended = 0;     // писатель ждал шину SPI/DMA
+    uint32_t serviceBusSkips = 0;  // слоты, пропущенные сервисом из-за занятой шины
+    uint32_t snapshotRetries = 0;  // повторные чтения снимка
+};
+
+// Задержка "фронт SQW -> LATCH нового кадра" (команда "disp lat", меню информации).
+// Корзины гистограммы SQW->LATCH, верхние границы в мс: 1, 2, 5, 10, 20, 50, 100, 200, дальше — последняя.
+constexpr uint8_t NIXIE6_LATENCY_BUCKETS = 9;
+
+struct Nixie6LatencyStage {
+    uint32_t samples = 0;
+    uint32_t minUs = 0;
+    uint32_t maxUs = 0;
+    uint64_t totalUs = 0;
+};
+
+struct Nixie6LatencyStats {
+    Nixie6LatencyStage sqwToTick;    // ISR -> начало processSecondTick()
+    Nixie6LatencyStage tickToLatch;  // начало processSecondTick() -> первый LATCH нового кадра
+    Nixie6LatencyStage sqwToLatch;   // полный путь (только тики от SQW)
+    uint32_t histogram[NIXIE6_LATENCY_BUCKETS] = {};
+    uint32_t ticksWithoutLatch = 0;  // кадр за секунду не сменился (другой экран, гашение)
+    uint32_t dmaEstimated = 0;       // момент защёлки DMA рассчитан по длине транзакции
+    uint32_t sinceMs = 0;
+};
+
+// Трасса защёлкнутых кадров для "disp bench": пишется только между Start и Stop.
+constexpr uint16_t NIXIE6_LATCH_TRACE_CAPACITY = 768;
+
+struct Nixie6LatchRecord {
+    uint32_t atUs = 0;     // esp_timer: вывод кадра (для DMA — постановка транзакции в очередь)
+    uint16_t cpuUs = 0;    // время CPU на вывод/постановку кадра
+    bool dma = false;      // кадр из кольца DMA (защёлкнется позже, в конце транзакции)
+    uint8_t wire[4] = {0, 0, 0, 0};
 };
 
 // Глобальные runtime-настройки soft-transition для Nixie6.
@@ -141,3 +249,21 @@ void nixie6SetSoftTransitionEnabled(bool enabled);
 bool nixie6IsSoftTransitionEnabled();
 void nixie6SetTransitionDurationMs(uint16_t durationMs);
 uint16_t nixie6GetTransitionDurationMs();
+// Кривая смешивания g(p) = p^gamma (1.0..3.0) и удержание нового кадра после перехода (0..100 мс).
+void nixie6SetTransitionGamma(float gamma);
+float nixie6GetTransitionGamma();
+void nixie6SetTransitionHoldMs(uint16_t holdMs);
+uint16_t nixie6GetTransitionHoldMs();
+Nixie6LockStats nixie6GetLockStats();
+Nixie6BusStats nixie6GetBusStats();
+void nixie6ResetBusStats();
+// sqwEdgeUs = micros() фронта SQW (0 — тик не от SQW), tickStartUs = micros() начала тика.
+void nixie6MarkSecondTick(uint32_t sqwEdgeUs, uint32_t tickStartUs);
+Nixie6LatencyStats nixie6GetLatencyStats();
+void nixie6ResetLatencyStats();
+bool nixie6StartLatchTrace();
+void nixie6StopLatchTrace();
+// Копирует накопленные записи (не больше maxRecords) и очищает трассу; dropped = не влезло в буфер.
+uint16_t nixie6TakeLatchTrace(Nixie6LatchRecord* out, uint16_t maxRecords, uint16_t* dropped);
+// Байты шины -> 6 разрядов в логическом порядке ("HHMMSS", blank-коды = '-') с учётом режима вывода.
+void nixie6DecodeWire(const uint8_t* wire, char* digits, uint8_t* flags);
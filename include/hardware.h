@@ -110,8 +110,11 @@ extern hw_timer_t *timer;
 extern portMUX_TYPE timerMux;
 extern bool ds3231_available;
 extern volatile bool timeUpdatedFromSQW;
+extern volatile uint32_t sqwEdgeMicros;  // micros() последнего фронта SQW (замер задержки индикации)
 
 void setupInterrupts();
+// Задача, которую ISR SQW будит через vTaskNotifyGiveFromISR (nullptr — только флаг timeUpdatedFromSQW)
+void setSqwTickTaskHandle(TaskHandle_t task);
 void blinkError(int count);
 void initHardware();
 void IRAM_ATTR onTimeInterrupt();
@@ -121,6 +124,8 @@ time_t getRTCTime();
 void updateDayOfWeekInRTC();
 float getDS3231Temperature();
 void printDS3231Temperature();
+bool ds3231ReadAgingOffset(int8_t& aging);     // регистр 0x10, 1 LSB ≈ 0.1 ppm
+bool ds3231WriteAgingOffset(int8_t aging);
 float getESP32Temperature();
 void printESP32Temperature();
 
@@ -129,4 +134,12 @@ uint16_t readLightSensorFiltered(uint8_t samples, uint8_t adcResolutionBits);
 
 // Управление OE линии 74HC595 (true = включить выходы, false = погасить индикаторы)
 void setDisplayOutputEnabled(bool enabled);
-bool isDisplayOutputEnabled();
\ No newline at end of file
+bool isDisplayOutputEnabled();
+
+// Аппаратный PWM яркости на OE (LEDC, 20 кГц): 0 = минимум, 255 = 100%
+void setDisplayPwmLevel(uint8_t level);
+uint8_t getDisplayPwmLevel();
+bool isDisplayOePwmActive();
+// Ожидание, после которого LATCH через leadUs мкс попадёт в окно гашения OE (кадр без
+// разрыва). Фаза PWM известна по сбросу таймера LEDC, ждём не дольше периода PWM.
+void waitDisplayBlankWindow(uint32_t leadUs = 0);
\ No newline at end of file
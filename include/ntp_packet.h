@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Пакет NTP (RFC 5905) и арифметика обмена четырьмя метками для time_utils.
+// Без сокетов и Arduino: собирается и на хосте (test/native).
+
+constexpr size_t NTP_PACKET_SIZE = 48;
+constexpr uint32_t NTP_UNIX_EPOCH_DELTA = 2208988800UL;  // 1900-01-01 -> 1970-01-01
+
+// Метка-идентификатор запроса: кладётся в transmit timestamp, сервер возвращает
+// её в originate - так отсекаются запоздавшие ответы на предыдущие запросы.
+struct NtpCookie {
+    uint32_t sec = 0;
+    uint32_t frac = 0;
+};
+
+enum class NtpReplyStatus : uint8_t {
+    Ok = 0,
+    Foreign,     // originate не совпал с меткой запроса
+    Rejected,    // mode/LI/stratum: сервер не синхронизирован или не сервер
+    BadTiming    // метки сервера противоречат друг другу или задержка выше предела
+};
+
+struct NtpExchange {
+    int64_t utcUs = 0;     // UTC в момент приёма t4: T3 + половина задержки
+    int64_t delayUs = 0;   // круговая задержка без времени обработки на сервере
+    uint8_t stratum = 0;
+    uint8_t leap = 0;
+    uint8_t mode = 0;
+};
+
+// Запрос клиента: LI = 0, VN = 4, Mode = 3
+void ntpBuildRequest(uint8_t* packet, const NtpCookie& cookie);
+
+// 64-битная метка NTP (секунды с 1900 + дробь 2^-32) -> мкс Unix. Секунды < 2^31
+// считаются эрой 1 (после февраля 2036).
+int64_t ntpTimestampToUnixUs(const uint8_t* p);
+
+// t1Us/t4Us - локальные моменты отправки запроса и приёма ответа (одна шкала,
+// например esp_timer). Поля out заполнены и при Rejected (для диагностики).
+NtpReplyStatus ntpParseReply(const uint8_t* reply, const NtpCookie& cookie,
+                             int64_t t1Us, int64_t t4Us, int64_t maxDelayUs, NtpExchange& out);
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Подстройка хода DS3231 по истории NTP: между синхронизациями DS3231 идёт сам,
+// ошибка на момент следующей синхронизации даёт уход в ppm, который переносится
+// в регистр Aging Offset. По остаточному уходу выбирается интервал синхронизации.
+struct RtcDisciplineStatus {
+    bool baselineValid = false;  // DS3231 выставлен по NTP и с тех пор не трогался
+    uint32_t baselineUtc = 0;
+    int8_t agingOffset = 0;
+    bool agingKnown = false;
+    int32_t lastDriftPpb = 0;    // уход за последний интервал (>0 — DS3231 спешил)
+    int64_t lastErrorUs = 0;     // накопленная ошибка на момент последней синхронизации
+    uint16_t samples = 0;        // измерений ухода
+    uint32_t syncIntervalSec = 0;
+};
+
+void rtcDisciplineInit();
+
+// До переустановки DS3231 по NTP: rtcErrorUs = DS3231 - NTP (мкс).
+// measurable = false, если фаза секунды DS3231 неизвестна (нет SQW).
+void rtcDisciplineOnNtpSample(time_t ntpUtc, int64_t rtcErrorUs, bool measurable);
+
+// DS3231 выставлен: по NTP — новая база отсчёта, вручную — база теряется.
+void rtcDisciplineOnRtcSet(time_t utc, bool fromNtp);
+
+// Пора ли синхронизироваться в плановое окно 03:05/15:05 (интервал не короче 12 ч)
+bool rtcDisciplineSyncDue(time_t nowUtc);
+
+RtcDisciplineStatus rtcDisciplineGetStatus();
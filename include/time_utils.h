@@ -21,9 +21,83 @@ time_t getCurrentUTCTime();
 // 2. Единые операции с временем
 time_t getCurrentUTCTime();                    // Основная: всегда возвращает UTC
 void checkTimeSource();                        // Проверка и инициализация источников времени
+
+// Здоровье источника времени: getCurrentUTCTime() отдаёт UTC от опоры (без I2C),
+// DS3231 проверяется по расписанию из loop(), фронт SQW подтягивает фазу опоры.
+struct TimeSourceHealth {
+    uint32_t probes = 0;        // плановые проверки источника
+    uint32_t rtcReads = 0;      // чтения времени DS3231 по I2C
+    uint32_t i2cErrors = 0;     // невалидные ответы DS3231
+    uint32_t corrections = 0;   // исправления опоры по DS3231
+    bool anchorValid = false;
+    bool anchorSqwAligned = false;
+};
+void serviceTimeSourceHealth(uint32_t nowMs);  // из loop(): раз в 10 с (1 с без DS3231)
+void timeSourceOnSqwEdge(uint32_t sqwEdgeUs);  // micros() фронта SQW, из секундного тика
+TimeSourceHealth getTimeSourceHealth();
+
+// UTC в микросекундах: секунда DS3231 + время от последнего фронта SQW по esp_timer
+// (с поправкой на измеренный уход), без DS3231 — системные часы ESP32.
+enum class UtcClockSource : uint8_t {
+    SystemClock = 0,  // внутренний RTC ESP32
+    Ds3231Read,       // опора по чтению регистра: фаза секунды неизвестна
+    Ds3231Sqw         // опора по фронту SQW
+};
+struct UtcClockStatus {
+    int64_t utcUs = 0;
+    UtcClockSource source = UtcClockSource::SystemClock;
+    uint32_t uncertaintyUs = 0;  // оценка погрешности относительно шкалы источника
+    int32_t driftPpb = 0;        // уход esp_timer относительно DS3231 (>0 — спешит)
+    bool driftSettled = false;
+    uint32_t anchorAgeMs = 0;    // сколько прошло от опорной точки
+};
+int64_t getCurrentUTCTimeUs();
+UtcClockStatus getUtcClockStatus();
+
+// Снимок "сейчас" для всех потребителей: публикуется секундным тиком, читается без I2C
+// и без повторного расчёта часового пояса. subSecondUs — фаза внутри секунды на момент чтения.
+struct TimeSnapshot {
+    time_t utc = 0;
+    time_t local = 0;
+    tm localTm = {};
+    int32_t offsetSec = 0;       // local - utc
+    bool dst = false;
+    UtcClockSource source = UtcClockSource::SystemClock;
+    uint32_t subSecondUs = 0;
+};
+TimeSnapshot getTimeSnapshot();
+TimeSnapshot publishTimeSnapshot(time_t utc);  // из секундного тика
+void invalidateTimeSnapshot();   // после смены времени/часового пояса
 void setTimeToAllSources(time_t utcTime);      // Установка во все источники
+void setTimeToAllSourcesUs(int64_t utcUs, int64_t atEspUs); // utcUs на момент esp_timer atEspUs
+bool getLastRtcWritePhase(int32_t& phaseErrorUs);  // фаза спада SQW после записи DS3231 (>0 — позже UTC)
 void setDefaultTimeToAllSources();             // Сброс к 9:00 6.07.1990 UTC
 
+// Итог последней успешной NTP-синхронизации (лучший из нескольких обменов с сервером)
+struct NtpSyncReport {
+    bool valid = false;
+    uint8_t serverIndex = 0;     // 1..3 — ntp_server_N
+    uint8_t stratum = 0;
+    uint8_t samples = 0;         // принятых ответов
+    uint8_t serversAnswered = 0; // серверов, ответивших хотя бы раз
+    int32_t delayUs = 0;         // круговая задержка лучшего ответа
+    int64_t offsetUs = 0;        // поправка, внесённая в часы
+    int32_t jitterUs = 0;        // разброс смещений между ответами
+    time_t syncedUtc = 0;
+};
+NtpSyncReport getLastNtpReport();
+
+// Табло NTP-серверов (cfg_nvs): по нему выбирается приоритетный сервер
+struct NtpServerScore {
+    uint32_t hostHash = 0;       // хэш имени: при смене сервера история сбрасывается
+    uint16_t successes = 0;
+    uint16_t failures = 0;
+    uint16_t wins = 0;           // сколько раз ответ сервера был применён
+    uint8_t lastStratum = 0;
+    uint32_t avgDelayUs = 0;     // EMA круговой задержки
+};
+void printNtpScoreboard();
+
 // 3. Функции для печати времени
 bool printTime();                              // Обновленная: UTC + локальное
 void printTimeFromTimeT(time_t utcTime);       // Печать из time_t
@@ -29,6 +29,7 @@ bool initTimezone();
 
 // Конвертация времени
 time_t utcToLocal(time_t utc);          // UTC → локальное время
+time_t utcToLocal(time_t utc, bool &isDst);  // То же + признак летнего времени
 time_t localToUtc(time_t local);        // Локальное → UTC
 
 // Установка часового пояса
@@ -40,6 +41,11 @@ const TimezonePreset* findPresetByLocation(const char* location);
 const TimezonePreset* getPresetByIndex(uint8_t index);
 uint8_t getPresetsCount();
 
+// Список выбора: пресеты, затем зоны только из tzdb (include/tzdb.h)
+uint8_t getSelectableZonesCount();
+const char* getSelectableZoneName(uint8_t index);
+const char* getZoneDisplayName(const char* location);  // nullptr - зона неизвестна
+
 // Вычисление DST
 bool calculateDSTStatus(time_t utc, const TimezonePreset* preset);
 time_t calculateDSTTransition(int year, uint8_t month, uint8_t week, uint8_t dow, uint8_t hour, int8_t offset);
@@ -48,6 +54,11 @@ time_t calculateDSTTransition(int year, uint8_t month, uint8_t week, uint8_t dow
 void printTimezoneInfo();
 void listAvailableTimezones();
 void compareDSTRules();  // Сравнение правил ezTime с локальной таблицей
+void runTimezoneBenchmark();  // нс на конвертацию UTC → локальное (с кэшем и без)
+// Проверка localToUtc(utcToLocal(t)) за годы; stepSec = 0 - шаг по умолчанию (1 мин, all - 15 мин).
+// true - расхождений нет.
+bool runTimezoneRoundTripCheck(bool allZones, int years, time_t stepSec = 0);
+bool runTimezoneFuzz(uint32_t samples, uint32_t seed);     // Случайные моменты 1970-2100 по всем зонам (true - без ошибок)
 
 // Сравнение переходов DST (ezTime vs таблица) по годам
 bool compareDSTRulesWithEzTime(const TimezonePreset* preset, int startYear, int yearsToCheck, bool printDetails);
@@ -55,5 +66,12 @@ bool compareDSTRulesWithEzTime(const TimezonePreset* preset, int startYear, int
 // Офлайн правила (POSIX)
 bool savePosixOverride(const char* tz_name);
 bool clearPosixOverrideIfZone(const char* tz_name);
-bool getEzTimeData(time_t utc, int8_t &offset_hours, bool &dst_active);
+bool getEzTimeData(time_t utc, int32_t &offset_min, bool &dst_active);  // Смещение в минутах, восток +
+
+// Офлайн-правила зоны (tzdb, иначе таблица) без ezTime и сохранённого POSIX -
+// с ними сверяется ezTime после синхронизации. false - зона неизвестна.
+bool getOfflineZoneState(time_t utc, int32_t &offset_min, bool &dst_active);
+bool compareOfflineRulesWithEzTime(int startYear, int yearsToCheck, bool printDetails);
+
+void formatUtcOffset(char* buf, size_t size, int32_t offsetMin);  // "UTC+5:30" / "UTC-3"
 void setupManualOffset();  // Ручная настройка смещения
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+#include <limits>
+
+// Компактная база часовых поясов (подмножество IANA tzdb), генерируется
+// scripts/gen_tzdb.py в include/tzdb_data.h. Таблицы константные - лежат во flash
+// и читаются через кэш/MMU напрямую, без копирования в RAM. Смещения в минутах.
+
+// Вид даты перехода (как в POSIX TZ)
+enum TzRuleDateKind : uint8_t {
+    TZ_RULE_MONTH_WEEK_DAY = 0,  // Mm.w.d: неделя 1-4, 5 = последняя
+    TZ_RULE_JULIAN_NOLEAP,       // Jn: 1..365, 29 февраля не считается
+    TZ_RULE_ZERO_BASED           // n: 0..365 с учётом 29 февраля
+};
+
+struct TzdbTransition {
+    int32_t utc;                 // Момент перехода (UTC)
+    int16_t offsetMin;           // Смещение после перехода, восток положителен
+    uint8_t dst;
+    uint8_t reserved;
+};
+
+struct TzdbRuleDate {
+    uint8_t kind;                // TzRuleDateKind
+    uint8_t month;
+    uint8_t week;
+    uint8_t dow;
+    uint16_t yday;
+    int16_t timeMin;             // Местное время перехода в минутах
+};
+
+struct TzdbZone {
+    const char* name;            // "Europe/Warsaw"
+    const char* displayName;     // "Варшава (CET/CEST)"
+    uint16_t firstTransition;    // Индекс в общей таблице переходов
+    uint16_t transitionCount;    // Исторические переходы с 1970 г.
+    int16_t initialOffsetMin;    // Смещение на 1970-01-01
+    uint8_t initialDst;
+    uint8_t hasDst;              // Текущее правило с переходом на летнее время
+    int16_t stdOffsetMin;
+    int16_t dstOffsetMin;
+    TzdbRuleDate start;          // Начало летнего (по стандартному смещению)
+    TzdbRuleDate end;            // Конец летнего (по летнему смещению)
+};
+
+// Открытые границы участков и интервалов: весь диапазон time_t (с 64-битным
+// time_t интервалы после 2038 г. тоже конечны и кэшируются)
+constexpr time_t TZ_TIME_MIN = std::numeric_limits<time_t>::min();
+constexpr time_t TZ_TIME_MAX = std::numeric_limits<time_t>::max();
+
+// Участок постоянного смещения [from, until)
+struct TzdbSpan {
+    time_t from;
+    time_t until;
+    int32_t offsetSec;
+    bool dst;
+};
+
+// Бинарный поиск по имени; nullptr - зоны нет в базе
+const TzdbZone* tzdbFindZone(const char* name);
+uint16_t tzdbZoneCount();
+const TzdbZone* tzdbZoneAt(uint16_t index);
+const char* tzdbVersion();
+
+// true - utc раньше последнего явного перехода, span из исторической таблицы.
+// false - дальше действует правило зоны; span = состояние после последнего
+// явного перехода (from = его момент), которое держится до первого перехода правила.
+bool tzdbExplicitSpan(const TzdbZone* zone, time_t utc, TzdbSpan& span);
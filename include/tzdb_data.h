@@ -0,0 +1,2295 @@
+#pragma once
+
+// СГЕНЕРИРОВАНО scripts/gen_tzdb.py - не редактировать вручную.
+// Источник: IANA tzdb 2025b (TZif), зон: 53.
+
+#include "tzdb.h"
+
+static const char TZDB_VERSION[] = "2025b";
+
+static const TzdbTransition TZDB_TRANSITIONS[] = {
+    // America/Anchorage
+    {9979200, -540, 1, 0},
+    {25700400, -600, 0, 0},
+    {41428800, -540, 1, 0},
+    {57754800, -600, 0, 0},
+    {73483200, -540, 1, 0},
+    {89204400, -600, 0, 0},
+    {104932800, -540, 1, 0},
+    {120654000, -600, 0, 0},
+    {126705600, -540, 1, 0},
+    {152103600, -600, 0, 0},
+    {162388800, -540, 1, 0},
+    {183553200, -600, 0, 0},
+    {199281600, -540, 1, 0},
+    {215607600, -600, 0, 0},
+    {230731200, -540, 1, 0},
+    {247057200, -600, 0, 0},
+    {262785600, -540, 1, 0},
+    {278506800, -600, 0, 0},
+    {294235200, -540, 1, 0},
+    {309956400, -600, 0, 0},
+    {325684800, -540, 1, 0},
+    {341406000, -600, 0, 0},
+    {357134400, -540, 1, 0},
+    {372855600, -600, 0, 0},
+    {388584000, -540, 1, 0},
+    {404910000, -600, 0, 0},
+    {420033600, -540, 1, 0},
+    {436359600, -540, 0, 0},
+    {439030800, -540, 0, 0},
+    {452084400, -480, 1, 0},
+    {467805600, -540, 0, 0},
+    {483534000, -480, 1, 0},
+    {499255200, -540, 0, 0},
+    {514983600, -480, 1, 0},
+    {530704800, -540, 0, 0},
+    {544618800, -480, 1, 0},
+    {562154400, -540, 0, 0},
+    {576068400, -480, 1, 0},
+    {594208800, -540, 0, 0},
+    {607518000, -480, 1, 0},
+    {625658400, -540, 0, 0},
+    {638967600, -480, 1, 0},
+    {657108000, -540, 0, 0},
+    {671022000, -480, 1, 0},
+    {688557600, -540, 0, 0},
+    {702471600, -480, 1, 0},
+    {720007200, -540, 0, 0},
+    {733921200, -480, 1, 0},
+    {752061600, -540, 0, 0},
+    {765370800, -480, 1, 0},
+    {783511200, -540, 0, 0},
+    {796820400, -480, 1, 0},
+    {814960800, -540, 0, 0},
+    {828874800, -480, 1, 0},
+    {846410400, -540, 0, 0},
+    {860324400, -480, 1, 0},
+    {877860000, -540, 0, 0},
+    {891774000, -480, 1, 0},
+    {909309600, -540, 0, 0},
+    {923223600, -480, 1, 0},
+    {941364000, -540, 0, 0},
+    {954673200, -480, 1, 0},
+    {972813600, -540, 0, 0},
+    {986122800, -480, 1, 0},
+    {1004263200, -540, 0, 0},
+    {1018177200, -480, 1, 0},
+    {1035712800, -540, 0, 0},
+    {1049626800, -480, 1, 0},
+    {1067162400, -540, 0, 0},
+    {1081076400, -480, 1, 0},
+    {1099216800, -540, 0, 0},
+    {1112526000, -480, 1, 0},
+    {1130666400, -540, 0, 0},
+    {1143975600, -480, 1, 0},
+    {1162116000, -540, 0, 0},
+    {1173610800, -480, 1, 0},
+    // America/Chicago
+    {9964800, -300, 1, 0},
+    {25686000, -360, 0, 0},
+    {41414400, -300, 1, 0},
+    {57740400, -360, 0, 0},
+    {73468800, -300, 1, 0},
+    {89190000, -360, 0, 0},
+    {104918400, -300, 1, 0},
+    {120639600, -360, 0, 0},
+    {126691200, -300, 1, 0},
+    {152089200, -360, 0, 0},
+    {162374400, -300, 1, 0},
+    {183538800, -360, 0, 0},
+    {199267200, -300, 1, 0},
+    {215593200, -360, 0, 0},
+    {230716800, -300, 1, 0},
+    {247042800, -360, 0, 0},
+    {262771200, -300, 1, 0},
+    {278492400, -360, 0, 0},
+    {294220800, -300, 1, 0},
+    {309942000, -360, 0, 0},
+    {325670400, -300, 1, 0},
+    {341391600, -360, 0, 0},
+    {357120000, -300, 1, 0},
+    {372841200, -360, 0, 0},
+    {388569600, -300, 1, 0},
+    {404895600, -360, 0, 0},
+    {420019200, -300, 1, 0},
+    {436345200, -360, 0, 0},
+    {452073600, -300, 1, 0},
+    {467794800, -360, 0, 0},
+    {483523200, -300, 1, 0},
+    {499244400, -360, 0, 0},
+    {514972800, -300, 1, 0},
+    {530694000, -360, 0, 0},
+    {544608000, -300, 1, 0},
+    {562143600, -360, 0, 0},
+    {576057600, -300, 1, 0},
+    {594198000, -360, 0, 0},
+    {607507200, -300, 1, 0},
+    {625647600, -360, 0, 0},
+    {638956800, -300, 1, 0},
+    {657097200, -360, 0, 0},
+    {671011200, -300, 1, 0},
+    {688546800, -360, 0, 0},
+    {702460800, -300, 1, 0},
+    {719996400, -360, 0, 0},
+    {733910400, -300, 1, 0},
+    {752050800, -360, 0, 0},
+    {765360000, -300, 1, 0},
+    {783500400, -360, 0, 0},
+    {796809600, -300, 1, 0},
+    {814950000, -360, 0, 0},
+    {828864000, -300, 1, 0},
+    {846399600, -360, 0, 0},
+    {860313600, -300, 1, 0},
+    {877849200, -360, 0, 0},
+    {891763200, -300, 1, 0},
+    {909298800, -360, 0, 0},
+    {923212800, -300, 1, 0},
+    {941353200, -360, 0, 0},
+    {954662400, -300, 1, 0},
+    {972802800, -360, 0, 0},
+    {986112000, -300, 1, 0},
+    {1004252400, -360, 0, 0},
+    {1018166400, -300, 1, 0},
+    {1035702000, -360, 0, 0},
+    {1049616000, -300, 1, 0},
+    {1067151600, -360, 0, 0},
+    {1081065600, -300, 1, 0},
+    {1099206000, -360, 0, 0},
+    {1112515200, -300, 1, 0},
+    {1130655600, -360, 0, 0},
+    {1143964800, -300, 1, 0},
+    {1162105200, -360, 0, 0},
+    {1173600000, -300, 1, 0},
+    // America/Denver
+    {9968400, -360, 1, 0},
+    {25689600, -420, 0, 0},
+    {41418000, -360, 1, 0},
+    {57744000, -420, 0, 0},
+    {73472400, -360, 1, 0},
+    {89193600, -420, 0, 0},
+    {104922000, -360, 1, 0},
+    {120643200, -420, 0, 0},
+    {126694800, -360, 1, 0},
+    {152092800, -420, 0, 0},
+    {162378000, -360, 1, 0},
+    {183542400, -420, 0, 0},
+    {199270800, -360, 1, 0},
+    {215596800, -420, 0, 0},
+    {230720400, -360, 1, 0},
+    {247046400, -420, 0, 0},
+    {262774800, -360, 1, 0},
+    {278496000, -420, 0, 0},
+    {294224400, -360, 1, 0},
+    {309945600, -420, 0, 0},
+    {325674000, -360, 1, 0},
+    {341395200, -420, 0, 0},
+    {357123600, -360, 1, 0},
+    {372844800, -420, 0, 0},
+    {388573200, -360, 1, 0},
+    {404899200, -420, 0, 0},
+    {420022800, -360, 1, 0},
+    {436348800, -420, 0, 0},
+    {452077200, -360, 1, 0},
+    {467798400, -420, 0, 0},
+    {483526800, -360, 1, 0},
+    {499248000, -420, 0, 0},
+    {514976400, -360, 1, 0},
+    {530697600, -420, 0, 0},
+    {544611600, -360, 1, 0},
+    {562147200, -420, 0, 0},
+    {576061200, -360, 1, 0},
+    {594201600, -420, 0, 0},
+    {607510800, -360, 1, 0},
+    {625651200, -420, 0, 0},
+    {638960400, -360, 1, 0},
+    {657100800, -420, 0, 0},
+    {671014800, -360, 1, 0},
+    {688550400, -420, 0, 0},
+    {702464400, -360, 1, 0},
+    {720000000, -420, 0, 0},
+    {733914000, -360, 1, 0},
+    {752054400, -420, 0, 0},
+    {765363600, -360, 1, 0},
+    {783504000, -420, 0, 0},
+    {796813200, -360, 1, 0},
+    {814953600, -420, 0, 0},
+    {828867600, -360, 1, 0},
+    {846403200, -420, 0, 0},
+    {860317200, -360, 1, 0},
+    {877852800, -420, 0, 0},
+    {891766800, -360, 1, 0},
+    {909302400, -420, 0, 0},
+    {923216400, -360, 1, 0},
+    {941356800, -420, 0, 0},
+    {954666000, -360, 1, 0},
+    {972806400, -420, 0, 0},
+    {986115600, -360, 1, 0},
+    {1004256000, -420, 0, 0},
+    {1018170000, -360, 1, 0},
+    {1035705600, -420, 0, 0},
+    {1049619600, -360, 1, 0},
+    {1067155200, -420, 0, 0},
+    {1081069200, -360, 1, 0},
+    {1099209600, -420, 0, 0},
+    {1112518800, -360, 1, 0},
+    {1130659200, -420, 0, 0},
+    {1143968400, -360, 1, 0},
+    {1162108800, -420, 0, 0},
+    {1173603600, -360, 1, 0},
+    // America/Los_Angeles
+    {9972000, -420, 1, 0},
+    {25693200, -480, 0, 0},
+    {41421600, -420, 1, 0},
+    {57747600, -480, 0, 0},
+    {73476000, -420, 1, 0},
+    {89197200, -480, 0, 0},
+    {104925600, -420, 1, 0},
+    {120646800, -480, 0, 0},
+    {126698400, -420, 1, 0},
+    {152096400, -480, 0, 0},
+    {162381600, -420, 1, 0},
+    {183546000, -480, 0, 0},
+    {199274400, -420, 1, 0},
+    {215600400, -480, 0, 0},
+    {230724000, -420, 1, 0},
+    {247050000, -480, 0, 0},
+    {262778400, -420, 1, 0},
+    {278499600, -480, 0, 0},
+    {294228000, -420, 1, 0},
+    {309949200, -480, 0, 0},
+    {325677600, -420, 1, 0},
+    {341398800, -480, 0, 0},
+    {357127200, -420, 1, 0},
+    {372848400, -480, 0, 0},
+    {388576800, -420, 1, 0},
+    {404902800, -480, 0, 0},
+    {420026400, -420, 1, 0},
+    {436352400, -480, 0, 0},
+    {452080800, -420, 1, 0},
+    {467802000, -480, 0, 0},
+    {483530400, -420, 1, 0},
+    {499251600, -480, 0, 0},
+    {514980000, -420, 1, 0},
+    {530701200, -480, 0, 0},
+    {544615200, -420, 1, 0},
+    {562150800, -480, 0, 0},
+    {576064800, -420, 1, 0},
+    {594205200, -480, 0, 0},
+    {607514400, -420, 1, 0},
+    {625654800, -480, 0, 0},
+    {638964000, -420, 1, 0},
+    {657104400, -480, 0, 0},
+    {671018400, -420, 1, 0},
+    {688554000, -480, 0, 0},
+    {702468000, -420, 1, 0},
+    {720003600, -480, 0, 0},
+    {733917600, -420, 1, 0},
+    {752058000, -480, 0, 0},
+    {765367200, -420, 1, 0},
+    {783507600, -480, 0, 0},
+    {796816800, -420, 1, 0},
+    {814957200, -480, 0, 0},
+    {828871200, -420, 1, 0},
+    {846406800, -480, 0, 0},
+    {860320800, -420, 1, 0},
+    {877856400, -480, 0, 0},
+    {891770400, -420, 1, 0},
+    {909306000, -480, 0, 0},
+    {923220000, -420, 1, 0},
+    {941360400, -480, 0, 0},
+    {954669600, -420, 1, 0},
+    {972810000, -480, 0, 0},
+    {986119200, -420, 1, 0},
+    {1004259600, -480, 0, 0},
+    {1018173600, -420, 1, 0},
+    {1035709200, -480, 0, 0},
+    {1049623200, -420, 1, 0},
+    {1067158800, -480, 0, 0},
+    {1081072800, -420, 1, 0},
+    {1099213200, -480, 0, 0},
+    {1112522400, -420, 1, 0},
+    {1130662800, -480, 0, 0},
+    {1143972000, -420, 1, 0},
+    {1162112400, -480, 0, 0},
+    {1173607200, -420, 1, 0},
+    // America/New_York
+    {9961200, -240, 1, 0},
+    {25682400, -300, 0, 0},
+    {41410800, -240, 1, 0},
+    {57736800, -300, 0, 0},
+    {73465200, -240, 1, 0},
+    {89186400, -300, 0, 0},
+    {104914800, -240, 1, 0},
+    {120636000, -300, 0, 0},
+    {126687600, -240, 1, 0},
+    {152085600, -300, 0, 0},
+    {162370800, -240, 1, 0},
+    {183535200, -300, 0, 0},
+    {199263600, -240, 1, 0},
+    {215589600, -300, 0, 0},
+    {230713200, -240, 1, 0},
+    {247039200, -300, 0, 0},
+    {262767600, -240, 1, 0},
+    {278488800, -300, 0, 0},
+    {294217200, -240, 1, 0},
+    {309938400, -300, 0, 0},
+    {325666800, -240, 1, 0},
+    {341388000, -300, 0, 0},
+    {357116400, -240, 1, 0},
+    {372837600, -300, 0, 0},
+    {388566000, -240, 1, 0},
+    {404892000, -300, 0, 0},
+    {420015600, -240, 1, 0},
+    {436341600, -300, 0, 0},
+    {452070000, -240, 1, 0},
+    {467791200, -300, 0, 0},
+    {483519600, -240, 1, 0},
+    {499240800, -300, 0, 0},
+    {514969200, -240, 1, 0},
+    {530690400, -300, 0, 0},
+    {544604400, -240, 1, 0},
+    {562140000, -300, 0, 0},
+    {576054000, -240, 1, 0},
+    {594194400, -300, 0, 0},
+    {607503600, -240, 1, 0},
+    {625644000, -300, 0, 0},
+    {638953200, -240, 1, 0},
+    {657093600, -300, 0, 0},
+    {671007600, -240, 1, 0},
+    {688543200, -300, 0, 0},
+    {702457200, -240, 1, 0},
+    {719992800, -300, 0, 0},
+    {733906800, -240, 1, 0},
+    {752047200, -300, 0, 0},
+    {765356400, -240, 1, 0},
+    {783496800, -300, 0, 0},
+    {796806000, -240, 1, 0},
+    {814946400, -300, 0, 0},
+    {828860400, -240, 1, 0},
+    {846396000, -300, 0, 0},
+    {860310000, -240, 1, 0},
+    {877845600, -300, 0, 0},
+    {891759600, -240, 1, 0},
+    {909295200, -300, 0, 0},
+    {923209200, -240, 1, 0},
+    {941349600, -300, 0, 0},
+    {954658800, -240, 1, 0},
+    {972799200, -300, 0, 0},
+    {986108400, -240, 1, 0},
+    {1004248800, -300, 0, 0},
+    {1018162800, -240, 1, 0},
+    {1035698400, -300, 0, 0},
+    {1049612400, -240, 1, 0},
+    {1067148000, -300, 0, 0},
+    {1081062000, -240, 1, 0},
+    {1099202400, -300, 0, 0},
+    {1112511600, -240, 1, 0},
+    {1130652000, -300, 0, 0},
+    {1143961200, -240, 1, 0},
+    {1162101600, -300, 0, 0},
+    {1173596400, -240, 1, 0},
+    // America/Sao_Paulo
+    {499748400, -120, 1, 0},
+    {511236000, -180, 0, 0},
+    {530593200, -120, 1, 0},
+    {540266400, -180, 0, 0},
+    {562129200, -120, 1, 0},
+    {571197600, -180, 0, 0},
+    {592974000, -120, 1, 0},
+    {602042400, -180, 0, 0},
+    {624423600, -120, 1, 0},
+    {634701600, -180, 0, 0},
+    {656478000, -120, 1, 0},
+    {666756000, -180, 0, 0},
+    {687927600, -120, 1, 0},
+    {697600800, -180, 0, 0},
+    {719982000, -120, 1, 0},
+    {728445600, -180, 0, 0},
+    {750826800, -120, 1, 0},
+    {761709600, -180, 0, 0},
+    {782276400, -120, 1, 0},
+    {793159200, -180, 0, 0},
+    {813726000, -120, 1, 0},
+    {824004000, -180, 0, 0},
+    {844570800, -120, 1, 0},
+    {856058400, -180, 0, 0},
+    {876106800, -120, 1, 0},
+    {888717600, -180, 0, 0},
+    {908074800, -120, 1, 0},
+    {919562400, -180, 0, 0},
+    {938919600, -120, 1, 0},
+    {951616800, -180, 0, 0},
+    {970974000, -120, 1, 0},
+    {982461600, -180, 0, 0},
+    {1003028400, -120, 1, 0},
+    {1013911200, -180, 0, 0},
+    {1036292400, -120, 1, 0},
+    {1045360800, -180, 0, 0},
+    {1066532400, -120, 1, 0},
+    {1076810400, -180, 0, 0},
+    {1099364400, -120, 1, 0},
+    {1108864800, -180, 0, 0},
+    {1129431600, -120, 1, 0},
+    {1140314400, -180, 0, 0},
+    {1162695600, -120, 1, 0},
+    {1172368800, -180, 0, 0},
+    {1192330800, -120, 1, 0},
+    {1203213600, -180, 0, 0},
+    {1224385200, -120, 1, 0},
+    {1234663200, -180, 0, 0},
+    {1255834800, -120, 1, 0},
+    {1266717600, -180, 0, 0},
+    {1287284400, -120, 1, 0},
+    {1298167200, -180, 0, 0},
+    {1318734000, -120, 1, 0},
+    {1330221600, -180, 0, 0},
+    {1350788400, -120, 1, 0},
+    {1361066400, -180, 0, 0},
+    {1382238000, -120, 1, 0},
+    {1392516000, -180, 0, 0},
+    {1413687600, -120, 1, 0},
+    {1424570400, -180, 0, 0},
+    {1445137200, -120, 1, 0},
+    {1456020000, -180, 0, 0},
+    {1476586800, -120, 1, 0},
+    {1487469600, -180, 0, 0},
+    {1508036400, -120, 1, 0},
+    {1518919200, -180, 0, 0},
+    {1541300400, -120, 1, 0},
+    {1550368800, -180, 0, 0},
+    {2147483647, -180, 0, 0},
+    // America/St_Johns
+    {9955800, -150, 1, 0},
+    {25677000, -210, 0, 0},
+    {41405400, -150, 1, 0},
+    {57731400, -210, 0, 0},
+    {73459800, -150, 1, 0},
+    {89181000, -210, 0, 0},
+    {104909400, -150, 1, 0},
+    {120630600, -210, 0, 0},
+    {136359000, -150, 1, 0},
+    {152080200, -210, 0, 0},
+    {167808600, -150, 1, 0},
+    {183529800, -210, 0, 0},
+    {199258200, -150, 1, 0},
+    {215584200, -210, 0, 0},
+    {230707800, -150, 1, 0},
+    {247033800, -210, 0, 0},
+    {262762200, -150, 1, 0},
+    {278483400, -210, 0, 0},
+    {294211800, -150, 1, 0},
+    {309933000, -210, 0, 0},
+    {325661400, -150, 1, 0},
+    {341382600, -210, 0, 0},
+    {357111000, -150, 1, 0},
+    {372832200, -210, 0, 0},
+    {388560600, -150, 1, 0},
+    {404886600, -210, 0, 0},
+    {420010200, -150, 1, 0},
+    {436336200, -210, 0, 0},
+    {452064600, -150, 1, 0},
+    {467785800, -210, 0, 0},
+    {483514200, -150, 1, 0},
+    {499235400, -210, 0, 0},
+    {514963800, -150, 1, 0},
+    {530685000, -210, 0, 0},
+    {544591860, -150, 1, 0},
+    {562127460, -210, 0, 0},
+    {576041460, -90, 1, 0},
+    {594178260, -210, 0, 0},
+    {607491060, -150, 1, 0},
+    {625631460, -210, 0, 0},
+    {638940660, -150, 1, 0},
+    {657081060, -210, 0, 0},
+    {670995060, -150, 1, 0},
+    {688530660, -210, 0, 0},
+    {702444660, -150, 1, 0},
+    {719980260, -210, 0, 0},
+    {733894260, -150, 1, 0},
+    {752034660, -210, 0, 0},
+    {765343860, -150, 1, 0},
+    {783484260, -210, 0, 0},
+    {796793460, -150, 1, 0},
+    {814933860, -210, 0, 0},
+    {828847860, -150, 1, 0},
+    {846383460, -210, 0, 0},
+    {860297460, -150, 1, 0},
+    {877833060, -210, 0, 0},
+    {891747060, -150, 1, 0},
+    {909282660, -210, 0, 0},
+    {923196660, -150, 1, 0},
+    {941337060, -210, 0, 0},
+    {954646260, -150, 1, 0},
+    {972786660, -210, 0, 0},
+    {986095860, -150, 1, 0},
+    {1004236260, -210, 0, 0},
+    {1018150260, -150, 1, 0},
+    {1035685860, -210, 0, 0},
+    {1049599860, -150, 1, 0},
+    {1067135460, -210, 0, 0},
+    {1081049460, -150, 1, 0},
+    {1099189860, -210, 0, 0},
+    {1112499060, -150, 1, 0},
+    {1130639460, -210, 0, 0},
+    {1143948660, -150, 1, 0},
+    {1162089060, -210, 0, 0},
+    {1173583860, -150, 1, 0},
+    {1194143460, -210, 0, 0},
+    {1205033460, -150, 1, 0},
+    {1225593060, -210, 0, 0},
+    {1236483060, -150, 1, 0},
+    {1257042660, -210, 0, 0},
+    {1268537460, -150, 1, 0},
+    {1289097060, -210, 0, 0},
+    {1299987060, -150, 1, 0},
+    {1320553800, -210, 0, 0},
+    // Asia/Bangkok
+    {2147483647, 420, 0, 0},
+    // Asia/Dubai
+    {2147483647, 240, 0, 0},
+    // Asia/Jerusalem
+    {142380000, 180, 1, 0},
+    {150843600, 120, 0, 0},
+    {167176800, 180, 1, 0},
+    {178664400, 120, 0, 0},
+    {334101600, 180, 1, 0},
+    {337730400, 120, 0, 0},
+    {452642400, 180, 1, 0},
+    {462319200, 120, 0, 0},
+    {482277600, 180, 1, 0},
+    {494370000, 120, 0, 0},
+    {516751200, 180, 1, 0},
+    {526424400, 120, 0, 0},
+    {545436000, 180, 1, 0},
+    {558478800, 120, 0, 0},
+    {576626400, 180, 1, 0},
+    {589323600, 120, 0, 0},
+    {609890400, 180, 1, 0},
+    {620773200, 120, 0, 0},
+    {638316000, 180, 1, 0},
+    {651618000, 120, 0, 0},
+    {669765600, 180, 1, 0},
+    {683672400, 120, 0, 0},
+    {701820000, 180, 1, 0},
+    {715726800, 120, 0, 0},
+    {733701600, 180, 1, 0},
+    {747176400, 120, 0, 0},
+    {765151200, 180, 1, 0},
+    {778021200, 120, 0, 0},
+    {796600800, 180, 1, 0},
+    {810075600, 120, 0, 0},
+    {826840800, 180, 1, 0},
+    {842821200, 120, 0, 0},
+    {858895200, 180, 1, 0},
+    {874184400, 120, 0, 0},
+    {890344800, 180, 1, 0},
+    {905029200, 120, 0, 0},
+    {923011200, 180, 1, 0},
+    {936313200, 120, 0, 0},
+    {955670400, 180, 1, 0},
+    {970783200, 120, 0, 0},
+    {986770800, 180, 1, 0},
+    {1001282400, 120, 0, 0},
+    {1017356400, 180, 1, 0},
+    {1033941600, 120, 0, 0},
+    {1048806000, 180, 1, 0},
+    {1065132000, 120, 0, 0},
+    {1081292400, 180, 1, 0},
+    {1095804000, 120, 0, 0},
+    {1112313600, 180, 1, 0},
+    {1128812400, 120, 0, 0},
+    {1143763200, 180, 1, 0},
+    {1159657200, 120, 0, 0},
+    {1175212800, 180, 1, 0},
+    {1189897200, 120, 0, 0},
+    {1206662400, 180, 1, 0},
+    {1223161200, 120, 0, 0},
+    {1238112000, 180, 1, 0},
+    {1254006000, 120, 0, 0},
+    {1269561600, 180, 1, 0},
+    {1284246000, 120, 0, 0},
+    {1301616000, 180, 1, 0},
+    {1317510000, 120, 0, 0},
+    {1333065600, 180, 1, 0},
+    {1348354800, 120, 0, 0},
+    {1364515200, 180, 1, 0},
+    // Asia/Kabul
+    {2147483647, 270, 0, 0},
+    // Asia/Kathmandu
+    {504901800, 345, 0, 0},
+    {2147483647, 345, 0, 0},
+    // Asia/Seoul
+    {547578000, 600, 1, 0},
+    {560883600, 540, 0, 0},
+    {579027600, 600, 1, 0},
+    {592333200, 540, 0, 0},
+    // Asia/Shanghai
+    {515527200, 540, 1, 0},
+    {527014800, 480, 0, 0},
+    {545162400, 540, 1, 0},
+    {558464400, 480, 0, 0},
+    {577216800, 540, 1, 0},
+    {589914000, 480, 0, 0},
+    {608666400, 540, 1, 0},
+    {621968400, 480, 0, 0},
+    {640116000, 540, 1, 0},
+    {653418000, 480, 0, 0},
+    {671565600, 540, 1, 0},
+    {684867600, 480, 0, 0},
+    // Asia/Singapore
+    {378662400, 480, 0, 0},
+    {2147483647, 480, 0, 0},
+    // Asia/Tehran
+    {227820600, 270, 1, 0},
+    {246223800, 240, 0, 0},
+    {259617600, 300, 1, 0},
+    {271108800, 240, 0, 0},
+    {279576000, 210, 0, 0},
+    {296598600, 270, 1, 0},
+    {306531000, 210, 0, 0},
+    {322432200, 270, 1, 0},
+    {338499000, 210, 0, 0},
+    {673216200, 270, 1, 0},
+    {685481400, 210, 0, 0},
+    {701209800, 270, 1, 0},
+    {717103800, 210, 0, 0},
+    {732745800, 270, 1, 0},
+    {748639800, 210, 0, 0},
+    {764281800, 270, 1, 0},
+    {780175800, 210, 0, 0},
+    {795817800, 270, 1, 0},
+    {811711800, 210, 0, 0},
+    {827353800, 270, 1, 0},
+    {843247800, 210, 0, 0},
+    {858976200, 270, 1, 0},
+    {874870200, 210, 0, 0},
+    {890512200, 270, 1, 0},
+    {906406200, 210, 0, 0},
+    {922048200, 270, 1, 0},
+    {937942200, 210, 0, 0},
+    {953584200, 270, 1, 0},
+    {969478200, 210, 0, 0},
+    {985206600, 270, 1, 0},
+    {1001100600, 210, 0, 0},
+    {1016742600, 270, 1, 0},
+    {1032636600, 210, 0, 0},
+    {1048278600, 270, 1, 0},
+    {1064172600, 210, 0, 0},
+    {1079814600, 270, 1, 0},
+    {1095708600, 210, 0, 0},
+    {1111437000, 270, 1, 0},
+    {1127331000, 210, 0, 0},
+    {1206045000, 270, 1, 0},
+    {1221939000, 210, 0, 0},
+    {1237667400, 270, 1, 0},
+    {1253561400, 210, 0, 0},
+    {1269203400, 270, 1, 0},
+    {1285097400, 210, 0, 0},
+    {1300739400, 270, 1, 0},
+    {1316633400, 210, 0, 0},
+    {1332275400, 270, 1, 0},
+    {1348169400, 210, 0, 0},
+    {1363897800, 270, 1, 0},
+    {1379791800, 210, 0, 0},
+    {1395433800, 270, 1, 0},
+    {1411327800, 210, 0, 0},
+    {1426969800, 270, 1, 0},
+    {1442863800, 210, 0, 0},
+    {1458505800, 270, 1, 0},
+    {1474399800, 210, 0, 0},
+    {1490128200, 270, 1, 0},
+    {1506022200, 210, 0, 0},
+    {1521664200, 270, 1, 0},
+    {1537558200, 210, 0, 0},
+    {1553200200, 270, 1, 0},
+    {1569094200, 210, 0, 0},
+    {1584736200, 270, 1, 0},
+    {1600630200, 210, 0, 0},
+    {1616358600, 270, 1, 0},
+    {1632252600, 210, 0, 0},
+    {1647894600, 270, 1, 0},
+    {1663788600, 210, 0, 0},
+    {2147483647, 210, 0, 0},
+    // Asia/Yangon
+    {2147483647, 390, 0, 0},
+    // Australia/Adelaide
+    {57688200, 630, 1, 0},
+    {67969800, 570, 0, 0},
+    {89137800, 630, 1, 0},
+    {100024200, 570, 0, 0},
+    {120587400, 630, 1, 0},
+    {131473800, 570, 0, 0},
+    {152037000, 630, 1, 0},
+    {162923400, 570, 0, 0},
+    {183486600, 630, 1, 0},
+    {194977800, 570, 0, 0},
+    {215541000, 630, 1, 0},
+    {226427400, 570, 0, 0},
+    {246990600, 630, 1, 0},
+    {257877000, 570, 0, 0},
+    {278440200, 630, 1, 0},
+    {289326600, 570, 0, 0},
+    {309889800, 630, 1, 0},
+    {320776200, 570, 0, 0},
+    {341339400, 630, 1, 0},
+    {352225800, 570, 0, 0},
+    {372789000, 630, 1, 0},
+    {384280200, 570, 0, 0},
+    {404843400, 630, 1, 0},
+    {415729800, 570, 0, 0},
+    {436293000, 630, 1, 0},
+    {447179400, 570, 0, 0},
+    {467742600, 630, 1, 0},
+    {478629000, 570, 0, 0},
+    {499192200, 630, 1, 0},
+    {511288200, 570, 0, 0},
+    {530037000, 630, 1, 0},
+    {542737800, 570, 0, 0},
+    {562091400, 630, 1, 0},
+    {574792200, 570, 0, 0},
+    {594145800, 630, 1, 0},
+    {606241800, 570, 0, 0},
+    {625595400, 630, 1, 0},
+    {637691400, 570, 0, 0},
+    {657045000, 630, 1, 0},
+    {667931400, 570, 0, 0},
+    {688494600, 630, 1, 0},
+    {701195400, 570, 0, 0},
+    {719944200, 630, 1, 0},
+    {731435400, 570, 0, 0},
+    {751998600, 630, 1, 0},
+    {764094600, 570, 0, 0},
+    {783448200, 630, 1, 0},
+    {796149000, 570, 0, 0},
+    {814897800, 630, 1, 0},
+    {828203400, 570, 0, 0},
+    {846347400, 630, 1, 0},
+    {859653000, 570, 0, 0},
+    {877797000, 630, 1, 0},
+    {891102600, 570, 0, 0},
+    {909246600, 630, 1, 0},
+    {922552200, 570, 0, 0},
+    {941301000, 630, 1, 0},
+    {954001800, 570, 0, 0},
+    {972750600, 630, 1, 0},
+    {985451400, 570, 0, 0},
+    {1004200200, 630, 1, 0},
+    {1017505800, 570, 0, 0},
+    {1035649800, 630, 1, 0},
+    {1048955400, 570, 0, 0},
+    {1067099400, 630, 1, 0},
+    {1080405000, 570, 0, 0},
+    {1099153800, 630, 1, 0},
+    {1111854600, 570, 0, 0},
+    {1130603400, 630, 1, 0},
+    {1143909000, 570, 0, 0},
+    {1162053000, 630, 1, 0},
+    {1174753800, 570, 0, 0},
+    {1193502600, 630, 1, 0},
+    // Australia/Perth
+    {152042400, 540, 1, 0},
+    {162928800, 480, 0, 0},
+    {436298400, 540, 1, 0},
+    {447184800, 480, 0, 0},
+    {690314400, 540, 1, 0},
+    {699386400, 480, 0, 0},
+    {1165082400, 540, 1, 0},
+    {1174759200, 480, 0, 0},
+    {1193508000, 540, 1, 0},
+    {1206813600, 480, 0, 0},
+    {1224957600, 540, 1, 0},
+    {1238263200, 480, 0, 0},
+    // Australia/Sydney
+    {57686400, 660, 1, 0},
+    {67968000, 600, 0, 0},
+    {89136000, 660, 1, 0},
+    {100022400, 600, 0, 0},
+    {120585600, 660, 1, 0},
+    {131472000, 600, 0, 0},
+    {152035200, 660, 1, 0},
+    {162921600, 600, 0, 0},
+    {183484800, 660, 1, 0},
+    {194976000, 600, 0, 0},
+    {215539200, 660, 1, 0},
+    {226425600, 600, 0, 0},
+    {246988800, 660, 1, 0},
+    {257875200, 600, 0, 0},
+    {278438400, 660, 1, 0},
+    {289324800, 600, 0, 0},
+    {309888000, 660, 1, 0},
+    {320774400, 600, 0, 0},
+    {341337600, 660, 1, 0},
+    {352224000, 600, 0, 0},
+    {372787200, 660, 1, 0},
+    {386697600, 600, 0, 0},
+    {404841600, 660, 1, 0},
+    {415728000, 600, 0, 0},
+    {436291200, 660, 1, 0},
+    {447177600, 600, 0, 0},
+    {467740800, 660, 1, 0},
+    {478627200, 600, 0, 0},
+    {499190400, 660, 1, 0},
+    {511286400, 600, 0, 0},
+    {530035200, 660, 1, 0},
+    {542736000, 600, 0, 0},
+    {562089600, 660, 1, 0},
+    {574790400, 600, 0, 0},
+    {594144000, 660, 1, 0},
+    {606240000, 600, 0, 0},
+    {625593600, 660, 1, 0},
+    {636480000, 600, 0, 0},
+    {657043200, 660, 1, 0},
+    {667929600, 600, 0, 0},
+    {688492800, 660, 1, 0},
+    {699379200, 600, 0, 0},
+    {719942400, 660, 1, 0},
+    {731433600, 600, 0, 0},
+    {751996800, 660, 1, 0},
+    {762883200, 600, 0, 0},
+    {783446400, 660, 1, 0},
+    {794332800, 600, 0, 0},
+    {814896000, 660, 1, 0},
+    {828201600, 600, 0, 0},
+    {846345600, 660, 1, 0},
+    {859651200, 600, 0, 0},
+    {877795200, 660, 1, 0},
+    {891100800, 600, 0, 0},
+    {909244800, 660, 1, 0},
+    {922550400, 600, 0, 0},
+    {941299200, 660, 1, 0},
+    {954000000, 600, 0, 0},
+    {967305600, 660, 1, 0},
+    {985449600, 600, 0, 0},
+    {1004198400, 660, 1, 0},
+    {1017504000, 600, 0, 0},
+    {1035648000, 660, 1, 0},
+    {1048953600, 600, 0, 0},
+    {1067097600, 660, 1, 0},
+    {1080403200, 600, 0, 0},
+    {1099152000, 660, 1, 0},
+    {1111852800, 600, 0, 0},
+    {1130601600, 660, 1, 0},
+    {1143907200, 600, 0, 0},
+    {1162051200, 660, 1, 0},
+    {1174752000, 600, 0, 0},
+    {1193500800, 660, 1, 0},
+    // CET
+    {228877200, 120, 1, 0},
+    {243997200, 60, 0, 0},
+    {260326800, 120, 1, 0},
+    {276051600, 60, 0, 0},
+    {291776400, 120, 1, 0},
+    {307501200, 60, 0, 0},
+    {323830800, 120, 1, 0},
+    {338950800, 60, 0, 0},
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Amsterdam
+    {228877200, 120, 1, 0},
+    {243997200, 60, 0, 0},
+    {260326800, 120, 1, 0},
+    {276051600, 60, 0, 0},
+    {291776400, 120, 1, 0},
+    {307501200, 60, 0, 0},
+    {323830800, 120, 1, 0},
+    {338950800, 60, 0, 0},
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Athens
+    {166485600, 180, 1, 0},
+    {186184800, 120, 0, 0},
+    {198028800, 180, 1, 0},
+    {213753600, 120, 0, 0},
+    {228873600, 180, 1, 0},
+    {244080000, 120, 0, 0},
+    {260323200, 180, 1, 0},
+    {275446800, 120, 0, 0},
+    {291798000, 180, 1, 0},
+    {307407600, 120, 0, 0},
+    {323388000, 180, 1, 0},
+    {338936400, 120, 0, 0},
+    {354675600, 180, 1, 0},
+    {370400400, 120, 0, 0},
+    {386125200, 180, 1, 0},
+    {401850000, 120, 0, 0},
+    {417574800, 180, 1, 0},
+    {433299600, 120, 0, 0},
+    {449024400, 180, 1, 0},
+    {465354000, 120, 0, 0},
+    {481078800, 180, 1, 0},
+    {496803600, 120, 0, 0},
+    {512528400, 180, 1, 0},
+    {528253200, 120, 0, 0},
+    {543978000, 180, 1, 0},
+    {559702800, 120, 0, 0},
+    {575427600, 180, 1, 0},
+    {591152400, 120, 0, 0},
+    {606877200, 180, 1, 0},
+    {622602000, 120, 0, 0},
+    {638326800, 180, 1, 0},
+    {654656400, 120, 0, 0},
+    {670381200, 180, 1, 0},
+    {686106000, 120, 0, 0},
+    {701830800, 180, 1, 0},
+    {717555600, 120, 0, 0},
+    {733280400, 180, 1, 0},
+    {749005200, 120, 0, 0},
+    {764730000, 180, 1, 0},
+    {780454800, 120, 0, 0},
+    {796179600, 180, 1, 0},
+    {811904400, 120, 0, 0},
+    {828234000, 180, 1, 0},
+    // Europe/Berlin
+    {323830800, 120, 1, 0},
+    {338950800, 60, 0, 0},
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Brussels
+    {228877200, 120, 1, 0},
+    {243997200, 60, 0, 0},
+    {260326800, 120, 1, 0},
+    {276051600, 60, 0, 0},
+    {291776400, 120, 1, 0},
+    {307501200, 60, 0, 0},
+    {323830800, 120, 1, 0},
+    {338950800, 60, 0, 0},
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Bucharest
+    {296604000, 180, 1, 0},
+    {307486800, 120, 0, 0},
+    {323816400, 180, 1, 0},
+    {338940000, 120, 0, 0},
+    {354672000, 180, 1, 0},
+    {370396800, 120, 0, 0},
+    {386121600, 180, 1, 0},
+    {401846400, 120, 0, 0},
+    {417571200, 180, 1, 0},
+    {433296000, 120, 0, 0},
+    {449020800, 180, 1, 0},
+    {465350400, 120, 0, 0},
+    {481075200, 180, 1, 0},
+    {496800000, 120, 0, 0},
+    {512524800, 180, 1, 0},
+    {528249600, 120, 0, 0},
+    {543974400, 180, 1, 0},
+    {559699200, 120, 0, 0},
+    {575424000, 180, 1, 0},
+    {591148800, 120, 0, 0},
+    {606873600, 180, 1, 0},
+    {622598400, 120, 0, 0},
+    {638323200, 180, 1, 0},
+    {654652800, 120, 0, 0},
+    {670370400, 180, 1, 0},
+    {686095200, 120, 0, 0},
+    {701820000, 180, 1, 0},
+    {717544800, 120, 0, 0},
+    {733269600, 180, 1, 0},
+    {748994400, 120, 0, 0},
+    {764719200, 180, 1, 0},
+    {780440400, 120, 0, 0},
+    {796168800, 180, 1, 0},
+    {811890000, 120, 0, 0},
+    {828223200, 180, 1, 0},
+    {846363600, 120, 0, 0},
+    {859683600, 180, 1, 0},
+    // Europe/Copenhagen
+    {323830800, 120, 1, 0},
+    {338950800, 60, 0, 0},
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Dublin
+    {57722400, 0, 1, 0},
+    {69818400, 60, 0, 0},
+    {89172000, 0, 1, 0},
+    {101268000, 60, 0, 0},
+    {120621600, 0, 1, 0},
+    {132717600, 60, 0, 0},
+    {152071200, 0, 1, 0},
+    {164167200, 60, 0, 0},
+    {183520800, 0, 1, 0},
+    {196221600, 60, 0, 0},
+    {214970400, 0, 1, 0},
+    {227671200, 60, 0, 0},
+    {246420000, 0, 1, 0},
+    {259120800, 60, 0, 0},
+    {278474400, 0, 1, 0},
+    {290570400, 60, 0, 0},
+    {309924000, 0, 1, 0},
+    {322020000, 60, 0, 0},
+    {341373600, 0, 1, 0},
+    {354675600, 60, 0, 0},
+    {372819600, 0, 1, 0},
+    {386125200, 60, 0, 0},
+    {404269200, 0, 1, 0},
+    {417574800, 60, 0, 0},
+    {435718800, 0, 1, 0},
+    {449024400, 60, 0, 0},
+    {467773200, 0, 1, 0},
+    {481078800, 60, 0, 0},
+    {499222800, 0, 1, 0},
+    {512528400, 60, 0, 0},
+    {530672400, 0, 1, 0},
+    {543978000, 60, 0, 0},
+    {562122000, 0, 1, 0},
+    {575427600, 60, 0, 0},
+    {593571600, 0, 1, 0},
+    {606877200, 60, 0, 0},
+    {625626000, 0, 1, 0},
+    {638326800, 60, 0, 0},
+    {657075600, 0, 1, 0},
+    {670381200, 60, 0, 0},
+    {688525200, 0, 1, 0},
+    {701830800, 60, 0, 0},
+    {719974800, 0, 1, 0},
+    {733280400, 60, 0, 0},
+    {751424400, 0, 1, 0},
+    {764730000, 60, 0, 0},
+    {782874000, 0, 1, 0},
+    {796179600, 60, 0, 0},
+    {814323600, 0, 1, 0},
+    {828234000, 60, 0, 0},
+    // Europe/Helsinki
+    {354672000, 180, 1, 0},
+    {370396800, 120, 0, 0},
+    {386121600, 180, 1, 0},
+    {401846400, 120, 0, 0},
+    {417574800, 180, 1, 0},
+    {433299600, 120, 0, 0},
+    {449024400, 180, 1, 0},
+    {465354000, 120, 0, 0},
+    {481078800, 180, 1, 0},
+    {496803600, 120, 0, 0},
+    {512528400, 180, 1, 0},
+    {528253200, 120, 0, 0},
+    {543978000, 180, 1, 0},
+    {559702800, 120, 0, 0},
+    {575427600, 180, 1, 0},
+    {591152400, 120, 0, 0},
+    {606877200, 180, 1, 0},
+    {622602000, 120, 0, 0},
+    {638326800, 180, 1, 0},
+    {654656400, 120, 0, 0},
+    {670381200, 180, 1, 0},
+    {686106000, 120, 0, 0},
+    {701830800, 180, 1, 0},
+    {717555600, 120, 0, 0},
+    {733280400, 180, 1, 0},
+    {749005200, 120, 0, 0},
+    {764730000, 180, 1, 0},
+    {780454800, 120, 0, 0},
+    {796179600, 180, 1, 0},
+    {811904400, 120, 0, 0},
+    {828234000, 180, 1, 0},
+    // Europe/Istanbul
+    {107910000, 180, 1, 0},
+    {121215600, 120, 0, 0},
+    {133920000, 180, 1, 0},
+    {152665200, 120, 0, 0},
+    {164678400, 180, 1, 0},
+    {184114800, 120, 0, 0},
+    {196214400, 180, 1, 0},
+    {215564400, 120, 0, 0},
+    {228873600, 180, 1, 0},
+    {245804400, 120, 0, 0},
+    {260323200, 180, 1, 0},
+    {267915600, 180, 0, 0},
+    {428454000, 240, 1, 0},
+    {433893600, 180, 0, 0},
+    {468111600, 120, 0, 0},
+    {482799600, 180, 1, 0},
+    {496710000, 120, 0, 0},
+    {512521200, 180, 1, 0},
+    {528246000, 120, 0, 0},
+    {543970800, 180, 1, 0},
+    {559695600, 120, 0, 0},
+    {575420400, 180, 1, 0},
+    {591145200, 120, 0, 0},
+    {606870000, 180, 1, 0},
+    {622594800, 120, 0, 0},
+    {638319600, 180, 1, 0},
+    {654649200, 120, 0, 0},
+    {670374000, 180, 1, 0},
+    {686098800, 120, 0, 0},
+    {701823600, 180, 1, 0},
+    {717548400, 120, 0, 0},
+    {733273200, 180, 1, 0},
+    {748998000, 120, 0, 0},
+    {764118000, 180, 1, 0},
+    {780447600, 120, 0, 0},
+    {796172400, 180, 1, 0},
+    {811897200, 120, 0, 0},
+    {828226800, 180, 1, 0},
+    {846370800, 120, 0, 0},
+    {859676400, 180, 1, 0},
+    {877820400, 120, 0, 0},
+    {891126000, 180, 1, 0},
+    {909270000, 120, 0, 0},
+    {922575600, 180, 1, 0},
+    {941324400, 120, 0, 0},
+    {954025200, 180, 1, 0},
+    {972774000, 120, 0, 0},
+    {985474800, 180, 1, 0},
+    {1004223600, 120, 0, 0},
+    {1017529200, 180, 1, 0},
+    {1035673200, 120, 0, 0},
+    {1048978800, 180, 1, 0},
+    {1067122800, 120, 0, 0},
+    {1080428400, 180, 1, 0},
+    {1099177200, 120, 0, 0},
+    {1111878000, 180, 1, 0},
+    {1130626800, 120, 0, 0},
+    {1143327600, 180, 1, 0},
+    {1162076400, 120, 0, 0},
+    {1174784400, 180, 1, 0},
+    {1193533200, 120, 0, 0},
+    {1206838800, 180, 1, 0},
+    {1224982800, 120, 0, 0},
+    {1238288400, 180, 1, 0},
+    {1256432400, 120, 0, 0},
+    {1269738000, 180, 1, 0},
+    {1288486800, 120, 0, 0},
+    {1301274000, 180, 1, 0},
+    {1319936400, 120, 0, 0},
+    {1332637200, 180, 1, 0},
+    {1351386000, 120, 0, 0},
+    {1364691600, 180, 1, 0},
+    {1382835600, 120, 0, 0},
+    {1396227600, 180, 1, 0},
+    {1414285200, 120, 0, 0},
+    {1427590800, 180, 1, 0},
+    {1446944400, 120, 0, 0},
+    {1459040400, 180, 1, 0},
+    {1473195600, 180, 0, 0},
+    {2147483647, 180, 0, 0},
+    // Europe/Kiev
+    {354920400, 240, 1, 0},
+    {370728000, 180, 0, 0},
+    {386456400, 240, 1, 0},
+    {402264000, 180, 0, 0},
+    {417992400, 240, 1, 0},
+    {433800000, 180, 0, 0},
+    {449614800, 240, 1, 0},
+    {465346800, 180, 0, 0},
+    {481071600, 240, 1, 0},
+    {496796400, 180, 0, 0},
+    {512521200, 240, 1, 0},
+    {528246000, 180, 0, 0},
+    {543970800, 240, 1, 0},
+    {559695600, 180, 0, 0},
+    {575420400, 240, 1, 0},
+    {591145200, 180, 0, 0},
+    {606870000, 240, 1, 0},
+    {622594800, 180, 0, 0},
+    {638319600, 240, 1, 0},
+    {646783200, 180, 1, 0},
+    {686102400, 120, 0, 0},
+    {701827200, 180, 1, 0},
+    {717552000, 120, 0, 0},
+    {733276800, 180, 1, 0},
+    {749001600, 120, 0, 0},
+    {764726400, 180, 1, 0},
+    {780451200, 120, 0, 0},
+    {796176000, 180, 1, 0},
+    {811900800, 120, 0, 0},
+    {828230400, 180, 1, 0},
+    {846378000, 120, 0, 0},
+    // Europe/Kyiv
+    {354920400, 240, 1, 0},
+    {370728000, 180, 0, 0},
+    {386456400, 240, 1, 0},
+    {402264000, 180, 0, 0},
+    {417992400, 240, 1, 0},
+    {433800000, 180, 0, 0},
+    {449614800, 240, 1, 0},
+    {465346800, 180, 0, 0},
+    {481071600, 240, 1, 0},
+    {496796400, 180, 0, 0},
+    {512521200, 240, 1, 0},
+    {528246000, 180, 0, 0},
+    {543970800, 240, 1, 0},
+    {559695600, 180, 0, 0},
+    {575420400, 240, 1, 0},
+    {591145200, 180, 0, 0},
+    {606870000, 240, 1, 0},
+    {622594800, 180, 0, 0},
+    {638319600, 240, 1, 0},
+    {646783200, 180, 1, 0},
+    {686102400, 120, 0, 0},
+    {701827200, 180, 1, 0},
+    {717552000, 120, 0, 0},
+    {733276800, 180, 1, 0},
+    {749001600, 120, 0, 0},
+    {764726400, 180, 1, 0},
+    {780451200, 120, 0, 0},
+    {796176000, 180, 1, 0},
+    {811900800, 120, 0, 0},
+    {828230400, 180, 1, 0},
+    {846378000, 120, 0, 0},
+    // Europe/Lisbon
+    {212544000, 0, 0, 0},
+    {228268800, 60, 1, 0},
+    {243993600, 0, 0, 0},
+    {260326800, 60, 1, 0},
+    {276051600, 0, 0, 0},
+    {291776400, 60, 1, 0},
+    {307501200, 0, 0, 0},
+    {323830800, 60, 1, 0},
+    {338950800, 0, 0, 0},
+    {354672000, 60, 1, 0},
+    {370396800, 0, 0, 0},
+    {386121600, 60, 1, 0},
+    {401846400, 0, 0, 0},
+    {417571200, 60, 1, 0},
+    {433296000, 0, 0, 0},
+    {449020800, 60, 1, 0},
+    {465350400, 0, 0, 0},
+    {481075200, 60, 1, 0},
+    {496800000, 0, 0, 0},
+    {512528400, 60, 1, 0},
+    {528253200, 0, 0, 0},
+    {543978000, 60, 1, 0},
+    {559702800, 0, 0, 0},
+    {575427600, 60, 1, 0},
+    {591152400, 0, 0, 0},
+    {606877200, 60, 1, 0},
+    {622602000, 0, 0, 0},
+    {638326800, 60, 1, 0},
+    {654656400, 0, 0, 0},
+    {670381200, 60, 1, 0},
+    {686106000, 0, 0, 0},
+    {701830800, 60, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 60, 1, 0},
+    // Europe/London
+    {57722400, 0, 0, 0},
+    {69818400, 60, 1, 0},
+    {89172000, 0, 0, 0},
+    {101268000, 60, 1, 0},
+    {120621600, 0, 0, 0},
+    {132717600, 60, 1, 0},
+    {152071200, 0, 0, 0},
+    {164167200, 60, 1, 0},
+    {183520800, 0, 0, 0},
+    {196221600, 60, 1, 0},
+    {214970400, 0, 0, 0},
+    {227671200, 60, 1, 0},
+    {246420000, 0, 0, 0},
+    {259120800, 60, 1, 0},
+    {278474400, 0, 0, 0},
+    {290570400, 60, 1, 0},
+    {309924000, 0, 0, 0},
+    {322020000, 60, 1, 0},
+    {341373600, 0, 0, 0},
+    {354675600, 60, 1, 0},
+    {372819600, 0, 0, 0},
+    {386125200, 60, 1, 0},
+    {404269200, 0, 0, 0},
+    {417574800, 60, 1, 0},
+    {435718800, 0, 0, 0},
+    {449024400, 60, 1, 0},
+    {467773200, 0, 0, 0},
+    {481078800, 60, 1, 0},
+    {499222800, 0, 0, 0},
+    {512528400, 60, 1, 0},
+    {530672400, 0, 0, 0},
+    {543978000, 60, 1, 0},
+    {562122000, 0, 0, 0},
+    {575427600, 60, 1, 0},
+    {593571600, 0, 0, 0},
+    {606877200, 60, 1, 0},
+    {625626000, 0, 0, 0},
+    {638326800, 60, 1, 0},
+    {657075600, 0, 0, 0},
+    {670381200, 60, 1, 0},
+    {688525200, 0, 0, 0},
+    {701830800, 60, 1, 0},
+    {719974800, 0, 0, 0},
+    {733280400, 60, 1, 0},
+    {751424400, 0, 0, 0},
+    {764730000, 60, 1, 0},
+    {782874000, 0, 0, 0},
+    {796179600, 60, 1, 0},
+    {814323600, 0, 0, 0},
+    {828234000, 60, 1, 0},
+    // Europe/Madrid
+    {135122400, 120, 1, 0},
+    {150246000, 60, 0, 0},
+    {166572000, 120, 1, 0},
+    {181695600, 60, 0, 0},
+    {196812000, 120, 1, 0},
+    {212540400, 60, 0, 0},
+    {228866400, 120, 1, 0},
+    {243990000, 60, 0, 0},
+    {260326800, 120, 1, 0},
+    {276051600, 60, 0, 0},
+    {291776400, 120, 1, 0},
+    {307501200, 60, 0, 0},
+    {323830800, 120, 1, 0},
+    {338950800, 60, 0, 0},
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Moscow
+    {354920400, 240, 1, 0},
+    {370728000, 180, 0, 0},
+    {386456400, 240, 1, 0},
+    {402264000, 180, 0, 0},
+    {417992400, 240, 1, 0},
+    {433800000, 180, 0, 0},
+    {449614800, 240, 1, 0},
+    {465346800, 180, 0, 0},
+    {481071600, 240, 1, 0},
+    {496796400, 180, 0, 0},
+    {512521200, 240, 1, 0},
+    {528246000, 180, 0, 0},
+    {543970800, 240, 1, 0},
+    {559695600, 180, 0, 0},
+    {575420400, 240, 1, 0},
+    {591145200, 180, 0, 0},
+    {606870000, 240, 1, 0},
+    {622594800, 180, 0, 0},
+    {638319600, 240, 1, 0},
+    {654649200, 180, 0, 0},
+    {670374000, 180, 1, 0},
+    {686102400, 120, 0, 0},
+    {695779200, 180, 0, 0},
+    {701823600, 240, 1, 0},
+    {717548400, 180, 0, 0},
+    {733273200, 240, 1, 0},
+    {748998000, 180, 0, 0},
+    {764722800, 240, 1, 0},
+    {780447600, 180, 0, 0},
+    {796172400, 240, 1, 0},
+    {811897200, 180, 0, 0},
+    {828226800, 240, 1, 0},
+    {846370800, 180, 0, 0},
+    {859676400, 240, 1, 0},
+    {877820400, 180, 0, 0},
+    {891126000, 240, 1, 0},
+    {909270000, 180, 0, 0},
+    {922575600, 240, 1, 0},
+    {941324400, 180, 0, 0},
+    {954025200, 240, 1, 0},
+    {972774000, 180, 0, 0},
+    {985474800, 240, 1, 0},
+    {1004223600, 180, 0, 0},
+    {1017529200, 240, 1, 0},
+    {1035673200, 180, 0, 0},
+    {1048978800, 240, 1, 0},
+    {1067122800, 180, 0, 0},
+    {1080428400, 240, 1, 0},
+    {1099177200, 180, 0, 0},
+    {1111878000, 240, 1, 0},
+    {1130626800, 180, 0, 0},
+    {1143327600, 240, 1, 0},
+    {1162076400, 180, 0, 0},
+    {1174777200, 240, 1, 0},
+    {1193526000, 180, 0, 0},
+    {1206831600, 240, 1, 0},
+    {1224975600, 180, 0, 0},
+    {1238281200, 240, 1, 0},
+    {1256425200, 180, 0, 0},
+    {1269730800, 240, 1, 0},
+    {1288479600, 180, 0, 0},
+    {1301180400, 240, 0, 0},
+    {1414274400, 180, 0, 0},
+    // Europe/Oslo
+    {323830800, 120, 1, 0},
+    {338950800, 60, 0, 0},
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Paris
+    {196819200, 120, 1, 0},
+    {212540400, 60, 0, 0},
+    {228877200, 120, 1, 0},
+    {243997200, 60, 0, 0},
+    {260326800, 120, 1, 0},
+    {276051600, 60, 0, 0},
+    {291776400, 120, 1, 0},
+    {307501200, 60, 0, 0},
+    {323830800, 120, 1, 0},
+    {338950800, 60, 0, 0},
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Prague
+    {291776400, 120, 1, 0},
+    {307501200, 60, 0, 0},
+    {323830800, 120, 1, 0},
+    {338950800, 60, 0, 0},
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Riga
+    {354920400, 240, 1, 0},
+    {370728000, 180, 0, 0},
+    {386456400, 240, 1, 0},
+    {402264000, 180, 0, 0},
+    {417992400, 240, 1, 0},
+    {433800000, 180, 0, 0},
+    {449614800, 240, 1, 0},
+    {465346800, 180, 0, 0},
+    {481071600, 240, 1, 0},
+    {496796400, 180, 0, 0},
+    {512521200, 240, 1, 0},
+    {528246000, 180, 0, 0},
+    {543970800, 240, 1, 0},
+    {559695600, 180, 0, 0},
+    {575420400, 240, 1, 0},
+    {591145200, 180, 0, 0},
+    {606870000, 180, 1, 0},
+    {622598400, 120, 0, 0},
+    {638323200, 180, 1, 0},
+    {654652800, 120, 0, 0},
+    {670377600, 180, 1, 0},
+    {686102400, 120, 0, 0},
+    {701827200, 180, 1, 0},
+    {717552000, 120, 0, 0},
+    {733276800, 180, 1, 0},
+    {749001600, 120, 0, 0},
+    {764726400, 180, 1, 0},
+    {780451200, 120, 0, 0},
+    {796176000, 180, 1, 0},
+    {811900800, 120, 0, 0},
+    {828230400, 180, 1, 0},
+    {843955200, 120, 0, 0},
+    {859683600, 180, 1, 0},
+    {877827600, 120, 0, 0},
+    {891133200, 180, 1, 0},
+    {909277200, 120, 0, 0},
+    {922582800, 180, 1, 0},
+    {941331600, 120, 0, 0},
+    {985482000, 180, 1, 0},
+    // Europe/Rome
+    {12956400, 120, 1, 0},
+    {23238000, 60, 0, 0},
+    {43801200, 120, 1, 0},
+    {54687600, 60, 0, 0},
+    {75855600, 120, 1, 0},
+    {86742000, 60, 0, 0},
+    {107910000, 120, 1, 0},
+    {118191600, 60, 0, 0},
+    {138754800, 120, 1, 0},
+    {149641200, 60, 0, 0},
+    {170809200, 120, 1, 0},
+    {181090800, 60, 0, 0},
+    {202258800, 120, 1, 0},
+    {212540400, 60, 0, 0},
+    {233103600, 120, 1, 0},
+    {243990000, 60, 0, 0},
+    {265158000, 120, 1, 0},
+    {276044400, 60, 0, 0},
+    {296607600, 120, 1, 0},
+    {307494000, 60, 0, 0},
+    {323830800, 120, 1, 0},
+    {338950800, 60, 0, 0},
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Sofia
+    {291762000, 180, 1, 0},
+    {307576800, 120, 0, 0},
+    {323816400, 180, 1, 0},
+    {339026400, 120, 0, 0},
+    {355266000, 180, 1, 0},
+    {370393200, 120, 0, 0},
+    {386715600, 180, 1, 0},
+    {401846400, 120, 0, 0},
+    {417571200, 180, 1, 0},
+    {433296000, 120, 0, 0},
+    {449020800, 180, 1, 0},
+    {465350400, 120, 0, 0},
+    {481075200, 180, 1, 0},
+    {496800000, 120, 0, 0},
+    {512524800, 180, 1, 0},
+    {528249600, 120, 0, 0},
+    {543974400, 180, 1, 0},
+    {559699200, 120, 0, 0},
+    {575424000, 180, 1, 0},
+    {591148800, 120, 0, 0},
+    {606873600, 180, 1, 0},
+    {622598400, 120, 0, 0},
+    {638323200, 180, 1, 0},
+    {654652800, 120, 0, 0},
+    {670370400, 180, 1, 0},
+    {686091600, 120, 0, 0},
+    {701820000, 180, 1, 0},
+    {717541200, 120, 0, 0},
+    {733269600, 180, 1, 0},
+    {748990800, 120, 0, 0},
+    {764719200, 180, 1, 0},
+    {780440400, 120, 0, 0},
+    {796168800, 180, 1, 0},
+    {811890000, 120, 0, 0},
+    {828223200, 180, 1, 0},
+    {846363600, 120, 0, 0},
+    {859683600, 180, 1, 0},
+    // Europe/Stockholm
+    {323830800, 120, 1, 0},
+    {338950800, 60, 0, 0},
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Tallinn
+    {354920400, 240, 1, 0},
+    {370728000, 180, 0, 0},
+    {386456400, 240, 1, 0},
+    {402264000, 180, 0, 0},
+    {417992400, 240, 1, 0},
+    {433800000, 180, 0, 0},
+    {449614800, 240, 1, 0},
+    {465346800, 180, 0, 0},
+    {481071600, 240, 1, 0},
+    {496796400, 180, 0, 0},
+    {512521200, 240, 1, 0},
+    {528246000, 180, 0, 0},
+    {543970800, 240, 1, 0},
+    {559695600, 180, 0, 0},
+    {575420400, 240, 1, 0},
+    {591145200, 180, 0, 0},
+    {606870000, 180, 1, 0},
+    {622598400, 120, 0, 0},
+    {638323200, 180, 1, 0},
+    {654652800, 120, 0, 0},
+    {670377600, 180, 1, 0},
+    {686102400, 120, 0, 0},
+    {701827200, 180, 1, 0},
+    {717552000, 120, 0, 0},
+    {733276800, 180, 1, 0},
+    {749001600, 120, 0, 0},
+    {764726400, 180, 1, 0},
+    {780451200, 120, 0, 0},
+    {796176000, 180, 1, 0},
+    {811900800, 120, 0, 0},
+    {828230400, 180, 1, 0},
+    {846374400, 120, 0, 0},
+    {859680000, 180, 1, 0},
+    {877824000, 120, 0, 0},
+    {891129600, 180, 1, 0},
+    {909277200, 120, 0, 0},
+    {922582800, 180, 1, 0},
+    {941331600, 120, 0, 0},
+    {1017536400, 180, 1, 0},
+    // Europe/Vienna
+    {323823600, 120, 1, 0},
+    {338940000, 60, 0, 0},
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Vilnius
+    {354920400, 240, 1, 0},
+    {370728000, 180, 0, 0},
+    {386456400, 240, 1, 0},
+    {402264000, 180, 0, 0},
+    {417992400, 240, 1, 0},
+    {433800000, 180, 0, 0},
+    {449614800, 240, 1, 0},
+    {465346800, 180, 0, 0},
+    {481071600, 240, 1, 0},
+    {496796400, 180, 0, 0},
+    {512521200, 240, 1, 0},
+    {528246000, 180, 0, 0},
+    {543970800, 240, 1, 0},
+    {559695600, 180, 0, 0},
+    {575420400, 240, 1, 0},
+    {591145200, 180, 0, 0},
+    {606870000, 180, 1, 0},
+    {622598400, 120, 0, 0},
+    {638323200, 180, 1, 0},
+    {654652800, 120, 0, 0},
+    {670377600, 180, 1, 0},
+    {686102400, 120, 0, 0},
+    {701827200, 180, 1, 0},
+    {717552000, 120, 0, 0},
+    {733276800, 180, 1, 0},
+    {749001600, 120, 0, 0},
+    {764726400, 180, 1, 0},
+    {780451200, 120, 0, 0},
+    {796176000, 180, 1, 0},
+    {811900800, 120, 0, 0},
+    {828230400, 180, 1, 0},
+    {846374400, 120, 0, 0},
+    {859680000, 180, 1, 0},
+    {877824000, 120, 0, 0},
+    {891133200, 120, 1, 0},
+    {909277200, 60, 0, 0},
+    {922582800, 120, 1, 0},
+    {941331600, 120, 0, 0},
+    {1048986000, 180, 1, 0},
+    // Europe/Warsaw
+    {228873600, 120, 1, 0},
+    {243993600, 60, 0, 0},
+    {260323200, 120, 1, 0},
+    {276048000, 60, 0, 0},
+    {291772800, 120, 1, 0},
+    {307497600, 60, 0, 0},
+    {323827200, 120, 1, 0},
+    {338947200, 60, 0, 0},
+    {354672000, 120, 1, 0},
+    {370396800, 60, 0, 0},
+    {386121600, 120, 1, 0},
+    {401846400, 60, 0, 0},
+    {417571200, 120, 1, 0},
+    {433296000, 60, 0, 0},
+    {449020800, 120, 1, 0},
+    {465350400, 60, 0, 0},
+    {481075200, 120, 1, 0},
+    {496800000, 60, 0, 0},
+    {512524800, 120, 1, 0},
+    {528249600, 60, 0, 0},
+    {543974400, 120, 1, 0},
+    {559699200, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Europe/Zurich
+    {354675600, 120, 1, 0},
+    {370400400, 60, 0, 0},
+    {386125200, 120, 1, 0},
+    {401850000, 60, 0, 0},
+    {417574800, 120, 1, 0},
+    {433299600, 60, 0, 0},
+    {449024400, 120, 1, 0},
+    {465354000, 60, 0, 0},
+    {481078800, 120, 1, 0},
+    {496803600, 60, 0, 0},
+    {512528400, 120, 1, 0},
+    {528253200, 60, 0, 0},
+    {543978000, 120, 1, 0},
+    {559702800, 60, 0, 0},
+    {575427600, 120, 1, 0},
+    {591152400, 60, 0, 0},
+    {606877200, 120, 1, 0},
+    {622602000, 60, 0, 0},
+    {638326800, 120, 1, 0},
+    {654656400, 60, 0, 0},
+    {670381200, 120, 1, 0},
+    {686106000, 60, 0, 0},
+    {701830800, 120, 1, 0},
+    {717555600, 60, 0, 0},
+    {733280400, 120, 1, 0},
+    {749005200, 60, 0, 0},
+    {764730000, 120, 1, 0},
+    {780454800, 60, 0, 0},
+    {796179600, 120, 1, 0},
+    {811904400, 60, 0, 0},
+    {828234000, 120, 1, 0},
+    // Pacific/Auckland
+    {152632800, 780, 1, 0},
+    {162309600, 720, 0, 0},
+    {183477600, 780, 1, 0},
+    {194968800, 720, 0, 0},
+    {215532000, 780, 1, 0},
+    {226418400, 720, 0, 0},
+    {246981600, 780, 1, 0},
+    {257868000, 720, 0, 0},
+    {278431200, 780, 1, 0},
+    {289317600, 720, 0, 0},
+    {309880800, 780, 1, 0},
+    {320767200, 720, 0, 0},
+    {341330400, 780, 1, 0},
+    {352216800, 720, 0, 0},
+    {372780000, 780, 1, 0},
+    {384271200, 720, 0, 0},
+    {404834400, 780, 1, 0},
+    {415720800, 720, 0, 0},
+    {436284000, 780, 1, 0},
+    {447170400, 720, 0, 0},
+    {467733600, 780, 1, 0},
+    {478620000, 720, 0, 0},
+    {499183200, 780, 1, 0},
+    {510069600, 720, 0, 0},
+    {530632800, 780, 1, 0},
+    {541519200, 720, 0, 0},
+    {562082400, 780, 1, 0},
+    {573573600, 720, 0, 0},
+    {594136800, 780, 1, 0},
+    {605023200, 720, 0, 0},
+    {623772000, 780, 1, 0},
+    {637682400, 720, 0, 0},
+    {655221600, 780, 1, 0},
+    {669132000, 720, 0, 0},
+    {686671200, 780, 1, 0},
+    {700581600, 720, 0, 0},
+    {718120800, 780, 1, 0},
+    {732636000, 720, 0, 0},
+    {749570400, 780, 1, 0},
+    {764085600, 720, 0, 0},
+    {781020000, 780, 1, 0},
+    {795535200, 720, 0, 0},
+    {812469600, 780, 1, 0},
+    {826984800, 720, 0, 0},
+    {844524000, 780, 1, 0},
+    {858434400, 720, 0, 0},
+    {875973600, 780, 1, 0},
+    {889884000, 720, 0, 0},
+    {907423200, 780, 1, 0},
+    {921938400, 720, 0, 0},
+    {938872800, 780, 1, 0},
+    {953388000, 720, 0, 0},
+    {970322400, 780, 1, 0},
+    {984837600, 720, 0, 0},
+    {1002376800, 780, 1, 0},
+    {1016287200, 720, 0, 0},
+    {1033826400, 780, 1, 0},
+    {1047736800, 720, 0, 0},
+    {1065276000, 780, 1, 0},
+    {1079791200, 720, 0, 0},
+    {1096725600, 780, 1, 0},
+    {1111240800, 720, 0, 0},
+    {1128175200, 780, 1, 0},
+    {1142690400, 720, 0, 0},
+    {1159624800, 780, 1, 0},
+    {1174140000, 720, 0, 0},
+    {1191074400, 780, 1, 0},
+    // Pacific/Chatham
+    {152632800, 825, 1, 0},
+    {162309600, 765, 0, 0},
+    {183477600, 825, 1, 0},
+    {194968800, 765, 0, 0},
+    {215532000, 825, 1, 0},
+    {226418400, 765, 0, 0},
+    {246981600, 825, 1, 0},
+    {257868000, 765, 0, 0},
+    {278431200, 825, 1, 0},
+    {289317600, 765, 0, 0},
+    {309880800, 825, 1, 0},
+    {320767200, 765, 0, 0},
+    {341330400, 825, 1, 0},
+    {352216800, 765, 0, 0},
+    {372780000, 825, 1, 0},
+    {384271200, 765, 0, 0},
+    {404834400, 825, 1, 0},
+    {415720800, 765, 0, 0},
+    {436284000, 825, 1, 0},
+    {447170400, 765, 0, 0},
+    {467733600, 825, 1, 0},
+    {478620000, 765, 0, 0},
+    {499183200, 825, 1, 0},
+    {510069600, 765, 0, 0},
+    {530632800, 825, 1, 0},
+    {541519200, 765, 0, 0},
+    {562082400, 825, 1, 0},
+    {573573600, 765, 0, 0},
+    {594136800, 825, 1, 0},
+    {605023200, 765, 0, 0},
+    {623772000, 825, 1, 0},
+    {637682400, 765, 0, 0},
+    {655221600, 825, 1, 0},
+    {669132000, 765, 0, 0},
+    {686671200, 825, 1, 0},
+    {700581600, 765, 0, 0},
+    {718120800, 825, 1, 0},
+    {732636000, 765, 0, 0},
+    {749570400, 825, 1, 0},
+    {764085600, 765, 0, 0},
+    {781020000, 825, 1, 0},
+    {795535200, 765, 0, 0},
+    {812469600, 825, 1, 0},
+    {826984800, 765, 0, 0},
+    {844524000, 825, 1, 0},
+    {858434400, 765, 0, 0},
+    {875973600, 825, 1, 0},
+    {889884000, 765, 0, 0},
+    {907423200, 825, 1, 0},
+    {921938400, 765, 0, 0},
+    {938872800, 825, 1, 0},
+    {953388000, 765, 0, 0},
+    {970322400, 825, 1, 0},
+    {984837600, 765, 0, 0},
+    {1002376800, 825, 1, 0},
+    {1016287200, 765, 0, 0},
+    {1033826400, 825, 1, 0},
+    {1047736800, 765, 0, 0},
+    {1065276000, 825, 1, 0},
+    {1079791200, 765, 0, 0},
+    {1096725600, 825, 1, 0},
+    {1111240800, 765, 0, 0},
+    {1128175200, 825, 1, 0},
+    {1142690400, 765, 0, 0},
+    {1159624800, 825, 1, 0},
+    {1174140000, 765, 0, 0},
+    {1191074400, 825, 1, 0},
+    {1207404000, 765, 0, 0},
+    {1222524000, 825, 1, 0},
+    {1238853600, 765, 0, 0},
+    {1253973600, 825, 1, 0},
+    {1270303200, 765, 0, 0},
+    {1285423200, 825, 1, 0},
+    {1301752800, 765, 0, 0},
+    {1316872800, 825, 1, 0},
+    {1333202400, 765, 0, 0},
+    {1348927200, 825, 1, 0},
+    {1365256800, 765, 0, 0},
+    {1380376800, 825, 1, 0},
+    {1396706400, 765, 0, 0},
+    {1411826400, 825, 1, 0},
+    {1428156000, 765, 0, 0},
+    {1443276000, 825, 1, 0},
+    {1459605600, 765, 0, 0},
+    {1474725600, 825, 1, 0},
+    {1491055200, 765, 0, 0},
+    {1506175200, 825, 1, 0},
+    {1522504800, 765, 0, 0},
+    {1538229600, 825, 1, 0},
+    {1554559200, 765, 0, 0},
+    {1569679200, 825, 1, 0},
+    {1586008800, 765, 0, 0},
+    {1601128800, 825, 1, 0},
+    {1617458400, 765, 0, 0},
+    {1632578400, 825, 1, 0},
+    {1648908000, 765, 0, 0},
+    {1664028000, 825, 1, 0},
+    {1680357600, 765, 0, 0},
+    {1695477600, 825, 1, 0},
+    {1712412000, 765, 0, 0},
+    {1727532000, 825, 1, 0},
+    {1743861600, 765, 0, 0},
+    {1758981600, 825, 1, 0},
+    {1775311200, 765, 0, 0},
+    {1790431200, 825, 1, 0},
+    {1806760800, 765, 0, 0},
+    {1821880800, 825, 1, 0},
+    {1838210400, 765, 0, 0},
+    {1853330400, 825, 1, 0},
+    {1869660000, 765, 0, 0},
+    {1885384800, 825, 1, 0},
+    {1901714400, 765, 0, 0},
+    {1916834400, 825, 1, 0},
+    {1933164000, 765, 0, 0},
+    {1948284000, 825, 1, 0},
+    {1964613600, 765, 0, 0},
+    {1979733600, 825, 1, 0},
+    {1996063200, 765, 0, 0},
+    {2011183200, 825, 1, 0},
+    {2027512800, 765, 0, 0},
+    {2042632800, 825, 1, 0},
+    {2058962400, 765, 0, 0},
+    {2074687200, 825, 1, 0},
+    {2091016800, 765, 0, 0},
+    {2106136800, 825, 1, 0},
+    {2122466400, 765, 0, 0},
+    {2137586400, 825, 1, 0},
+    {2147483647, 825, 1, 0},
+};
+
+// Отсортировано по имени (strcmp) - бинарный поиск в tzdbFindZone()
+static const TzdbZone TZDB_ZONES[] = {
+    {"America/Anchorage", "Анкоридж (AKST/AKDT)", 0, 76, -600, 0, 1, -540, -480, {0, 3, 2, 0, 0, 120}, {0, 11, 1, 0, 0, 120}},  // AKST9AKDT,M3.2.0,M11.1.0
+    {"America/Chicago", "Чикаго (CST/CDT)", 76, 75, -360, 0, 1, -360, -300, {0, 3, 2, 0, 0, 120}, {0, 11, 1, 0, 0, 120}},  // CST6CDT,M3.2.0,M11.1.0
+    {"America/Denver", "Денвер (MST/MDT)", 151, 75, -420, 0, 1, -420, -360, {0, 3, 2, 0, 0, 120}, {0, 11, 1, 0, 0, 120}},  // MST7MDT,M3.2.0,M11.1.0
+    {"America/Los_Angeles", "Лос-Анджелес (PST/PDT)", 226, 75, -480, 0, 1, -480, -420, {0, 3, 2, 0, 0, 120}, {0, 11, 1, 0, 0, 120}},  // PST8PDT,M3.2.0,M11.1.0
+    {"America/New_York", "Нью-Йорк (EST/EDT)", 301, 75, -300, 0, 1, -300, -240, {0, 3, 2, 0, 0, 120}, {0, 11, 1, 0, 0, 120}},  // EST5EDT,M3.2.0,M11.1.0
+    {"America/Sao_Paulo", "Сан-Паулу (BRT/BRST)", 376, 69, -180, 0, 0, -180, -180, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // <-03>3
+    {"America/St_Johns", "Сент-Джонс (NST/NDT)", 445, 84, -210, 0, 1, -210, -150, {0, 3, 2, 0, 0, 120}, {0, 11, 1, 0, 0, 120}},  // NST3:30NDT,M3.2.0,M11.1.0
+    {"Asia/Bangkok", "Бангкок (ICT)", 529, 1, 420, 0, 0, 420, 420, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // <+07>-7
+    {"Asia/Dubai", "Дубай (GST)", 530, 1, 240, 0, 0, 240, 240, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // <+04>-4
+    {"Asia/Jerusalem", "Иерусалим (IST/IDT)", 531, 65, 120, 0, 1, 120, 180, {0, 3, 4, 4, 0, 1560}, {0, 10, 5, 0, 0, 120}},  // IST-2IDT,M3.4.4/26,M10.5.0
+    {"Asia/Kabul", "Кабул (AFT, UTC+4:30)", 596, 1, 270, 0, 0, 270, 270, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // <+0430>-4:30
+    {"Asia/Kathmandu", "Катманду (NPT, UTC+5:45)", 597, 2, 330, 0, 0, 345, 345, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // <+0545>-5:45
+    {"Asia/Kolkata", "Калькутта (IST, UTC+5:30)", 599, 0, 330, 0, 0, 330, 330, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // IST-5:30
+    {"Asia/Seoul", "Сеул (KST)", 599, 4, 540, 0, 0, 540, 540, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // KST-9
+    {"Asia/Shanghai", "Шанхай (CST)", 603, 12, 480, 0, 0, 480, 480, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // CST-8
+    {"Asia/Singapore", "Сингапур (SGT)", 615, 2, 450, 0, 0, 480, 480, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // <+08>-8
+    {"Asia/Tehran", "Тегеран (IRST, UTC+3:30)", 617, 70, 210, 0, 0, 210, 210, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // <+0330>-3:30
+    {"Asia/Tokyo", "Токио (JST)", 687, 0, 540, 0, 0, 540, 540, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // JST-9
+    {"Asia/Yangon", "Янгон (MMT, UTC+6:30)", 687, 1, 390, 0, 0, 390, 390, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // <+0630>-6:30
+    {"Australia/Adelaide", "Аделаида (ACST/ACDT)", 688, 73, 570, 0, 1, 570, 630, {0, 10, 1, 0, 0, 120}, {0, 4, 1, 0, 0, 180}},  // ACST-9:30ACDT,M10.1.0,M4.1.0/3
+    {"Australia/Darwin", "Дарвин (ACST)", 761, 0, 570, 0, 0, 570, 570, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // ACST-9:30
+    {"Australia/Perth", "Перт (AWST)", 761, 12, 480, 0, 0, 480, 480, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // AWST-8
+    {"Australia/Sydney", "Сидней (AEDT/AEST)", 773, 73, 600, 0, 1, 600, 660, {0, 10, 1, 0, 0, 120}, {0, 4, 1, 0, 0, 180}},  // AEST-10AEDT,M10.1.0,M4.1.0/3
+    {"CET", "Центральноевропейское (CET)", 846, 39, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Amsterdam", "Амстердам (CET/CEST)", 885, 39, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Athens", "Афины (EET/EEST)", 924, 43, 120, 0, 1, 120, 180, {0, 3, 5, 0, 0, 180}, {0, 10, 5, 0, 0, 240}},  // EET-2EEST,M3.5.0/3,M10.5.0/4
+    {"Europe/Berlin", "Берлин (CET/CEST)", 967, 33, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Brussels", "Брюссель (CET/CEST)", 1000, 39, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Bucharest", "Бухарест (EET/EEST)", 1039, 37, 120, 0, 1, 120, 180, {0, 3, 5, 0, 0, 180}, {0, 10, 5, 0, 0, 240}},  // EET-2EEST,M3.5.0/3,M10.5.0/4
+    {"Europe/Copenhagen", "Копенгаген (CET/CEST)", 1076, 33, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Dublin", "Дублин (GMT/IST)", 1109, 50, 60, 0, 1, 60, 0, {0, 10, 5, 0, 0, 120}, {0, 3, 5, 0, 0, 60}},  // IST-1GMT0,M10.5.0,M3.5.0/1
+    {"Europe/Helsinki", "Хельсинки (EET/EEST)", 1159, 31, 120, 0, 1, 120, 180, {0, 3, 5, 0, 0, 180}, {0, 10, 5, 0, 0, 240}},  // EET-2EEST,M3.5.0/3,M10.5.0/4
+    {"Europe/Istanbul", "Стамбул (TRT)", 1190, 80, 120, 0, 0, 180, 180, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // <+03>-3
+    {"Europe/Kiev", "Київ (EET/EEST)", 1270, 31, 180, 0, 1, 120, 180, {0, 3, 5, 0, 0, 180}, {0, 10, 5, 0, 0, 240}},  // EET-2EEST,M3.5.0/3,M10.5.0/4
+    {"Europe/Kyiv", "Київ (EET/EEST)", 1301, 31, 180, 0, 1, 120, 180, {0, 3, 5, 0, 0, 180}, {0, 10, 5, 0, 0, 240}},  // EET-2EEST,M3.5.0/3,M10.5.0/4
+    {"Europe/Lisbon", "Лиссабон (WET/WEST)", 1332, 40, 60, 0, 1, 0, 60, {0, 3, 5, 0, 0, 60}, {0, 10, 5, 0, 0, 120}},  // WET0WEST,M3.5.0/1,M10.5.0
+    {"Europe/London", "Лондон (GMT/BST)", 1372, 50, 60, 0, 1, 0, 60, {0, 3, 5, 0, 0, 60}, {0, 10, 5, 0, 0, 120}},  // GMT0BST,M3.5.0/1,M10.5.0
+    {"Europe/Madrid", "Мадрид (CET/CEST)", 1422, 45, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Moscow", "Москва (MSK)", 1467, 63, 180, 0, 0, 180, 180, {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}},  // MSK-3
+    {"Europe/Oslo", "Осло (CET/CEST)", 1530, 33, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Paris", "Париж (CET/CEST)", 1563, 41, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Prague", "Прага (CET/CEST)", 1604, 35, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Riga", "Рига (EET/EEST)", 1639, 39, 180, 0, 1, 120, 180, {0, 3, 5, 0, 0, 180}, {0, 10, 5, 0, 0, 240}},  // EET-2EEST,M3.5.0/3,M10.5.0/4
+    {"Europe/Rome", "Рим (CET/CEST)", 1678, 53, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Sofia", "София (EET/EEST)", 1731, 37, 120, 0, 1, 120, 180, {0, 3, 5, 0, 0, 180}, {0, 10, 5, 0, 0, 240}},  // EET-2EEST,M3.5.0/3,M10.5.0/4
+    {"Europe/Stockholm", "Стокгольм (CET/CEST)", 1768, 33, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Tallinn", "Таллинн (EET/EEST)", 1801, 39, 180, 0, 1, 120, 180, {0, 3, 5, 0, 0, 180}, {0, 10, 5, 0, 0, 240}},  // EET-2EEST,M3.5.0/3,M10.5.0/4
+    {"Europe/Vienna", "Вена (CET/CEST)", 1840, 33, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Vilnius", "Вильнюс (EET/EEST)", 1873, 39, 180, 0, 1, 120, 180, {0, 3, 5, 0, 0, 180}, {0, 10, 5, 0, 0, 240}},  // EET-2EEST,M3.5.0/3,M10.5.0/4
+    {"Europe/Warsaw", "Варшава (CET/CEST)", 1912, 39, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Europe/Zurich", "Цюрих (CET/CEST)", 1951, 31, 60, 0, 1, 60, 120, {0, 3, 5, 0, 0, 120}, {0, 10, 5, 0, 0, 180}},  // CET-1CEST,M3.5.0,M10.5.0/3
+    {"Pacific/Auckland", "Окленд (NZST/NZDT)", 1982, 67, 720, 0, 1, 720, 780, {0, 9, 5, 0, 0, 120}, {0, 4, 1, 0, 0, 180}},  // NZST-12NZDT,M9.5.0,M4.1.0/3
+    {"Pacific/Chatham", "Чатем (CHAST/CHADT)", 2049, 128, 765, 0, 1, 765, 825, {0, 9, 5, 0, 0, 165}, {0, 4, 1, 0, 0, 225}},  // <+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdint.h>
+
+// Счёт секунд опоры UTC по фронтам SQW DS3231 без зависимостей от Arduino/IDF
+// (собирается и на хосте, test/native).
+
+// Сколько секунд UTC прошло от опоры до фронта SQW (deltaUs = фронт - опора, > 0).
+// Фаза опоры известна - это фронт SQW или запись регистра секунд, после которой спад
+// SQW приходит ровно через 1 с: округление, уход esp_timer и погрешность записи много
+// меньше полсекунды. Опора от чтения регистра лежит в произвольной фазе секунды:
+// первый фронт после неё начинает следующую секунду.
+constexpr int64_t utcSecondsToSqwEdge(int64_t deltaUs, bool phaseKnown) {
+    return phaseKnown ? (deltaUs + 500000) / 1000000 : (deltaUs + 999999) / 1000000;
+}
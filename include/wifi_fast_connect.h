@@ -0,0 +1,18 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Подключение STA с кэшем последней успешной ассоциации (cfg_nvs, по SSID):
+// сначала направленное подключение (BSSID + канал, при свежей аренде — без DHCP),
+// при неудаче — обычное WiFi.begin() со сканированием. Режим STA включает вызывающий.
+struct WifiConnectInfo {
+    bool directed = false;     // подключились по кэшу BSSID/канала
+    bool cachedLease = false;  // адрес взят из кэша, DHCP не выполнялся
+    uint32_t connectMs = 0;    // время до WL_CONNECTED
+};
+
+bool wifiFastConnect(const char* ssid, const char* pass, uint32_t timeoutMs,
+                     const char* logPrefix, WifiConnectInfo* info = nullptr);
+
+// Сеть доступна, но обмен не удался: следующий раз адрес получить по DHCP.
+void wifiFastConnectDropLease(const char* ssid);
@@ -0,0 +1,372 @@
+#!/usr/bin/env python3
+"""
+Генератор компактной базы часовых поясов (подмножество IANA tzdb) для прошивки.
+
+Источник - скомпилированные файлы TZif (по умолчанию /usr/share/zoneinfo).
+Результат - include/tzdb_data.h: константные таблицы во flash (.rodata,
+доступны через кэш/MMU как обычная память), имена отсортированы для
+бинарного поиска, смещения в минутах.
+
+Для каждой зоны сохраняются:
+  - исторические переходы с 1970 года до момента, с которого действует
+    POSIX-правило из хвоста TZif (переходы, которые правило и так даёт,
+    отбрасываются);
+  - само POSIX-правило в разобранном виде (без строк и парсинга на устройстве).
+
+Набор зон: все пресеты из TIMEZONE_PRESETS (src/timezone_manager.cpp)
+плюс EXTRA_ZONES (зоны с дробным смещением и т.п.).
+
+Запуск:  python scripts/gen_tzdb.py [--zoneinfo DIR]
+"""
+import argparse
+import calendar
+import re
+import struct
+import sys
+from pathlib import Path
+
+PROJECT_DIR = Path(__file__).resolve().parent.parent
+PRESETS_SOURCE = PROJECT_DIR / "src" / "timezone_manager.cpp"
+OUTPUT_HEADER = PROJECT_DIR / "include" / "tzdb_data.h"
+
+# Зоны вне таблицы пресетов: имя IANA -> отображаемое имя
+EXTRA_ZONES = {
+    "Asia/Kolkata": "Калькутта (IST, UTC+5:30)",
+    "Asia/Kathmandu": "Катманду (NPT, UTC+5:45)",
+    "Asia/Tehran": "Тегеран (IRST, UTC+3:30)",
+    "Asia/Kabul": "Кабул (AFT, UTC+4:30)",
+    "Asia/Yangon": "Янгон (MMT, UTC+6:30)",
+    "Australia/Adelaide": "Аделаида (ACST/ACDT)",
+    "Australia/Darwin": "Дарвин (ACST)",
+    "America/St_Johns": "Сент-Джонс (NST/NDT)",
+    "Pacific/Chatham": "Чатем (CHAST/CHADT)",
+    "Europe/Moscow": "Москва (MSK)",
+    "Europe/Kyiv": "Київ (EET/EEST)",
+}
+
+FIRST_UTC = 0               # 1970-01-01
+LAST_UTC = 2**31 - 1        # int32 на устройстве; дальше действует правило
+
+KIND_MONTH_WEEK_DAY = 0
+KIND_JULIAN_NOLEAP = 1
+KIND_ZERO_BASED = 2
+
+
+def read_presets():
+    text = PRESETS_SOURCE.read_text(encoding="utf-8")
+    body = text[text.index("TIMEZONE_PRESETS[]"):]
+    body = body[:body.index("};")]
+    presets = {}
+    for line in body.splitlines():
+        if line.strip().startswith("//"):
+            continue
+        m = re.match(r'\s*\{"([^"]+)",\s*"([^"]+)"', line)
+        if m:
+            presets[m.group(1)] = m.group(2)
+    return presets
+
+
+# ---------- TZif ----------
+
+def parse_tzif(path):
+    data = path.read_bytes()
+    if data[:4] != b"TZif":
+        raise ValueError("not a TZif file: %s" % path)
+
+    def counts(offset):
+        return struct.unpack(">6l", data[offset + 20:offset + 44])
+
+    isut, isstd, leap, timecnt, typecnt, charcnt = counts(0)
+    version = data[4:5]
+    pos = 44
+    v1_len = timecnt * 5 + typecnt * 6 + charcnt + leap * 8 + isstd + isut
+    time_size = 4
+    if version >= b"2":
+        pos += v1_len
+        isut, isstd, leap, timecnt, typecnt, charcnt = counts(pos)
+        pos += 44
+        time_size = 8
+
+    fmt = ">%d%s" % (timecnt, "q" if time_size == 8 else "l")
+    times = struct.unpack(fmt, data[pos:pos + timecnt * time_size])
+    pos += timecnt * time_size
+    idxs = data[pos:pos + timecnt]
+    pos += timecnt
+    types = []
+    for i in range(typecnt):
+        utoff, isdst, _abbr = struct.unpack(">lBB", data[pos + i * 6:pos + i * 6 + 6])
+        types.append((utoff, bool(isdst)))
+    pos += typecnt * 6 + charcnt + leap * (time_size + 4) + isstd + isut
+
+    footer = ""
+    if time_size == 8:
+        tail = data[pos:].decode("ascii")
+        if tail.startswith("\n"):
+            footer = tail[1:tail.index("\n", 1)]
+
+    transitions = [(times[i], types[idxs[i]]) for i in range(timecnt)]
+    return types, transitions, footer
+
+
+# ---------- POSIX TZ ----------
+
+def _name(s, i):
+    if s[i] == "<":
+        j = s.index(">", i)
+        return j + 1
+    j = i
+    while j < len(s) and s[j].isalpha():
+        j += 1
+    if j - i < 3:
+        raise ValueError("bad TZ name in %r" % s)
+    return j
+
+
+def _time(s, i):
+    sign = 1
+    if s[i] in "+-":
+        sign = -1 if s[i] == "-" else 1
+        i += 1
+    m = re.match(r"(\d+)(?::(\d+))?(?::(\d+))?", s[i:])
+    h, mi, se = (int(x) if x else 0 for x in m.groups())
+    return sign * (h * 3600 + mi * 60 + se), i + m.end()
+
+
+def _date(s, i):
+    if s[i] == "M":
+        m = re.match(r"M(\d+)\.(\d+)\.(\d+)", s[i:])
+        rule = [KIND_MONTH_WEEK_DAY, int(m.group(1)), int(m.group(2)), int(m.group(3)), 0]
+    elif s[i] == "J":
+        m = re.match(r"J(\d+)", s[i:])
+        rule = [KIND_JULIAN_NOLEAP, 0, 0, 0, int(m.group(1))]
+    else:
+        m = re.match(r"(\d+)", s[i:])
+        rule = [KIND_ZERO_BASED, 0, 0, 0, int(m.group(1))]
+    i += m.end()
+    t = 7200
+    if i < len(s) and s[i] == "/":
+        t, i = _time(s, i + 1)
+    return rule + [t], i
+
+
+def parse_posix(s):
+    i = _name(s, 0)
+    off, i = _time(s, i)
+    rule = {"std": -off, "dst": -off, "has_dst": False, "start": None, "end": None}
+    if i == len(s):
+        return rule
+    i = _name(s, i)
+    rule["has_dst"] = True
+    rule["dst"] = rule["std"] + 3600
+    if i < len(s) and s[i] != ",":
+        off, i = _time(s, i)
+        rule["dst"] = -off
+    if i == len(s):
+        rule["start"] = [KIND_MONTH_WEEK_DAY, 3, 2, 0, 0, 7200]
+        rule["end"] = [KIND_MONTH_WEEK_DAY, 11, 1, 0, 0, 7200]
+        return rule
+    rule["start"], i = _date(s, i + 1)
+    rule["end"], i = _date(s, i + 1)
+    if rule["dst"] == rule["std"]:
+        rule["has_dst"] = False
+    return rule
+
+
+def rule_date_utc(year, date, offset_before):
+    kind, month, week, dow, yday, t = date
+    jan1 = calendar.timegm((year, 1, 1, 0, 0, 0))
+    if kind == KIND_JULIAN_NOLEAP:
+        days = yday - 1 + (1 if yday >= 60 and calendar.isleap(year) else 0)
+    elif kind == KIND_ZERO_BASED:
+        days = yday
+    else:
+        first_dow = (calendar.weekday(year, month, 1) + 1) % 7  # 0 = воскресенье
+        day = 1 + (dow - first_dow + 7) % 7
+        if week <= 4:
+            day += (week - 1) * 7
+        else:
+            day += 21
+            if day + 7 <= calendar.monthrange(year, month)[1]:
+                day += 7
+        days = (calendar.timegm((year, month, day, 0, 0, 0)) - jan1) // 86400
+    return jan1 + days * 86400 + t - offset_before
+
+
+def rule_transitions(rule, year_from, year_to):
+    out = []
+    if not rule["has_dst"]:
+        return out
+    for y in range(year_from, year_to + 1):
+        out.append((rule_date_utc(y, rule["start"], rule["std"]), (rule["dst"], True)))
+        out.append((rule_date_utc(y, rule["end"], rule["dst"]), (rule["std"], False)))
+    out.sort()
+    return out
+
+
+def rule_state(rule, utc):
+    if not rule["has_dst"]:
+        return (rule["std"], False)
+    year = 1970 + utc // 31556952
+    prev = None
+    for t, state in rule_transitions(rule, year - 2, year + 2):
+        if t <= utc:
+            prev = state
+    return prev
+
+
+# ---------- Сборка зоны ----------
+
+def build_zone(name, zoneinfo):
+    types, transitions, footer = parse_tzif(Path(zoneinfo) / name)
+    if not footer:
+        raise ValueError("%s: TZif без POSIX-правила" % name)
+    rule = parse_posix(footer)
+
+    # Состояние на 1970-01-01
+    initial = types[0]
+    for t, state in transitions:
+        if t < FIRST_UTC:
+            initial = state
+    kept = [(t, s) for t, s in transitions if FIRST_UTC <= t <= LAST_UTC]
+
+    # Убираем хвост, который воспроизводит правило
+    while kept:
+        t, state = kept[-1]
+        before = kept[-2][1] if len(kept) > 1 else initial
+        prev_t = kept[-2][0] if len(kept) > 1 else FIRST_UTC
+        # Правило должно давать ровно этот переход между соседними явными
+        # (пропущенный год летнего времени, как Рига в 2000 г., так не сокращается)
+        rule_changes = [rt for rt, _s in rule_transitions(rule, 1969, 2040) if prev_t < rt <= t]
+        if rule_changes == [t] and rule_state(rule, t) == state and rule_state(rule, t - 1) == before:
+            kept.pop()
+        else:
+            break
+    # После последнего явного перехода его состояние держится до ближайшего
+    # перехода по правилу, дальше - правило (см. zone_state)
+    rule_from = kept[-1][0] if kept else FIRST_UTC
+
+    for _t, (off, _dst) in kept + [(0, initial)]:
+        if off % 60:
+            raise ValueError("%s: смещение %d с не кратно минуте" % (name, off))
+
+    zone = {"name": name, "initial": initial, "transitions": kept, "rule": rule,
+            "footer": footer, "rule_from": rule_from}
+    verify_zone(zone, transitions)
+    return zone
+
+
+def zone_state(zone, utc):
+    # Та же логика, что в timezone_manager (tzdb-интервал): до rule_from - явные
+    # переходы, после - состояние последнего из них до первого перехода правила
+    trans = zone["transitions"]
+    if trans and utc < zone["rule_from"]:
+        state = zone["initial"]
+        for t, s in trans:
+            if t <= utc:
+                state = s
+        return state
+    if trans:
+        year = 1970 + utc // 31556952
+        if not any(zone["rule_from"] < t <= utc for t, _s in rule_transitions(zone["rule"], year - 2, year + 1)):
+            return trans[-1][1]
+    return rule_state(zone["rule"], utc)
+
+
+def verify_zone(zone, transitions):
+    # Сверка с полными данными TZif на 1970..2037: каждый переход (явный и по правилу) и шаг в неделю
+    probes = [FIRST_UTC, LAST_UTC - 1]
+    for t, _s in transitions + rule_transitions(zone["rule"], 1970, 2037):
+        if FIRST_UTC < t < LAST_UTC:
+            probes += [t - 1, t]
+    probes += range(FIRST_UTC, LAST_UTC, 7 * 86400)
+    for utc in probes:
+        expected = zone["initial"]
+        for t, s in transitions:
+            if t <= utc:
+                expected = s
+        if zone_state(zone, utc) != expected:
+            raise ValueError("%s: расхождение в %d: %r != %r" % (zone["name"], utc, zone_state(zone, utc), expected))
+
+
+# ---------- Вывод ----------
+
+def c_string(s):
+    return '"' + s.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def c_date(date):
+    if date is None:
+        return "{0, 0, 0, 0, 0, 0}"
+    kind, month, week, dow, yday, t = date
+    assert t % 60 == 0
+    return "{%d, %d, %d, %d, %d, %d}" % (kind, month, week, dow, yday, t // 60)
+
+
+def tzdata_version(zoneinfo):
+    for candidate in ("tzdata.zi", "+VERSION"):
+        p = Path(zoneinfo) / candidate
+        if p.exists():
+            first = p.read_text(encoding="ascii", errors="ignore").splitlines()[0]
+            return first.replace("# version", "").strip()
+    return "unknown"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("--zoneinfo", default="/usr/share/zoneinfo")
+    args = parser.parse_args()
+
+    names = dict(read_presets())
+    for zone_name, display in EXTRA_ZONES.items():
+        names.setdefault(zone_name, display)
+
+    zones = []
+    for zone_name in sorted(names):
+        try:
+            zones.append((build_zone(zone_name, args.zoneinfo), names[zone_name]))
+        except (OSError, ValueError) as exc:
+            print("[tzdb] пропуск %s: %s" % (zone_name, exc), file=sys.stderr)
+
+    version = tzdata_version(args.zoneinfo)
+    lines = [
+        "#pragma once",
+        "",
+        "// СГЕНЕРИРОВАНО scripts/gen_tzdb.py - не редактировать вручную.",
+        "// Источник: IANA tzdb %s (TZif), зон: %d." % (version, len(zones)),
+        "",
+        '#include "tzdb.h"',
+        "",
+        'static const char TZDB_VERSION[] = %s;' % c_string(version),
+        "",
+        "static const TzdbTransition TZDB_TRANSITIONS[] = {",
+    ]
+    first = 0
+    records = []
+    for zone, display in zones:
+        trans = zone["transitions"]
+        if trans:
+            lines.append("    // %s" % zone["name"])
+        for t, (off, dst) in trans:
+            lines.append("    {%d, %d, %d, 0}," % (t, off // 60, 1 if dst else 0))
+        records.append((zone, display, first, len(trans)))
+        first += len(trans)
+    if first == 0:
+        lines.append("    {0, 0, 0, 0},")
+    lines += ["};", "", "// Отсортировано по имени (strcmp) - бинарный поиск в tzdbFindZone()",
+              "static const TzdbZone TZDB_ZONES[] = {"]
+    for zone, display, first_idx, count in records:
+        rule = zone["rule"]
+        init_off, init_dst = zone["initial"]
+        lines.append("    {%s, %s, %d, %d, %d, %d, %d, %d, %d, %s, %s},  // %s" % (
+            c_string(zone["name"]), c_string(display), first_idx, count,
+            init_off // 60, 1 if init_dst else 0, 1 if rule["has_dst"] else 0,
+            rule["std"] // 60, rule["dst"] // 60, c_date(rule["start"]), c_date(rule["end"]),
+            zone["footer"]))
+    lines += ["};", ""]
+
+    OUTPUT_HEADER.write_text("\n".join(lines), encoding="utf-8")
+    print("[tzdb] %s: %d зон, %d переходов (tzdata %s)" % (OUTPUT_HEADER.name, len(records), first, version))
+
+
+if __name__ == "__main__":
+    main()
@@ -132,17 +132,12 @@ void checkAlarms() {
         return;
     }
 
-    time_t now_utc = getCurrentUTCTime();
-    if (now_utc == 0) {
+    const TimeSnapshot now = getTimeSnapshot();
+    if (now.utc == 0) {
         return;  // Время не получено
     }
 
-    // Конвертируем UTC в локальное время для будильников
-    time_t now_local = utcToLocal(now_utc);
-    struct tm timeinfo;
-    gmtime_r(&now_local, &timeinfo);  // now_local уже со смещением
-
-    checkAlarmsAtTick(now_utc, timeinfo);
+    checkAlarmsAtTick(now.utc, now.localTm);
 }
 
 void checkAlarmsAtTick(time_t now_utc, const tm& local_timeinfo) {
@@ -203,12 +198,10 @@ void checkAlarmsAtTick(time_t now_utc, const tm& local_timeinfo) {
 
 // Дополнительная функция для проверки времени до будильника (опционально)
 uint16_t getMinutesToNextAlarm() {
-    time_t now_utc = getCurrentUTCTime();
-    if (now_utc == 0) return 0xFFFF;
+    const TimeSnapshot now = getTimeSnapshot();
+    if (now.utc == 0) return 0xFFFF;
 
-    time_t now_local_time = utcToLocal(now_utc);
-    struct tm now_local;
-    gmtime_r(&now_local_time, &now_local);
+    const tm& now_local = now.localTm;
     
     // Текущее время в минутах от начала дня
     uint16_t currentMinutes = now_local.tm_hour * 60 + now_local.tm_min;
@@ -0,0 +1,32 @@
+#include "audio_gain.h"
+
+void applyGainToInterleavedBuffer(int16_t* samples, size_t sampleCount, uint16_t gainQ15) {
+    if (!samples || sampleCount == 0 || gainQ15 >= AUDIO_GAIN_UNITY_Q15) {
+        return;
+    }
+
+    const int32_t gain = gainQ15;
+    size_t i = 0;
+    // По два стереокадра за проход: меньше ветвлений цикла на отсчёт
+    for (; i + 4 <= sampleCount; i += 4) {
+        samples[i] = scaleSampleQ15(samples[i], gain);
+        samples[i + 1] = scaleSampleQ15(samples[i + 1], gain);
+        samples[i + 2] = scaleSampleQ15(samples[i + 2], gain);
+        samples[i + 3] = scaleSampleQ15(samples[i + 3], gain);
+    }
+    for (; i < sampleCount; ++i) {
+        samples[i] = scaleSampleQ15(samples[i], gain);
+    }
+}
+
+void applyVolumePercentReference(int16_t* samples, size_t sampleCount, uint8_t volumePercent) {
+    const uint16_t vol = (volumePercent > 100U) ? 100U : volumePercent;
+    if (!samples || vol >= 100U) {
+        return;
+    }
+
+    for (size_t i = 0; i < sampleCount; ++i) {
+        const int32_t scaled = (static_cast<int32_t>(samples[i]) * static_cast<int32_t>(vol)) / 100;
+        samples[i] = static_cast<int16_t>(scaled);
+    }
+}
@@ -1,4 +1,5 @@
 #include "audio_task.h"
+#include "audio_gain.h"
 
 #include "config.h"
 #include "ota_manager.h"
@@ -22,6 +23,17 @@ constexpr uint8_t AUDIO_TASK_CORE = 1;
 constexpr UBaseType_t AUDIO_TASK_PRIO = 1;
 constexpr uint32_t SD_REPROBE_INTERVAL_MS = 60000UL;
 
+// Конвейер DMA: один буфер = один блок AUDIO_CHUNK_SAMPLES кадров. Задача спит,
+// пока DMA не отдаст буфер, и доливает кольцо, оставляя буфер под передачу.
+constexpr uint8_t AUDIO_DMA_BUFFERS = AUDIO_DMA_BUFFER_COUNT;
+constexpr uint8_t AUDIO_DMA_QUEUE_TARGET = AUDIO_DMA_BUFFERS - 1;
+constexpr uint32_t AUDIO_REFILL_WAIT_MS = 50;  // Заодно предел задержки команд
+constexpr uint32_t AUDIO_WRITE_TIMEOUT_MS = 2;
+static_assert(AUDIO_DMA_BUFFER_COUNT >= 3 && AUDIO_DMA_BUFFER_COUNT <= 16,
+              "AUDIO_DMA_BUFFER_COUNT: 3..16 буферов");
+
+constexpr uint16_t AUDIO_TONE_AMPLITUDE = 12000;
+
 enum class AudioCommandType : uint8_t {
     PlayFlashFile,
     PlaySdFile,
@@ -52,7 +64,7 @@ struct ToneState {
     uint16_t freqHz = 0;
     uint32_t remainingSamples = 0;
     uint32_t phase = 0;
-    uint8_t volumePercent = 30;
+    uint16_t gainQ15 = volumePercentToGainQ15(30);
 };
 
 struct WavStreamState {
@@ -61,7 +73,7 @@ struct WavStreamState {
     size_t dataBytesRemaining = 0;
     uint32_t sampleRate = AUDIO_SAMPLE_RATE;
     uint8_t channels = 1; // 1 = mono, 2 = stereo
-    uint8_t volumePercent = 100;
+    uint16_t gainQ15 = AUDIO_GAIN_UNITY_Q15;
     bool isSdStream = false;
     AudioTestSource source = AudioTestSource::None;
 };
@@ -84,6 +96,21 @@ static volatile bool g_audioTaskRunning = false;
 static volatile bool g_audioPlaybackActive = false;
 static QueueHandle_t g_audioQueue = nullptr;
 static bool g_i2sReady = false;
+static QueueHandle_t g_i2sEventQueue = nullptr;
+
+// Блок, ожидающий записи в DMA (хвост частичной записи дописывается при следующем пробуждении)
+static int16_t g_pcmChunk[AUDIO_CHUNK_SAMPLES * 2];
+static size_t g_pcmBytes = 0;
+static size_t g_pcmOffset = 0;
+static uint8_t g_dmaQueued = 0;  // Наших буферов в кольце, ещё не отправленных
+static uint8_t g_dmaLeadBuffers = 0;  // Буферов нулей auto clear впереди первого нашего
+static bool g_dmaPrimed = false;  // Наш буфер уже отправлен: дальше лишние отметки - недоливы
+
+// Счётчики конвейера (audio stat)
+static volatile uint32_t g_statRefills = 0;
+static volatile uint32_t g_statWakeups = 0;
+static volatile uint32_t g_statUnderruns = 0;
+static volatile uint32_t g_statPartialWrites = 0;
 static bool g_flashFsReady = false;
 static bool g_sdReady = false;
 static uint32_t g_lastSdProbeMs = 0;
@@ -109,7 +136,7 @@ static void resetWavStreamState(WavStreamState& wav) {
     wav.dataBytesRemaining = 0;
     wav.sampleRate = AUDIO_SAMPLE_RATE;
     wav.channels = 1;
-    wav.volumePercent = 100;
+    wav.gainQ15 = AUDIO_GAIN_UNITY_Q15;
     wav.isSdStream = false;
     wav.source = AudioTestSource::None;
 }
@@ -165,6 +192,8 @@ static bool ensureSdMounted(bool forceProbe = false) {
     return true;
 }
 
+// Legacy-драйвер I2S (IDF 4.4 в Arduino 2.x): события TX_DONE через его очередь
+
 static bool initI2S() {
     if (g_i2sReady) {
         return true;
@@ -178,8 +207,8 @@ static bool initI2S() {
     // Keep classic I2S frame format without using deprecated symbol aliases.
     config.communication_format = static_cast<i2s_comm_format_t>(0x01);
     config.intr_alloc_flags = ESP_INTR_FLAG_LEVEL1;
-    config.dma_buf_count = 8;
-    config.dma_buf_len = 256;
+    config.dma_buf_count = AUDIO_DMA_BUFFERS;
+    config.dma_buf_len = AUDIO_CHUNK_SAMPLES;
     config.use_apll = false;
     config.tx_desc_auto_clear = true;
     config.fixed_mclk = 0;
@@ -190,9 +219,10 @@ static bool initI2S() {
     pins.data_out_num = AUDIO_I2S_DOUT_PIN;
     pins.data_in_num = I2S_PIN_NO_CHANGE;
 
-    esp_err_t err = i2s_driver_install(AUDIO_I2S_PORT, &config, 0, nullptr);
+    esp_err_t err = i2s_driver_install(AUDIO_I2S_PORT, &config, AUDIO_DMA_BUFFERS, &g_i2sEventQueue);
     if (err != ESP_OK) {
         Serial.printf("\n[AUDIO] I2S install failed: %d", static_cast<int>(err));
+        g_i2sEventQueue = nullptr;
         return false;
     }
 
@@ -200,11 +230,12 @@ static bool initI2S() {
     if (err != ESP_OK) {
         Serial.printf("\n[AUDIO] I2S pin config failed: %d", static_cast<int>(err));
         i2s_driver_uninstall(AUDIO_I2S_PORT);
+        g_i2sEventQueue = nullptr;
         return false;
     }
 
     g_i2sReady = true;
-    Serial.printf("\n[AUDIO] I2S шина готова");
+    Serial.printf("\n[AUDIO] I2S шина готова (DMA %u x %u кадров)", AUDIO_DMA_BUFFERS, AUDIO_CHUNK_SAMPLES);
     return true;
 }
 
@@ -228,6 +259,13 @@ static bool setI2SRate(uint32_t sampleRate) {
     return true;
 }
 
+static void clearI2SOutput() {
+    if (!g_i2sReady) {
+        return;
+    }
+    i2s_zero_dma_buffer(AUDIO_I2S_PORT);
+}
+
 static void stopI2S() {
     if (!g_i2sReady) {
         return;
@@ -235,9 +273,40 @@ static void stopI2S() {
 
     i2s_zero_dma_buffer(AUDIO_I2S_PORT);
     i2s_driver_uninstall(AUDIO_I2S_PORT);
+    g_i2sEventQueue = nullptr;
     g_i2sReady = false;
 }
 
+static void writeI2S(const void* data, size_t bytes, size_t* written, TickType_t wait) {
+    *written = 0;
+    i2s_write(AUDIO_I2S_PORT, data, bytes, written, wait);
+}
+
+static uint32_t waitI2SBuffersSent(TickType_t wait) {
+    uint32_t sent = 0;
+    i2s_event_t event;
+    while (xQueueReceive(g_i2sEventQueue, &event, wait) == pdTRUE) {
+        if (event.type == I2S_EVENT_TX_DONE) {
+            sent++;
+        }
+        wait = 0;  // Дальше только забираем накопившееся
+    }
+    return sent;
+}
+
+static void discardI2SSentEvents() {
+    xQueueReset(g_i2sEventQueue);
+}
+
+// Забыть недописанный блок и учёт кольца: стоп, смена источника, перезапуск канала
+static void dropPendingChunk() {
+    g_pcmBytes = 0;
+    g_pcmOffset = 0;
+    g_dmaQueued = 0;
+    g_dmaLeadBuffers = 0;
+    g_dmaPrimed = false;
+}
+
 static bool openWavStreamFromFs(fs::FS& fs, const char* path, WavStreamState& outStream) {
     if (!path || path[0] == '\0') {
         return false;
@@ -536,22 +605,6 @@ static uint8_t resolveVolumePercent(const AudioCommand& cmd) {
     }
 }
 
-static void applyVolumeToInterleavedBuffer(int16_t* samples, size_t sampleCount, uint8_t volumePercent) {
-    if (!samples || sampleCount == 0) {
-        return;
-    }
-
-    const uint16_t vol = clampVolumePercent(volumePercent);
-    if (vol >= 100U) {
-        return;
-    }
-
-    for (size_t i = 0; i < sampleCount; ++i) {
-        const int32_t scaled = (static_cast<int32_t>(samples[i]) * static_cast<int32_t>(vol)) / 100;
-        samples[i] = static_cast<int16_t>(scaled);
-    }
-}
-
 static void playStartupGreetingIfAvailable(ToneState& tone, WavStreamState& wav) {
     if (!platformGetCapabilities().sound_enabled) {
         return;
@@ -637,11 +690,12 @@ static void applyCommand(const AudioCommand& cmd, ToneState& tone, WavStreamStat
         case AudioCommandType::PlayFlashFile: {
             tone.active = false;
             resetWavStreamState(wav);
+            dropPendingChunk();
             const uint8_t volumePercent = resolveVolumePercent(cmd);
 
             if (ensureFlashFsMounted() && openWavStreamFromFs(SPIFFS, cmd.path, wav)) {
                 wav.isSdStream = false;
-                wav.volumePercent = volumePercent;
+                wav.gainQ15 = volumePercentToGainQ15(volumePercent);
                 if (setI2SRate(wav.sampleRate)) {
                     wav.source = AudioTestSource::FlashWav;
                     g_lastTestSource = AudioTestSource::FlashWav;
@@ -659,11 +713,12 @@ static void applyCommand(const AudioCommand& cmd, ToneState& tone, WavStreamStat
         case AudioCommandType::PlaySdFile: {
             tone.active = false;
             resetWavStreamState(wav);
+            dropPendingChunk();
             const uint8_t volumePercent = resolveVolumePercent(cmd);
 
             if (ensureSdMounted() && openWavStreamFromFs(SD, cmd.path, wav)) {
                 wav.isSdStream = true;
-                wav.volumePercent = volumePercent;
+                wav.gainQ15 = volumePercentToGainQ15(volumePercent);
                 if (setI2SRate(wav.sampleRate)) {
                     wav.source = AudioTestSource::FlashWav;
                     g_lastTestSource = AudioTestSource::FlashWav;
@@ -680,6 +735,7 @@ static void applyCommand(const AudioCommand& cmd, ToneState& tone, WavStreamStat
         }
         case AudioCommandType::PlayTestTone: {
             resetWavStreamState(wav);
+            dropPendingChunk();
             const uint16_t freq = (cmd.freqHz == 0) ? 880 : cmd.freqHz;
             const uint16_t duration = (cmd.durationMs == 0) ? 1000 : cmd.durationMs;
             const uint8_t volumePercent = resolveVolumePercent(cmd);
@@ -687,7 +743,7 @@ static void applyCommand(const AudioCommand& cmd, ToneState& tone, WavStreamStat
             tone.freqHz = freq;
             tone.remainingSamples = (static_cast<uint32_t>(AUDIO_SAMPLE_RATE) * duration) / 1000UL;
             tone.phase = 0;
-            tone.volumePercent = volumePercent;
+            tone.gainQ15 = volumePercentToGainQ15(volumePercent);
             tone.active = (tone.remainingSamples > 0);
             g_lastTestSource = AudioTestSource::Tone;
             g_audioPlaybackActive = tone.active;
@@ -699,6 +755,7 @@ static void applyCommand(const AudioCommand& cmd, ToneState& tone, WavStreamStat
         case AudioCommandType::PlaySfx: {
             tone.active = false;
             resetWavStreamState(wav);
+            dropPendingChunk();
 
             const AudioSfxId sfx = static_cast<AudioSfxId>(cmd.sfxId);
             const char* path = sfxPath(sfx);
@@ -706,7 +763,7 @@ static void applyCommand(const AudioCommand& cmd, ToneState& tone, WavStreamStat
 
             if (path && ensureFlashFsMounted() && openWavStreamFromFs(SPIFFS, path, wav) && setI2SRate(wav.sampleRate)) {
                 wav.isSdStream = false;
-                wav.volumePercent = volumePercent;
+                wav.gainQ15 = volumePercentToGainQ15(volumePercent);
                 wav.source = AudioTestSource::FlashWav;
                 g_audioPlaybackActive = wav.active;
                 Serial.printf("\n[AUDIO][SFX] source: Flash FS: %s", path);
@@ -734,20 +791,19 @@ static void applyCommand(const AudioCommand& cmd, ToneState& tone, WavStreamStat
             tone.phase = 0;
             resetWavStreamState(wav);
             g_audioPlaybackActive = false;
-            if (g_i2sReady) {
-                i2s_zero_dma_buffer(AUDIO_I2S_PORT);
-            }
+            dropPendingChunk();
+            clearI2SOutput();
             Serial.print("\n[AUDIO] stop playback");
             break;
     }
 }
 
-static void feedToneChunk(ToneState& tone) {
-    if (!tone.active || tone.remainingSamples == 0 || !g_i2sReady) {
-        return;
+// Следующий блок меандра в out; 0 - тон закончился
+static uint16_t renderToneChunk(ToneState& tone, int16_t* out) {
+    if (!tone.active || tone.remainingSamples == 0) {
+        return 0;
     }
 
-    static int16_t interleaved[AUDIO_CHUNK_SAMPLES * 2];
     const uint32_t phaseStep = (static_cast<uint64_t>(tone.freqHz) * 0xFFFFFFFFULL) / AUDIO_SAMPLE_RATE;
 
     uint16_t count = AUDIO_CHUNK_SAMPLES;
@@ -755,41 +811,30 @@ static void feedToneChunk(ToneState& tone) {
         count = static_cast<uint16_t>(tone.remainingSamples);
     }
 
+    // Меандр: громкость применяется к амплитуде один раз на блок, а не к каждому отсчёту
+    const int16_t amplitude = scaleSampleQ15(AUDIO_TONE_AMPLITUDE, tone.gainQ15);
     for (uint16_t i = 0; i < count; ++i) {
         tone.phase += phaseStep;
-        const int16_t sample = (tone.phase & 0x80000000UL) ? 12000 : -12000;
-        interleaved[2 * i] = sample;      // L
-        interleaved[2 * i + 1] = sample;  // R
-    }
-
-    applyVolumeToInterleavedBuffer(interleaved, static_cast<size_t>(count) * 2U, tone.volumePercent);
-
-    size_t bytesWritten = 0;
-    const size_t bytesToWrite = static_cast<size_t>(count) * sizeof(int16_t) * 2;
-    i2s_write(AUDIO_I2S_PORT, interleaved, bytesToWrite, &bytesWritten, pdMS_TO_TICKS(5));
-
-    if (bytesWritten > 0) {
-        const uint32_t samplesWritten = static_cast<uint32_t>(bytesWritten / (sizeof(int16_t) * 2));
-        if (samplesWritten >= tone.remainingSamples) {
-            tone.remainingSamples = 0;
-        } else {
-            tone.remainingSamples -= samplesWritten;
-        }
+        const int16_t sample = (tone.phase & 0x80000000UL) ? amplitude : static_cast<int16_t>(-amplitude);
+        out[2 * i] = sample;      // L
+        out[2 * i + 1] = sample;  // R
     }
 
+    tone.remainingSamples -= count;
     if (tone.remainingSamples == 0) {
         tone.active = false;
         g_audioPlaybackActive = false;
         Serial.print("\n[AUDIO] Playback finished");
     }
+    return count;
 }
 
-static void feedWavStreamChunk(WavStreamState& wav) {
-    if (!wav.active || !wav.file || wav.dataBytesRemaining == 0 || !g_i2sReady) {
-        return;
+// Следующий блок WAV (стерео int16) в out; 0 - поток закончился или прерван
+static uint16_t renderWavChunk(WavStreamState& wav, int16_t* out) {
+    if (!wav.active || !wav.file || wav.dataBytesRemaining == 0) {
+        return 0;
     }
 
-    static int16_t interleaved[AUDIO_CHUNK_SAMPLES * 2];
     static int16_t monoBuffer[AUDIO_CHUNK_SAMPLES];
 
     uint16_t frames = AUDIO_CHUNK_SAMPLES;
@@ -804,7 +849,7 @@ static void feedWavStreamChunk(WavStreamState& wav) {
         g_audioPlaybackActive = false;
         resetWavStreamState(wav);
         Serial.print("\n[AUDIO] Playback finished");
-        return;
+        return 0;
     }
 
     size_t payloadBytes = 0;
@@ -821,20 +866,20 @@ static void feedWavStreamChunk(WavStreamState& wav) {
             resetWavStreamState(wav);
             Serial.print("\n[AUDIO] WAV stream read reached EOF unexpectedly");
             Serial.print("\n[AUDIO] Playback finished");
-            return;
+            return 0;
         }
 
         const uint16_t framesRead = static_cast<uint16_t>(readBytes / sizeof(int16_t));
         for (uint16_t i = 0; i < framesRead; ++i) {
             const int16_t s = monoBuffer[i];
-            interleaved[2 * i] = s;
-            interleaved[2 * i + 1] = s;
+            out[2 * i] = s;
+            out[2 * i + 1] = s;
         }
         frames = framesRead;
         payloadBytes = static_cast<size_t>(frames) * sizeof(int16_t);
     } else {
         payloadBytes = static_cast<size_t>(frames) * 2 * sizeof(int16_t);
-        const size_t readBytes = wav.file.read(reinterpret_cast<uint8_t*>(interleaved), payloadBytes);
+        const size_t readBytes = wav.file.read(reinterpret_cast<uint8_t*>(out), payloadBytes);
         if (readBytes == 0) {
             if (wav.isSdStream) {
                 invalidateSdMount("read error while streaming (stereo)");
@@ -844,7 +889,7 @@ static void feedWavStreamChunk(WavStreamState& wav) {
             resetWavStreamState(wav);
             Serial.print("\n[AUDIO] WAV stream read reached EOF unexpectedly");
             Serial.print("\n[AUDIO] Playback finished");
-            return;
+            return 0;
         }
         frames = static_cast<uint16_t>(readBytes / (2 * sizeof(int16_t)));
         payloadBytes = static_cast<size_t>(frames) * 2 * sizeof(int16_t);
@@ -855,48 +900,17 @@ static void feedWavStreamChunk(WavStreamState& wav) {
         g_audioPlaybackActive = false;
         resetWavStreamState(wav);
         Serial.print("\n[AUDIO] Playback finished");
-        return;
+        return 0;
     }
 
-    applyVolumeToInterleavedBuffer(interleaved, static_cast<size_t>(frames) * 2U, wav.volumePercent);
-
-    const size_t bytesToWrite = static_cast<size_t>(frames) * 2 * sizeof(int16_t);
-    size_t totalWritten = 0;
-    const uint8_t* outPtr = reinterpret_cast<const uint8_t*>(interleaved);
-    const unsigned long writeDeadline = millis() + 40UL;
+    applyGainToInterleavedBuffer(out, static_cast<size_t>(frames) * 2U, wav.gainQ15);
 
-    while (totalWritten < bytesToWrite) {
-        size_t chunkWritten = 0;
-        i2s_write(AUDIO_I2S_PORT,
-                  outPtr + totalWritten,
-                  bytesToWrite - totalWritten,
-                  &chunkWritten,
-                  pdMS_TO_TICKS(5));
-
-        totalWritten += chunkWritten;
-
-        if (chunkWritten == 0) {
-            if (millis() >= writeDeadline) {
-                break;
-            }
-            vTaskDelay(pdMS_TO_TICKS(1));
-        }
-    }
-
-    // ВАЖНО: из файла уже считан payloadBytes, поэтому счётчик оставшихся данных
-    // должен уменьшаться именно на объём прочитанного файла, а не на bytesWritten в I2S.
-    // Иначе при частичных i2s_write возникает ложный "interrupted before data chunk end".
-    const size_t consumedBytes = payloadBytes;
-    if (consumedBytes >= wav.dataBytesRemaining) {
+    // Счётчик оставшихся данных уменьшается на объём, прочитанный из файла:
+    // запись в I2S может завершиться позже (хвост частичной записи).
+    if (payloadBytes >= wav.dataBytesRemaining) {
         wav.dataBytesRemaining = 0;
     } else {
-        wav.dataBytesRemaining -= consumedBytes;
-    }
-
-    if (totalWritten < bytesToWrite) {
-        Serial.printf("\n[AUDIO] WARN: I2S partial write %lu/%lu bytes",
-                      static_cast<unsigned long>(totalWritten),
-                      static_cast<unsigned long>(bytesToWrite));
+        wav.dataBytesRemaining -= payloadBytes;
     }
 
     if (wav.dataBytesRemaining == 0) {
@@ -904,7 +918,7 @@ static void feedWavStreamChunk(WavStreamState& wav) {
         g_audioPlaybackActive = false;
         Serial.print("\n[AUDIO] Playback finished");
         resetWavStreamState(wav);
-        return;
+        return frames;
     }
 
     if (!wav.file.available()) {
@@ -917,6 +931,78 @@ static void feedWavStreamChunk(WavStreamState& wav) {
         Serial.println("\n[AUDIO] Playback finished");
         resetWavStreamState(wav);
     }
+    return frames;
+}
+
+// Дописывает ожидающий блок; false - кольцо DMA занято, остаток ждёт следующего буфера
+static bool flushPendingChunk() {
+    size_t written = 0;
+    writeI2S(reinterpret_cast<const uint8_t*>(g_pcmChunk) + g_pcmOffset,
+             g_pcmBytes - g_pcmOffset, &written, pdMS_TO_TICKS(AUDIO_WRITE_TIMEOUT_MS));
+    g_pcmOffset += written;
+    if (g_pcmOffset < g_pcmBytes) {
+        g_statPartialWrites = g_statPartialWrites + 1;
+        return false;
+    }
+
+    g_pcmBytes = 0;
+    g_pcmOffset = 0;
+    g_dmaQueued++;
+    g_statRefills = g_statRefills + 1;
+    return true;
+}
+
+// Доливает кольцо до AUDIO_DMA_QUEUE_TARGET буферов и спит до отправки следующего
+static void pumpAudioPipeline(ToneState& tone, WavStreamState& wav) {
+    if (g_dmaQueued == 0 && g_dmaLeadBuffers == 0 && g_pcmOffset == 0) {
+        // Наших буферов в кольце нет, DMA шлёт нули. Накопленные отметки - это они;
+        // первый наш буфер драйвер отдаст сразу за буфером, который сейчас в передаче.
+        const uint32_t idle = waitI2SBuffersSent(0);
+        if (g_dmaPrimed && g_audioPlaybackActive) {
+            g_statUnderruns = g_statUnderruns + idle;
+        }
+        g_dmaLeadBuffers = 1;
+    }
+
+    while (g_dmaQueued < AUDIO_DMA_QUEUE_TARGET) {
+        if (g_pcmBytes == 0) {
+            uint16_t frames = 0;
+            if (wav.active) {
+                frames = renderWavChunk(wav, g_pcmChunk);
+            } else if (tone.active) {
+                frames = renderToneChunk(tone, g_pcmChunk);
+            }
+            if (frames == 0) {
+                break;
+            }
+            g_pcmBytes = static_cast<size_t>(frames) * 2 * sizeof(int16_t);
+            g_pcmOffset = 0;
+        }
+        if (!flushPendingChunk()) {
+            break;
+        }
+    }
+
+    uint32_t sent = waitI2SBuffersSent(pdMS_TO_TICKS(AUDIO_REFILL_WAIT_MS));
+    g_statWakeups = g_statWakeups + 1;
+
+    // Первыми уходят нули, стоявшие впереди нашего первого буфера - это не недолив
+    const uint8_t lead = (sent < g_dmaLeadBuffers) ? static_cast<uint8_t>(sent) : g_dmaLeadBuffers;
+    g_dmaLeadBuffers -= lead;
+    sent -= lead;
+    if (sent > 0 && g_dmaQueued > 0) {
+        g_dmaPrimed = true;
+    }
+
+    if (sent > g_dmaQueued) {
+        // DMA опустошил кольцо раньше долива - в выход ушли нули (auto clear)
+        if (g_dmaPrimed && g_audioPlaybackActive) {
+            g_statUnderruns = g_statUnderruns + (sent - g_dmaQueued);
+        }
+        g_dmaQueued = 0;
+    } else {
+        g_dmaQueued -= static_cast<uint8_t>(sent);
+    }
 }
 
 static void audioTaskEntry(void* /*param*/) {
@@ -948,6 +1034,7 @@ static void audioTaskEntry(void* /*param*/) {
             tone.active = false;
             resetWavStreamState(wav);
             g_audioPlaybackActive = false;
+            dropPendingChunk();
             vTaskDelay(pdMS_TO_TICKS(150));
             continue;
         }
@@ -957,9 +1044,8 @@ static void audioTaskEntry(void* /*param*/) {
             tone.active = false;
             resetWavStreamState(wav);
             g_audioPlaybackActive = false;
-            if (g_i2sReady) {
-                i2s_zero_dma_buffer(AUDIO_I2S_PORT);
-            }
+            dropPendingChunk();
+            clearI2SOutput();
             vTaskDelay(pdMS_TO_TICKS(50));
             continue;
         }
@@ -969,13 +1055,12 @@ static void audioTaskEntry(void* /*param*/) {
             continue;
         }
 
-        if (wav.active) {
-            feedWavStreamChunk(wav);
-            vTaskDelay(pdMS_TO_TICKS(1));
-        } else if (tone.active) {
-            feedToneChunk(tone);
-            vTaskDelay(pdMS_TO_TICKS(1));
+        if (wav.active || tone.active || g_pcmBytes > 0) {
+            pumpAudioPipeline(tone, wav);
         } else {
+            // Тишина: старые отметки DMA не должны попасть в счёт следующего воспроизведения
+            dropPendingChunk();
+            discardI2SSentEvents();
             vTaskDelay(pdMS_TO_TICKS(15));
         }
     }
@@ -1030,8 +1115,10 @@ void audioTaskStop() {
 
     vTaskDelete(g_audioTaskHandle);
     g_audioTaskHandle = nullptr;
+    g_audioPlaybackActive = false;
     g_audioTaskRunning = false;
     stopI2S();
+    dropPendingChunk();
 
     if (g_audioQueue != nullptr) {
         vQueueDelete(g_audioQueue);
@@ -1282,3 +1369,70 @@ AudioTestSource audioGetLastTestSource() {
 const char* audioTestSourceName(AudioTestSource source) {
     return sourceName(source);
 }
+
+// audio bench: такты на отсчёт у регулятора громкости - деление на 100 против Q15
+void audioRunGainBenchmark() {
+    static constexpr size_t BENCH_SAMPLES = AUDIO_CHUNK_SAMPLES * 2;
+    static constexpr uint16_t BENCH_ROUNDS = 200;
+    static constexpr uint8_t BENCH_VOLUME = 70;
+    static int16_t source[BENCH_SAMPLES];
+    static int16_t work[BENCH_SAMPLES];
+    static int16_t expected[BENCH_SAMPLES];
+
+    uint32_t seed = 0x1234567U;
+    for (size_t i = 0; i < BENCH_SAMPLES; ++i) {
+        seed = seed * 1664525U + 1013904223U;
+        source[i] = static_cast<int16_t>(seed >> 16);
+    }
+    source[0] = INT16_MIN;  // Крайние значения - проверка отсутствия переполнения
+    source[1] = INT16_MAX;
+
+    const uint16_t gainQ15 = volumePercentToGainQ15(BENCH_VOLUME);
+    uint32_t divideCycles = 0;
+    uint32_t q15Cycles = 0;
+    for (uint16_t round = 0; round < BENCH_ROUNDS; ++round) {
+        memcpy(expected, source, sizeof(source));
+        uint32_t start = ESP.getCycleCount();
+        applyVolumePercentReference(expected, BENCH_SAMPLES, BENCH_VOLUME);
+        divideCycles += ESP.getCycleCount() - start;
+
+        memcpy(work, source, sizeof(source));
+        start = ESP.getCycleCount();
+        applyGainToInterleavedBuffer(work, BENCH_SAMPLES, gainQ15);
+        q15Cycles += ESP.getCycleCount() - start;
+    }
+
+    // Q15 округляет, деление отбрасывает дробь: допустимо расхождение до 1 LSB
+    int32_t maxDiff = 0;
+    for (size_t i = 0; i < BENCH_SAMPLES; ++i) {
+        int32_t diff = static_cast<int32_t>(work[i]) - expected[i];
+        if (diff < 0) diff = -diff;
+        if (diff > maxDiff) maxDiff = diff;
+    }
+
+    const uint32_t totalSamples = static_cast<uint32_t>(BENCH_SAMPLES) * BENCH_ROUNDS;
+    Serial.printf("\n[AUDIO] Громкость %u%%, %u отсчётов x %u прогонов",
+                  BENCH_VOLUME, static_cast<unsigned>(BENCH_SAMPLES), BENCH_ROUNDS);
+    Serial.printf("\n[AUDIO]   деление на 100: %lu.%02lu такта/отсчёт",
+                  static_cast<unsigned long>(divideCycles / totalSamples),
+                  static_cast<unsigned long>((divideCycles % totalSamples) * 100U / totalSamples));
+    Serial.printf("\n[AUDIO]   Q15:            %lu.%02lu такта/отсчёт",
+                  static_cast<unsigned long>(q15Cycles / totalSamples),
+                  static_cast<unsigned long>((q15Cycles % totalSamples) * 100U / totalSamples));
+    Serial.printf("\n[AUDIO]   макс. расхождение: %ld LSB", static_cast<long>(maxDiff));
+}
+
+void audioPrintPipelineStats() {
+    Serial.printf("\n[AUDIO] DMA: %u буферов x %u кадров", AUDIO_DMA_BUFFERS, AUDIO_CHUNK_SAMPLES);
+    Serial.printf("\n[AUDIO]   доливов: %lu, пробуждений: %lu",
+                  static_cast<unsigned long>(g_statRefills), static_cast<unsigned long>(g_statWakeups));
+    Serial.printf("\n[AUDIO]   опустошений кольца: %lu, частичных записей: %lu",
+                  static_cast<unsigned long>(g_statUnderruns), static_cast<unsigned long>(g_statPartialWrites));
+}
+
+void audioResetPipelineStats() {
+    g_statRefills = 0;
+    g_statWakeups = 0;
+    g_statUnderruns = 0;
+    g_statPartialWrites = 0;
+}
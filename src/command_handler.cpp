@@ -9,6 +9,7 @@
 #include "ota_manager.h"
 #include "audio_task.h"
 #include "runtime_counter.h"
+#include "display/nixie_6_spi.h"
 #include <esp_system.h>
 
 // Объявляем внешние переменные
@@ -18,6 +19,72 @@ extern HardwareSource currentTimeSource;
 extern bool ds3231_available;
 extern void processSecondTick();
 extern void runAntiPoisonNow();
+extern void runDisplayBenchNow(uint16_t ticks);
+
+static void printDisplayBusStats() {
+    const Nixie6BusStats st = nixie6GetBusStats();
+    const uint32_t windowMs = millis() - st.sinceMs;
+    const float skippedPct = (st.pushes > 0) ? (100.0f * st.skippedPushes / st.pushes) : 0.0f;
+    const float dutyPct = (windowMs > 0)
+        ? static_cast<float>(static_cast<double>(st.busTimeUs) / (static_cast<double>(windowMs) * 10.0))
+        : 0.0f;
+
+    Serial.println("\n=== Шина индикации (74HC595) ===");
+    Serial.printf("Окно учёта: %lu с\n", static_cast<unsigned long>(windowMs / 1000UL));
+    Serial.printf("Запросов вывода: %lu, пропущено (кадр не изменился): %lu (%.1f%%)\n",
+                  static_cast<unsigned long>(st.pushes),
+                  static_cast<unsigned long>(st.skippedPushes),
+                  skippedPct);
+    Serial.printf("Импульсов LATCH: %lu, DMA-последовательностей: %lu (опустошений кольца: %lu)\n",
+                  static_cast<unsigned long>(st.latches),
+                  static_cast<unsigned long>(st.dmaSequences),
+                  static_cast<unsigned long>(st.dmaUnderruns));
+    Serial.printf("Байт на шине: %llu, занятость: %llu мкс (%.3f%%)\n",
+                  static_cast<unsigned long long>(st.busBytes),
+                  static_cast<unsigned long long>(st.busTimeUs),
+                  dutyPct);
+}
+
+static void printLatencyStage(const char* label, const Nixie6LatencyStage& stage) {
+    if (stage.samples == 0) {
+        Serial.printf("%s: нет данных\n", label);
+        return;
+    }
+    Serial.printf("%s: min %.2f / avg %.2f / max %.2f мс (%lu замеров)\n",
+                  label,
+                  stage.minUs / 1000.0f,
+                  static_cast<float>(static_cast<double>(stage.totalUs) / stage.samples / 1000.0),
+                  stage.maxUs / 1000.0f,
+                  static_cast<unsigned long>(stage.samples));
+}
+
+static void printDisplayLatency() {
+    static const char* const kBucketLabels[NIXIE6_LATENCY_BUCKETS] = {
+        "   <1", "  1-2", "  2-5", " 5-10", "10-20", "20-50", "50-100", "100-200", " >200"
+    };
+    const Nixie6LatencyStats st = nixie6GetLatencyStats();
+
+    Serial.println("\n=== Задержка SQW -> LATCH (Nixie 6) ===");
+    Serial.printf("Окно учёта: %lu с\n", static_cast<unsigned long>((millis() - st.sinceMs) / 1000UL));
+    printLatencyStage("SQW -> тик", st.sqwToTick);
+    printLatencyStage("Тик -> LATCH", st.tickToLatch);
+    printLatencyStage("SQW -> LATCH", st.sqwToLatch);
+    Serial.printf("Тиков без смены кадра: %lu, момент защёлки DMA рассчитан: %lu\n",
+                  static_cast<unsigned long>(st.ticksWithoutLatch),
+                  static_cast<unsigned long>(st.dmaEstimated));
+
+    uint32_t peak = 0;
+    for (uint8_t i = 0; i < NIXIE6_LATENCY_BUCKETS; ++i) {
+        peak = (st.histogram[i] > peak) ? st.histogram[i] : peak;
+    }
+    Serial.println("Гистограмма SQW -> LATCH, мс:");
+    for (uint8_t i = 0; i < NIXIE6_LATENCY_BUCKETS; ++i) {
+        const uint8_t bar = (peak > 0) ? static_cast<uint8_t>((st.histogram[i] * 30UL) / peak) : 0;
+        Serial.printf("  %7s | %-30.*s %lu\n",
+                      kBucketLabels[i], bar, "##############################",
+                      static_cast<unsigned long>(st.histogram[i]));
+    }
+}
 
 void handleCommand(String command) {
     command.trim();
@@ -77,6 +144,45 @@ void handleCommand(String command) {
         runAntiPoisonNow();
         return;
     }
+    if (lowerCommand == "disp stat") {
+        printDisplayBusStats();
+        return;
+    }
+    if (lowerCommand == "disp stat reset") {
+        nixie6ResetBusStats();
+        Serial.println("\n[DISP] Счётчики шины сброшены");
+        return;
+    }
+    if (lowerCommand == "disp lat") {
+        printDisplayLatency();
+        return;
+    }
+    if (lowerCommand == "disp lat reset") {
+        nixie6ResetLatencyStats();
+        Serial.println("\n[DISP] Замер задержки SQW -> LATCH сброшен");
+        return;
+    }
+    if (lowerCommand == "disp bench" || lowerCommand.startsWith("disp bench ")) {
+        // disp bench [N]: N секундных тиков подряд (по умолчанию 20, максимум 120)
+        long ticks = (lowerCommand.length() > 10) ? lowerCommand.substring(11).toInt() : 20;
+        if (ticks <= 0) ticks = 20;
+        if (ticks > 120) ticks = 120;
+        runDisplayBenchNow(static_cast<uint16_t>(ticks));
+        return;
+    }
+    if (lowerCommand == "audio bench") {
+        audioRunGainBenchmark();
+        return;
+    }
+    if (lowerCommand == "audio stat") {
+        audioPrintPipelineStats();
+        return;
+    }
+    if (lowerCommand == "audio stat reset") {
+        audioResetPipelineStats();
+        Serial.println("\n[AUDIO] Счётчики конвейера DMA сброшены");
+        return;
+    }
 
     // Дублируем команду в BLE, если он включен
     if (bleTerminalIsEnabled() && command.length() > 0) {
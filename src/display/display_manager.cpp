@@ -2,9 +2,19 @@
 #include "display/nixie_6_spi.h"
 #include "hardware.h"
 #include "platform_profile.h"
+#include <cstdlib>
 #include <cstring>
+#include <esp_timer.h>
 
 namespace {
+constexpr uint32_t BRIGHTNESS_UPDATE_PERIOD_MS = 1000;
+constexpr uint8_t BRIGHTNESS_MIN_LEVEL = 16;  // ночной минимум: цифры должны оставаться читаемыми
+
+// disp bench: каждый N-й тик — переход pressure -> time перед сменой секунды
+constexpr uint16_t LATCH_BENCH_VIEW_SWITCH_EVERY = 10;
+constexpr uint32_t LATCH_BENCH_SETTLE_TIMEOUT_MS = 1000;
+constexpr uint8_t LATCH_BENCH_PRINT_RUNS = 8;
+
 class VirtualDisplayDriver : public DisplayDriver {
 public:
     explicit VirtualDisplayDriver(uint8_t statusBase = 0x10) : statusBase_(statusBase) {}
@@ -282,6 +292,48 @@ void DisplayManager::setBrightness(uint8_t level) {
     }
 }
 
+void DisplayManager::serviceBrightness(uint32_t nowMs) {
+    if (!driver_) {
+        return;
+    }
+
+    if (nextBrightnessUpdateMs_ != 0 && static_cast<int32_t>(nowMs - nextBrightnessUpdateMs_) < 0) {
+        return;
+    }
+    nextBrightnessUpdateMs_ = nowMs + BRIGHTNESS_UPDATE_PERIOD_MS;
+
+    uint8_t target = 255;
+    if (config.brightness_control_enabled && config.brightness_sensor_max > config.brightness_sensor_min) {
+        uint16_t sensor = readLightSensorFiltered(config.light_filter_samples, config.light_sensor_resolution_bits);
+        if (sensor < config.brightness_sensor_min) sensor = config.brightness_sensor_min;
+        if (sensor > config.brightness_sensor_max) sensor = config.brightness_sensor_max;
+
+        const uint32_t span = config.brightness_sensor_max - config.brightness_sensor_min;
+        const uint32_t pos = sensor - config.brightness_sensor_min;
+        target = static_cast<uint8_t>(BRIGHTNESS_MIN_LEVEL + (pos * (255U - BRIGHTNESS_MIN_LEVEL)) / span);
+    }
+
+    // Плавное приближение к цели (~1/4 разницы за период), без скачков яркости.
+    int16_t level = brightnessLevel_;
+    const int16_t diff = static_cast<int16_t>(target) - level;
+    if (diff != 0) {
+        int16_t step = diff / 4;
+        if (step == 0) {
+            step = (diff > 0) ? 1 : -1;
+        }
+        level = static_cast<int16_t>(level + step);
+    }
+
+    if (static_cast<uint8_t>(level) != brightnessLevel_) {
+        brightnessLevel_ = static_cast<uint8_t>(level);
+        setBrightness(brightnessLevel_);
+    }
+}
+
+uint8_t DisplayManager::brightnessLevel() const {
+    return brightnessLevel_;
+}
+
 void DisplayManager::showTime(uint8_t hours, uint8_t minutes, uint8_t seconds, bool showColon) {
     if (driver_) {
         driver_->showTime(hours, minutes, seconds, showColon);
@@ -346,6 +398,14 @@ void DisplayManager::updateFromLocalTime(const tm& localTm, uint32_t nowMs,
     (void)alarm2Minute;
 }
 
+void DisplayManager::markSecondTick(uint32_t sqwEdgeUs, uint32_t tickStartUs) {
+    if (!driver_ || !isNixie6_) {
+        return;
+    }
+
+    nixie6MarkSecondTick(sqwEdgeUs, tickStartUs);
+}
+
 void DisplayManager::serviceAnimations(uint32_t nowMs) {
     if (!driver_ || !isNixie6_) {
         return;
@@ -373,6 +433,15 @@ bool DisplayManager::hasActiveAnimation() const {
     return d->isTransitionActive();
 }
 
+uint32_t DisplayManager::animationServiceIntervalMs(uint32_t nowMs) const {
+    if (!driver_ || !isNixie6_) {
+        return 0;
+    }
+
+    const auto* d = static_cast<const Nixie6SpiDriver*>(driver_);
+    return d->transitionServiceIntervalMs(nowMs);
+}
+
 bool DisplayManager::isNixieClockType() const {
     return (activeBackend_ == ActiveBackend::Nixie6 ||
             activeBackend_ == ActiveBackend::NixieGeneric ||
@@ -603,3 +672,166 @@ const char* DisplayManager::activeViewName() const {
 
     return "time";
 }
+
+bool DisplayManager::runLatchBench(time_t localStart, uint16_t ticks) {
+    if (!driver_ || !isNixie6_ || ticks == 0) {
+        return false;
+    }
+
+    auto* records = static_cast<Nixie6LatchRecord*>(
+        malloc(NIXIE6_LATCH_TRACE_CAPACITY * sizeof(Nixie6LatchRecord)));
+    if (records == nullptr || !nixie6StartLatchTrace()) {
+        free(records);
+        return false;
+    }
+
+    // Дождаться, пока disp_refresh/DMA/таймер слотов доведут переход до конечного кадра.
+    auto settle = [this]() {
+        const uint32_t startMs = millis();
+        while (hasActiveAnimation() && millis() - startMs < LATCH_BENCH_SETTLE_TIMEOUT_MS) {
+            vTaskDelay(pdMS_TO_TICKS(2));
+        }
+        vTaskDelay(pdMS_TO_TICKS(nixie6GetTransitionHoldMs() + 5));
+    };
+
+    Serial.printf("\n[DISP][BENCH] %u тиков, переход %s %u мс, gamma %.2f, hold %u мс",
+                  static_cast<unsigned>(ticks),
+                  nixie6IsSoftTransitionEnabled() ? "ON" : "OFF",
+                  static_cast<unsigned>(nixie6GetTransitionDurationMs()),
+                  nixie6GetTransitionGamma(),
+                  static_cast<unsigned>(nixie6GetTransitionHoldMs()));
+
+    uint32_t framesTotal = 0;
+    uint16_t framesMax = 0;
+    uint64_t frameCpuTotalUs = 0;
+    uint16_t frameCpuMaxUs = 0;
+    uint64_t updateCpuTotalUs = 0;
+    uint32_t updateCpuMaxUs = 0;
+    uint32_t wrongFinal = 0;
+    uint32_t foreignFrames = 0;
+    uint32_t doubleLatches = 0;
+    uint32_t redundantPushes = 0;
+    uint32_t droppedTotal = 0;
+    const uint32_t underrunsBefore = nixie6GetBusStats().dmaUnderruns;
+
+    tm prevTm{};
+    gmtime_r(&localStart, &prevTm);
+    updateFromLocalTime(prevTm, millis(),
+                        config.alarm1.hour, config.alarm1.minute,
+                        config.alarm2.hour, config.alarm2.minute);
+    settle();
+
+    for (uint16_t i = 0; i < ticks; ++i) {
+        const time_t localNow = localStart + 1 + i;
+        tm t{};
+        gmtime_r(&localNow, &t);
+        char prevDigits[8];
+        char expected[8];
+        snprintf(prevDigits, sizeof(prevDigits), "%02d%02d%02d", prevTm.tm_hour, prevTm.tm_min, prevTm.tm_sec);
+        snprintf(expected, sizeof(expected), "%02d%02d%02d", t.tm_hour, t.tm_min, t.tm_sec);
+
+        (void)nixie6TakeLatchTrace(nullptr, 0, nullptr);
+        const uint32_t skippedBefore = nixie6GetBusStats().skippedPushes;
+
+        const bool viewSwitch = (i % LATCH_BENCH_VIEW_SWITCH_EVERY) == (LATCH_BENCH_VIEW_SWITCH_EVERY - 1);
+        if (viewSwitch) {
+            handleAction(DisplayAction::NextAuxView);
+            settle();
+            handleAction(DisplayAction::NextMainView);
+        }
+
+        const int64_t updateStartUs = esp_timer_get_time();
+        updateFromLocalTime(t, millis(),
+                            config.alarm1.hour, config.alarm1.minute,
+                            config.alarm2.hour, config.alarm2.minute);
+        const uint32_t updateUs = static_cast<uint32_t>(esp_timer_get_time() - updateStartUs);
+        settle();
+
+        uint16_t dropped = 0;
+        const uint16_t n = nixie6TakeLatchTrace(records, NIXIE6_LATCH_TRACE_CAPACITY, &dropped);
+        redundantPushes += nixie6GetBusStats().skippedPushes - skippedBefore;
+        droppedTotal += dropped;
+        framesTotal += n;
+        framesMax = (n > framesMax) ? n : framesMax;
+        updateCpuTotalUs += updateUs;
+        updateCpuMaxUs = (updateUs > updateCpuMaxUs) ? updateUs : updateCpuMaxUs;
+
+        // Последовательность кадров тика сворачивается в серии "разряды x количество".
+        String sequence;
+        char digits[8] = "";
+        char runDigits[8] = "";
+        uint16_t runLength = 0;
+        uint8_t runsPrinted = 0;
+        bool dmaTick = false;
+        for (uint16_t k = 0; k < n; ++k) {
+            const Nixie6LatchRecord& r = records[k];
+            nixie6DecodeWire(r.wire, digits, nullptr);
+            dmaTick = dmaTick || r.dma;
+            frameCpuTotalUs += r.cpuUs;
+            frameCpuMaxUs = (r.cpuUs > frameCpuMaxUs) ? r.cpuUs : frameCpuMaxUs;
+
+            if (!viewSwitch && strcmp(digits, prevDigits) != 0 && strcmp(digits, expected) != 0) {
+                ++foreignFrames;
+            }
+            // Одинаковые DMA-транзакции подряд допустимы (серия длиннее DMA_MAX_RUN_SLOTS),
+            // одинаковые прямые защёлки — нет: кэш кадра должен был их отсечь.
+            if (k > 0 && !r.dma && !records[k - 1].dma && memcmp(r.wire, records[k - 1].wire, 4) == 0) {
+                ++doubleLatches;
+            }
+
+            if (runLength > 0 && strcmp(digits, runDigits) == 0) {
+                ++runLength;
+                continue;
+            }
+            if (runLength > 0 && runsPrinted < LATCH_BENCH_PRINT_RUNS) {
+                sequence += String(runDigits) + "x" + String(runLength) + " ";
+                ++runsPrinted;
+            }
+            memcpy(runDigits, digits, sizeof(runDigits));
+            runLength = 1;
+        }
+        if (runLength > 0) {
+            if (runsPrinted >= LATCH_BENCH_PRINT_RUNS) {
+                sequence += "... ";
+            }
+            sequence += String(runDigits) + "x" + String(runLength);
+        }
+        if (n == 0 || strcmp(digits, expected) != 0) {
+            ++wrongFinal;
+        }
+
+        Serial.printf("\n[DISP][BENCH] %c%c:%c%c:%c%c%s кадров %u%s, update %lu мкс: %s%s",
+                      expected[0], expected[1], expected[2], expected[3], expected[4], expected[5],
+                      viewSwitch ? " (экран)" : "",
+                      static_cast<unsigned>(n),
+                      dmaTick ? " DMA" : "",
+                      static_cast<unsigned long>(updateUs),
+                      (n > 0) ? sequence.c_str() : "-",
+                      (n > 0 && strcmp(digits, expected) != 0) ? "  <- НЕВЕРНЫЙ КАДР" : "");
+        prevTm = t;
+    }
+
+    nixie6StopLatchTrace();
+    free(records);
+
+    Serial.println("\n=== disp bench: итог ===");
+    Serial.printf("Кадров на тик: среднее %.1f, максимум %u\n",
+                  static_cast<float>(framesTotal) / ticks, static_cast<unsigned>(framesMax));
+    Serial.printf("CPU на кадр: среднее %.1f мкс, максимум %u мкс\n",
+                  (framesTotal > 0) ? static_cast<float>(frameCpuTotalUs) / framesTotal : 0.0f,
+                  static_cast<unsigned>(frameCpuMaxUs));
+    Serial.printf("CPU на update тика: среднее %.1f мкс, максимум %lu мкс\n",
+                  static_cast<float>(updateCpuTotalUs) / ticks,
+                  static_cast<unsigned long>(updateCpuMaxUs));
+    Serial.printf("Неверный итоговый кадр: %lu, чужих кадров в переходе: %lu\n",
+                  static_cast<unsigned long>(wrongFinal),
+                  static_cast<unsigned long>(foreignFrames));
+    Serial.printf("Двойных защёлок: %lu, повторов кадра (отсечены кэшем): %lu, опустошений кольца DMA: %lu\n",
+                  static_cast<unsigned long>(doubleLatches),
+                  static_cast<unsigned long>(redundantPushes),
+                  static_cast<unsigned long>(nixie6GetBusStats().dmaUnderruns - underrunsBefore));
+    if (droppedTotal > 0) {
+        Serial.printf("Не вошло в трассу: %lu кадров\n", static_cast<unsigned long>(droppedTotal));
+    }
+    return true;
+}
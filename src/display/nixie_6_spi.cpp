@@ -1,15 +1,34 @@
 #include "display/nixie_6_spi.h"
 #include "config.h"
+#include "hardware.h"
 #include <SPI.h>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <driver/spi_master.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
+#include <freertos/task.h>
 
 namespace {
 constexpr uint16_t DATA_SETUP_US = 1;
 constexpr uint16_t SCK_HIGH_US = 1;
 constexpr uint16_t LATCH_PULSE_US = 1;
-constexpr uint16_t TRANSITION_SLOT_US = 500;  // 2 кГц мигания при смешивании кадров
-constexpr uint8_t TRANSITION_SLOTS = 10;
+constexpr uint16_t TRANSITION_SLOT_US = 400;  // 2.5 кГц слотов = 8 периодов PWM на OE
+constexpr uint16_t TRANSITION_MIN_DURATION_MS = 40;
+constexpr uint16_t TRANSITION_MAX_DURATION_MS = 500;
+constexpr uint16_t TRANSITION_MAX_HOLD_MS = 100;
+constexpr float TRANSITION_MIN_GAMMA = 1.0f;
+constexpr float TRANSITION_MAX_GAMMA = 3.0f;
+
+// Смешивание old/new (DISPLAY_PWM_TRANSITION_PLAN.md, п.3): доля нового кадра g(p) = p^gamma,
+// слоты распределяются sigma-delta аккумулятором первого порядка (без окон и биений).
+// g(p) хранится таблицей в Q16 с линейной интерполяцией: решение на слот = O(1), без float.
+constexpr uint8_t GAMMA_LUT_SEGMENTS = 64;
+constexpr uint32_t SIGMA_DELTA_ONE = 1UL << 16;
 
 // Назначение битов служебного байта (MSB -> LSB):
 // b7: Reserve
@@ -41,6 +60,31 @@ constexpr uint8_t STATUS_ALL_DEFINED_BITS =
 constexpr bool USE_HARDWARE_SPI = true;
 constexpr uint32_t DISPLAY_SPI_HZ = 15000000;  // 15 МГц
 
+// DMA-движок soft-transition (HSPI = SPI3_HOST на ESP32-S3):
+// вся последовательность слотов old/new заранее раскладывается в очередь транзакций,
+// LATCH подключён как CS устройства (фронт 0->1 в конце транзакции защёлкивает кадр).
+// Длительность показа кадра задаётся длиной следующей транзакции (нулевые байты-заполнители
+// "проталкиваются" через регистр, на выходах остаются только последние 32 бита).
+// Ограничение: защёлки очереди не привязаны к фазе PWM на OE. Каждую следующую транзакцию
+// запускает ISR драйвера с задержкой в единицы мкс, и фаза LATCH относительно окна гашения
+// от защёлки к защёлке произвольна — в переходе возможен разрыв кадра внутри одного периода
+// PWM (50 мкс), на глаз не заметный. К окну гашения привязан только одиночный кадр.
+// false -> прежний режим: Arduino SPIClass + опрос serviceTransition() каждые 1 мс.
+constexpr bool USE_DMA_TRANSITION_ENGINE = true;
+constexpr spi_host_device_t DISPLAY_DMA_HOST = SPI3_HOST;
+constexpr uint32_t DISPLAY_DMA_SPI_HZ = 1600000;  // 80 МГц / 50: 80 байт = ровно 1 слот 400 мкс
+constexpr uint16_t DMA_SLOT_BYTES =
+    static_cast<uint16_t>((DISPLAY_DMA_SPI_HZ / 8UL) * TRANSITION_SLOT_US / 1000000UL);
+constexpr uint16_t DMA_MAX_RUN_SLOTS = 10;
+constexpr uint16_t DMA_RUN_BUFFER_BYTES = DMA_SLOT_BYTES * DMA_MAX_RUN_SLOTS;
+// При sigma-delta серии old/new короткие, поэтому последовательность не раскладывается
+// целиком: кольцо транзакций дозаполняется из drainDmaTransactions() по мере отработки.
+// 48 транзакций >= 48 слотов = 19.2 мс вперёд, задача дисплея просыпается на половине запаса.
+constexpr uint16_t DMA_RING_TRANSACTIONS = 48;
+
+static_assert(DMA_SLOT_BYTES >= 4 && (DMA_SLOT_BYTES % 4) == 0,
+              "DMA slot length must be word-aligned and hold a full 32-bit frame");
+
 // Временный диагностический флаг:
 // true  -> в режиме Alarm показывать реальные секунды вместо "пустых" нибблов 0xF/0xF.
 // false -> штатный режим (хвостовые нибблы alarm-экрана = 0xF/0xF).
@@ -48,24 +92,155 @@ constexpr bool DEBUG_KEEP_SECONDS_IN_ALARM_VIEW = false;
 
 bool g_softTransitionEnabled = true;
 uint16_t g_transitionDurationMs = 150;
+uint16_t g_transitionHoldMs = 30;
+float g_transitionGamma = 2.2f;
+
+// Таблица g(p) пишется под ScopedDisplayBusLock; переход копирует её при старте,
+// поэтому смена гаммы действует со следующего перехода, а не посреди текущего.
+uint32_t g_gammaLut[GAMMA_LUT_SEGMENTS + 1];
+bool g_gammaLutReady = false;
 
 SPIClass g_displaySpi(HSPI);
 bool g_displaySpiReady = false;
+
+spi_device_handle_t g_displayDmaDevice = nullptr;
+bool g_displayDmaReady = false;
+// [0] = старый кадр, [1] = новый кадр; кадр лежит в последних 4 байтах буфера.
+uint8_t* g_dmaRunBuffers[2] = {nullptr, nullptr};
+spi_transaction_t g_dmaTransactions[DMA_RING_TRANSACTIONS];
+
+// Последний защёлкнутый в 74HC595 кадр (байты шины): повтор того же кадра не идёт на шину.
+// OE/PWM регистры не сбрасывает, поэтому кэш остаётся верным и при гашении индикации.
+// Кэш и счётчики меняются только под ScopedDisplayBusLock.
+uint8_t g_lastLatchedWire[4] = {0, 0, 0, 0};
+bool g_lastLatchedValid = false;
+// Финальный кадр поставленной в DMA последовательности (станет "последним" после её завершения).
+uint8_t g_dmaFinalWire[4] = {0, 0, 0, 0};
+bool g_dmaFinalQueued = false;
+Nixie6BusStats g_busStats;
+
+// Трасса кадров (disp bench): буфер выделяется на время записи, пишется под ScopedDisplayBusLock.
+Nixie6LatchRecord* g_latchTrace = nullptr;
+uint16_t g_latchTraceCount = 0;
+uint16_t g_latchTraceDropped = 0;
+std::atomic<bool> g_latchTraceOn{false};
+
+inline int64_t latchTraceStartUs() {
+    return g_latchTraceOn.load(std::memory_order_relaxed) ? esp_timer_get_time() : 0;
+}
+
+void traceLatch(const uint8_t* tx, int64_t startUs, bool dma) {
+    if (!g_latchTraceOn.load(std::memory_order_relaxed) || g_latchTrace == nullptr) {
+        return;
+    }
+    if (g_latchTraceCount >= NIXIE6_LATCH_TRACE_CAPACITY) {
+        ++g_latchTraceDropped;
+        return;
+    }
+    const int64_t nowUs = esp_timer_get_time();
+    Nixie6LatchRecord& r = g_latchTrace[g_latchTraceCount++];
+    r.atUs = static_cast<uint32_t>(nowUs);
+    const int64_t cpuUs = nowUs - startUs;
+    r.cpuUs = static_cast<uint16_t>((cpuUs > UINT16_MAX) ? UINT16_MAX : cpuUs);
+    r.dma = dma;
+    memcpy(r.wire, tx, sizeof(r.wire));
+}
+
+// Замер SQW -> LATCH: тик "взводит" замер, первая реальная защёлка после него его закрывает.
+// Повтор старого кадра на шину не идёт (кэш), поэтому первая защёлка — это уже новый кадр.
+// Пишется под ScopedDisplayBusLock.
+constexpr uint32_t kLatencyBucketUpperUs[NIXIE6_LATENCY_BUCKETS - 1] = {
+    1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000
+};
+Nixie6LatencyStats g_latencyStats;
+bool g_latencyArmed = false;
+uint32_t g_latencySqwEdgeUs = 0;
+uint32_t g_latencyTickStartUs = 0;
+
+void addLatencySample(Nixie6LatencyStage& stage, uint32_t us) {
+    if (stage.samples == 0 || us < stage.minUs) stage.minUs = us;
+    if (us > stage.maxUs) stage.maxUs = us;
+    stage.totalUs += us;
+    ++stage.samples;
+}
+
+void closeLatencySample(uint32_t latchUs, bool dmaEstimated) {
+    if (!g_latencyArmed) {
+        return;
+    }
+    g_latencyArmed = false;
+    addLatencySample(g_latencyStats.tickToLatch, latchUs - g_latencyTickStartUs);
+    if (dmaEstimated) {
+        ++g_latencyStats.dmaEstimated;
+    }
+    if (g_latencySqwEdgeUs == 0) {
+        return;
+    }
+    const uint32_t totalUs = latchUs - g_latencySqwEdgeUs;
+    addLatencySample(g_latencyStats.sqwToLatch, totalUs);
+    uint8_t bucket = 0;
+    while (bucket < NIXIE6_LATENCY_BUCKETS - 1 && totalUs >= kLatencyBucketUpperUs[bucket]) {
+        ++bucket;
+    }
+    ++g_latencyStats.histogram[bucket];
+}
+
+inline uint32_t busTimeUs(uint32_t bytes, uint32_t hz) {
+    return static_cast<uint32_t>((static_cast<uint64_t>(bytes) * 8ULL * 1000000ULL) / hz);
+}
+
+inline void accountBusTransfer(uint32_t bytes, uint32_t latches, uint32_t timeUs) {
+    g_busStats.busBytes += bytes;
+    g_busStats.latches += latches;
+    g_busStats.busTimeUs += timeUs;
+}
+
+inline void rememberLatchedWire(const uint8_t* tx) {
+    memcpy(g_lastLatchedWire, tx, sizeof(g_lastLatchedWire));
+    g_lastLatchedValid = true;
+}
+
+// Синхронизация драйвера:
+// - писатели (loop/меню, sync-ветка disp_refresh) сериализуются обычным мьютексом без таймаута:
+//   вложенных захватов больше нет, кадр не может "потеряться" из-за таймаута;
+// - читатели (disp_refresh, диагностика) берут опубликованный снимок без блокировок;
+// - шина SPI/DMA защищена атомарным флагом: писатель ждёт его, а сервис слотов
+//   только пробует захватить и при неудаче пропускает слот, никогда не блокируясь.
 SemaphoreHandle_t g_nixieDriverMutex = nullptr;
+std::atomic<bool> g_displayBusBusy{false};
+constexpr uint16_t BUS_LOCK_SPINS_BEFORE_SLEEP = 64;
+
+struct LockCounters {
+    std::atomic<uint32_t> writerLocks{0};
+    std::atomic<uint32_t> writerContended{0};
+    std::atomic<uint32_t> busContended{0};
+    std::atomic<uint32_t> serviceBusSkips{0};
+    std::atomic<uint32_t> snapshotRetries{0};
+};
+LockCounters g_lockCounters;
 
-bool lockNixieDriver(uint32_t timeoutMs = 20) {
+inline void bumpCounter(std::atomic<uint32_t>& counter) {
+    counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool lockNixieDriver() {
     if (g_nixieDriverMutex == nullptr) {
-        g_nixieDriverMutex = xSemaphoreCreateRecursiveMutex();
+        g_nixieDriverMutex = xSemaphoreCreateMutex();
         if (g_nixieDriverMutex == nullptr) {
             return false;
         }
     }
-    return xSemaphoreTakeRecursive(g_nixieDriverMutex, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+    bumpCounter(g_lockCounters.writerLocks);
+    if (xSemaphoreTake(g_nixieDriverMutex, 0) == pdTRUE) {
+        return true;
+    }
+    bumpCounter(g_lockCounters.writerContended);
+    return xSemaphoreTake(g_nixieDriverMutex, portMAX_DELAY) == pdTRUE;
 }
 
 void unlockNixieDriver() {
     if (g_nixieDriverMutex != nullptr) {
-        xSemaphoreGiveRecursive(g_nixieDriverMutex);
+        xSemaphoreGive(g_nixieDriverMutex);
     }
 }
 
@@ -84,13 +259,286 @@ private:
     bool locked_ = false;
 };
 
-inline uint8_t reverseNibbleBits(uint8_t nibble) {
-    nibble &= 0x0F;
+bool tryLockDisplayBus() {
+    bool expected = false;
+    return g_displayBusBusy.compare_exchange_strong(expected, true, std::memory_order_acquire);
+}
+
+// wait = true  -> писатель: дожидается, пока сервис закончит текущий слот;
+// wait = false -> сервис слотов: одна попытка без ожидания.
+class ScopedDisplayBusLock {
+public:
+    explicit ScopedDisplayBusLock(bool wait) : locked_(tryLockDisplayBus()) {
+        if (locked_ || !wait) {
+            return;
+        }
+        bumpCounter(g_lockCounters.busContended);
+        uint16_t spins = 0;
+        while (!tryLockDisplayBus()) {
+            if (++spins < BUS_LOCK_SPINS_BEFORE_SLEEP) {
+                taskYIELD();
+            } else {
+                vTaskDelay(1);
+            }
+        }
+        locked_ = true;
+    }
+    ~ScopedDisplayBusLock() {
+        if (locked_) {
+            g_displayBusBusy.store(false, std::memory_order_release);
+        }
+    }
+
+    bool locked() const { return locked_; }
+
+private:
+    bool locked_ = false;
+};
+
+// --- Таблицы кодирования кадра в байты шины (считаются на этапе компиляции) ---
+constexpr uint8_t reverseNibbleBits(uint8_t nibble) {
     return static_cast<uint8_t>(((nibble & 0x1U) << 3) |
                                 ((nibble & 0x2U) << 1) |
                                 ((nibble & 0x4U) >> 1) |
                                 ((nibble & 0x8U) >> 3));
 }
+
+constexpr uint8_t reverseBitsInBothNibbles(uint8_t b) {
+    return static_cast<uint8_t>((reverseNibbleBits(static_cast<uint8_t>(b >> 4)) << 4) |
+                                reverseNibbleBits(static_cast<uint8_t>(b & 0x0FU)));
+}
+
+constexpr uint8_t bcdPair(uint8_t v) {
+    return static_cast<uint8_t>(((v / 10) << 4) | (v % 10));
+}
+
+// Пара разрядов в режиме REVERSE_INVERT: порядок (единицы, десятки), биты нибблов обращены.
+constexpr uint8_t reverseInvertPair(uint8_t v) {
+    return static_cast<uint8_t>((reverseNibbleBits(v % 10) << 4) | reverseNibbleBits(v / 10));
+}
+
+#define NIX6_T4(f, b) f(b), f(b + 1), f(b + 2), f(b + 3)
+#define NIX6_T16(f, b) NIX6_T4(f, b), NIX6_T4(f, b + 4), NIX6_T4(f, b + 8), NIX6_T4(f, b + 12)
+#define NIX6_T64(f, b) NIX6_T16(f, b), NIX6_T16(f, b + 16), NIX6_T16(f, b + 32), NIX6_T16(f, b + 48)
+#define NIX6_T10(f, b) NIX6_T4(f, b), NIX6_T4(f, b + 4), f(b + 8), f(b + 9)
+#define NIX6_T100(f) NIX6_T10(f, 0), NIX6_T10(f, 10), NIX6_T10(f, 20), NIX6_T10(f, 30), NIX6_T10(f, 40), \
+                     NIX6_T10(f, 50), NIX6_T10(f, 60), NIX6_T10(f, 70), NIX6_T10(f, 80), NIX6_T10(f, 90)
+
+// Байт кадра (2 ниббла: цифры, blank-коды 0xA..0xF или служебный байт) -> байт шины
+// для NIX6_OUTPUT_REVERSE_INVERT. Для NIX6_OUTPUT_STD байт шины совпадает с исходным.
+constexpr uint8_t kWireByteReverseInvert[256] = {
+    NIX6_T64(reverseBitsInBothNibbles, 0), NIX6_T64(reverseBitsInBothNibbles, 64),
+    NIX6_T64(reverseBitsInBothNibbles, 128), NIX6_T64(reverseBitsInBothNibbles, 192)
+};
+
+// Значение 00..99 -> байт шины для пары разрядов (ЧЧ/ММ/СС) в обоих режимах вывода.
+constexpr uint8_t kWirePairStd[100] = { NIX6_T100(bcdPair) };
+constexpr uint8_t kWirePairReverseInvert[100] = { NIX6_T100(reverseInvertPair) };
+
+#undef NIX6_T100
+#undef NIX6_T10
+#undef NIX6_T64
+#undef NIX6_T16
+#undef NIX6_T4
+
+static_assert(kWireByteReverseInvert[0x12] == 0x84, "nibble bit reversal table is broken");
+static_assert(kWirePairStd[59] == 0x59, "BCD pair table is broken");
+static_assert(kWirePairReverseInvert[12] == 0x48, "reverse-invert pair table is broken");
+
+inline uint8_t clampTmField(int value, int modulo) {
+    return static_cast<uint8_t>((value < 0) ? 0 : value % modulo);
+}
+
+bool isReverseBitsOutputMode() {
+    return (config.clock_type == CLOCK_TYPE_NIXIE && config.clock_digits == 6 &&
+            config.nix6_output_mode == NIX6_OUTPUT_REVERSE_INVERT);
+}
+
+// Упаковка 32-битного кадра (уже после applyOutputMode) в 4 байта шины.
+// Порядок как у bit-bang протокола: n0..n5 (данные), затем служебный байт.
+inline void encodeWireBytes(uint32_t value, bool reverseBitsInNibble, uint8_t* tx) {
+    const uint8_t b0 = static_cast<uint8_t>(value >> 16);
+    const uint8_t b1 = static_cast<uint8_t>(value >> 8);
+    const uint8_t b2 = static_cast<uint8_t>(value);
+    const uint8_t b3 = static_cast<uint8_t>(value >> 24);
+    if (reverseBitsInNibble) {
+        tx[0] = kWireByteReverseInvert[b0];
+        tx[1] = kWireByteReverseInvert[b1];
+        tx[2] = kWireByteReverseInvert[b2];
+        tx[3] = kWireByteReverseInvert[b3];
+        return;
+    }
+    tx[0] = b0;
+    tx[1] = b1;
+    tx[2] = b2;
+    tx[3] = b3;
+}
+
+// Кадр времени сразу в формате шины: перестановка разрядов и обращение битов — из таблиц.
+inline void encodeTimeWireBytes(uint8_t hour, uint8_t minute, uint8_t second, uint8_t flags,
+                                bool reverseInvert, uint8_t* tx) {
+    if (reverseInvert) {
+        tx[0] = kWirePairReverseInvert[second];
+        tx[1] = kWirePairReverseInvert[minute];
+        tx[2] = kWirePairReverseInvert[hour];
+        tx[3] = kWireByteReverseInvert[flags];
+        return;
+    }
+    tx[0] = kWirePairStd[hour];
+    tx[1] = kWirePairStd[minute];
+    tx[2] = kWirePairStd[second];
+    tx[3] = flags;
+}
+
+// Под ScopedDisplayBusLock
+void rebuildGammaLut(float gamma) {
+    for (uint8_t i = 0; i <= GAMMA_LUT_SEGMENTS; ++i) {
+        const float p = static_cast<float>(i) / GAMMA_LUT_SEGMENTS;
+        g_gammaLut[i] = static_cast<uint32_t>(powf(p, gamma) * SIGMA_DELTA_ONE + 0.5f);
+    }
+    g_gammaLutReady = true;
+}
+
+// Под ScopedDisplayBusLock
+const uint32_t* activeGammaLut() {
+    if (!g_gammaLutReady) {
+        rebuildGammaLut(g_transitionGamma);
+    }
+    return g_gammaLut;
+}
+
+inline uint32_t transitionTotalSlots(uint16_t durationMs) {
+    return (static_cast<uint32_t>(durationMs) * 1000UL) / TRANSITION_SLOT_US;
+}
+
+// Сколько прошло от старта перехода (мкс). Отрицательно, пока переход ждёт конца hold предыдущего.
+// millis() = esp_timer_get_time() / 1000, поэтому мкс-часть берётся из того же счётчика.
+inline int32_t transitionElapsedUs(uint32_t startMs) {
+    const int64_t nowUs = esp_timer_get_time();
+    const int32_t elapsedMs = static_cast<int32_t>(static_cast<uint32_t>(nowUs / 1000) - startMs);
+    if (elapsedMs > 2000000 || elapsedMs < -2000000) {
+        return (elapsedMs > 0) ? INT32_MAX : -INT32_MAX;  // давно завершённый/битый старт, без переполнения
+    }
+    return elapsedMs * 1000 + static_cast<int32_t>(nowUs % 1000);
+}
+
+inline int32_t slotIndexFromUs(int32_t elapsedUs) {
+    return (elapsedUs >= 0) ? (elapsedUs / TRANSITION_SLOT_US)
+                            : -static_cast<int32_t>((-elapsedUs + TRANSITION_SLOT_US - 1) / TRANSITION_SLOT_US);
+}
+
+// Sigma-delta первого порядка: каждый слот аккумулятор получает долю g(p) нового кадра,
+// переполнение = слот нового кадра. Новые слоты идут максимально равномерно.
+struct CrossfadeEngine {
+    uint32_t lut[GAMMA_LUT_SEGMENTS + 1] = {};  // копия на весь переход
+    uint32_t totalSlots = 0;
+    uint32_t accumulator = 0;
+
+    void start(const uint32_t* gammaLut, uint32_t slots) {
+        memcpy(lut, gammaLut, sizeof(lut));
+        totalSlots = (slots > 0) ? slots : 1;
+        accumulator = SIGMA_DELTA_ONE / 2;
+    }
+
+    // true = слот slot (от старта перехода) показывает новый кадр.
+    bool step(int32_t slot) {
+        if (slot < 0) {
+            return false;  // hold предыдущего перехода: старый кадр ещё стоит
+        }
+        if (static_cast<uint32_t>(slot) >= totalSlots) {
+            return true;
+        }
+        // p = slot / totalSlots в сегментах таблицы, дробная часть 8 бит
+        const uint32_t pos = (static_cast<uint32_t>(slot) * GAMMA_LUT_SEGMENTS * 256U) / totalSlots;
+        const uint32_t seg = pos >> 8;
+        const uint32_t frac = pos & 0xFFU;
+        const uint32_t share = lut[seg] + (((lut[seg + 1] - lut[seg]) * frac) >> 8);
+        accumulator += share;
+        if (accumulator >= SIGMA_DELTA_ONE) {
+            accumulator -= SIGMA_DELTA_ONE;
+            return true;
+        }
+        return false;
+    }
+};
+
+// Потоковая раскладка перехода в кольцо DMA (под ScopedDisplayBusLock).
+struct DmaSchedule {
+    bool active = false;      // ещё есть не поставленные в очередь слоты
+    CrossfadeEngine engine;
+    uint32_t startMs = 0;
+    int32_t nextSlot = 0;     // следующий слот, для которого нужно решение
+    uint8_t runFrame = 0;     // кадр, защёлкнутый последней транзакцией
+    uint16_t runSlots = 0;    // сколько слотов он уже показывается
+    bool hasDecision = false; // решение для nextSlot уже принято (аккумулятор сдвинут)
+    uint8_t decision = 0;
+    uint16_t ringHead = 0;
+};
+DmaSchedule g_dmaSchedule;
+
+// Слоты без DMA: периодический esp_timer (задача esp_timer, ядро 0) с частотой слотов.
+// Вывод кадра в ISR невозможен (SPI master/SPIClass не ISR-safe), зато таймер не зависит
+// от загрузки ядра 1 и ритма задач loop/disp_refresh.
+esp_timer_handle_t g_slotTimer = nullptr;
+std::atomic<bool> g_slotTimerRunning{false};
+CrossfadeEngine g_timerEngine;
+uint32_t g_timerEngineTransitionId = 0;
+bool g_timerEngineStarted = false;
+
+bool startSlotTimer() {
+    if (g_slotTimer == nullptr) {
+        return false;
+    }
+    if (g_slotTimerRunning.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    if (esp_timer_start_periodic(g_slotTimer, TRANSITION_SLOT_US) != ESP_OK) {
+        return false;
+    }
+    g_slotTimerRunning.store(true, std::memory_order_release);
+    return true;
+}
+
+void stopSlotTimer() {
+    if (g_slotTimer != nullptr && g_slotTimerRunning.load(std::memory_order_relaxed)) {
+        esp_timer_stop(g_slotTimer);
+        g_slotTimerRunning.store(false, std::memory_order_release);
+    }
+}
+
+bool initDisplayDmaBus(uint8_t sckPin, uint8_t mosiPin, uint8_t latchPin) {
+    for (uint8_t i = 0; i < 2; ++i) {
+        if (g_dmaRunBuffers[i] == nullptr) {
+            g_dmaRunBuffers[i] = static_cast<uint8_t*>(heap_caps_calloc(1, DMA_RUN_BUFFER_BYTES, MALLOC_CAP_DMA));
+        }
+        if (g_dmaRunBuffers[i] == nullptr) {
+            return false;
+        }
+    }
+
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num = mosiPin;
+    bus.miso_io_num = -1;
+    bus.sclk_io_num = sckPin;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = DMA_RUN_BUFFER_BYTES;
+    if (spi_bus_initialize(DISPLAY_DMA_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) {
+        return false;
+    }
+
+    spi_device_interface_config_t dev = {};
+    dev.mode = 0;
+    dev.clock_speed_hz = DISPLAY_DMA_SPI_HZ;
+    dev.spics_io_num = latchPin;  // CS active-low: подъём в конце транзакции = импульс LATCH
+    dev.queue_size = DMA_RING_TRANSACTIONS;
+    if (spi_bus_add_device(DISPLAY_DMA_HOST, &dev, &g_displayDmaDevice) != ESP_OK) {
+        spi_bus_free(DISPLAY_DMA_HOST);
+        g_displayDmaDevice = nullptr;
+        return false;
+    }
+    return true;
+}
 }
 
 Nixie6SpiDriver::Nixie6SpiDriver(uint8_t latchPin, uint8_t sckPin, uint8_t mosiPin)
@@ -105,8 +553,8 @@ bool nixie6IsSoftTransitionEnabled() {
 }
 
 void nixie6SetTransitionDurationMs(uint16_t durationMs) {
-    if (durationMs < 40) durationMs = 40;
-    if (durationMs > 500) durationMs = 500;
+    if (durationMs < TRANSITION_MIN_DURATION_MS) durationMs = TRANSITION_MIN_DURATION_MS;
+    if (durationMs > TRANSITION_MAX_DURATION_MS) durationMs = TRANSITION_MAX_DURATION_MS;
     g_transitionDurationMs = durationMs;
 }
 
@@ -114,34 +562,184 @@ uint16_t nixie6GetTransitionDurationMs() {
     return g_transitionDurationMs;
 }
 
+void nixie6SetTransitionGamma(float gamma) {
+    if (!(gamma >= TRANSITION_MIN_GAMMA)) gamma = TRANSITION_MIN_GAMMA;  // в т.ч. NaN
+    if (gamma > TRANSITION_MAX_GAMMA) gamma = TRANSITION_MAX_GAMMA;
+    g_transitionGamma = gamma;
+    ScopedDisplayBusLock bus(true);
+    rebuildGammaLut(gamma);
+}
+
+float nixie6GetTransitionGamma() {
+    return g_transitionGamma;
+}
+
+void nixie6SetTransitionHoldMs(uint16_t holdMs) {
+    g_transitionHoldMs = (holdMs > TRANSITION_MAX_HOLD_MS) ? TRANSITION_MAX_HOLD_MS : holdMs;
+}
+
+uint16_t nixie6GetTransitionHoldMs() {
+    return g_transitionHoldMs;
+}
+
+Nixie6BusStats nixie6GetBusStats() {
+    ScopedDisplayBusLock bus(true);
+    return g_busStats;
+}
+
+void nixie6ResetBusStats() {
+    ScopedDisplayBusLock bus(true);
+    g_busStats = Nixie6BusStats{};
+    g_busStats.sinceMs = millis();
+}
+
+void nixie6MarkSecondTick(uint32_t sqwEdgeUs, uint32_t tickStartUs) {
+    ScopedDisplayBusLock bus(true);
+    if (g_latencyArmed) {
+        ++g_latencyStats.ticksWithoutLatch;
+    }
+    if (sqwEdgeUs != 0) {
+        addLatencySample(g_latencyStats.sqwToTick, tickStartUs - sqwEdgeUs);
+    }
+    g_latencySqwEdgeUs = sqwEdgeUs;
+    g_latencyTickStartUs = tickStartUs;
+    g_latencyArmed = true;
+}
+
+Nixie6LatencyStats nixie6GetLatencyStats() {
+    ScopedDisplayBusLock bus(true);
+    return g_latencyStats;
+}
+
+void nixie6ResetLatencyStats() {
+    ScopedDisplayBusLock bus(true);
+    g_latencyStats = Nixie6LatencyStats{};
+    g_latencyStats.sinceMs = millis();
+    g_latencyArmed = false;
+}
+
+bool nixie6StartLatchTrace() {
+    ScopedDisplayBusLock bus(true);
+    if (g_latchTrace == nullptr) {
+        g_latchTrace = static_cast<Nixie6LatchRecord*>(
+            calloc(NIXIE6_LATCH_TRACE_CAPACITY, sizeof(Nixie6LatchRecord)));
+        if (g_latchTrace == nullptr) {
+            return false;
+        }
+    }
+    g_latchTraceCount = 0;
+    g_latchTraceDropped = 0;
+    g_latchTraceOn.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void nixie6StopLatchTrace() {
+    ScopedDisplayBusLock bus(true);
+    g_latchTraceOn.store(false, std::memory_order_relaxed);
+    free(g_latchTrace);
+    g_latchTrace = nullptr;
+    g_latchTraceCount = 0;
+}
+
+uint16_t nixie6TakeLatchTrace(Nixie6LatchRecord* out, uint16_t maxRecords, uint16_t* dropped) {
+    ScopedDisplayBusLock bus(true);
+    const uint16_t count = (g_latchTraceCount < maxRecords) ? g_latchTraceCount : maxRecords;
+    if (count > 0 && out != nullptr) {
+        memcpy(out, g_latchTrace, count * sizeof(Nixie6LatchRecord));
+    }
+    if (dropped != nullptr) {
+        *dropped = static_cast<uint16_t>(g_latchTraceDropped + (g_latchTraceCount - count));
+    }
+    g_latchTraceCount = 0;
+    g_latchTraceDropped = 0;
+    return count;
+}
+
+void nixie6DecodeWire(const uint8_t* wire, char* digits, uint8_t* flags) {
+    // Таблица обращения битов в нибблах сама себе обратна; порядок разрядов в режиме 2 зеркальный.
+    const bool reverseInvert = isReverseBitsOutputMode();
+    uint8_t b[4];
+    for (uint8_t i = 0; i < 4; ++i) {
+        b[i] = reverseInvert ? kWireByteReverseInvert[wire[i]] : wire[i];
+    }
+    const uint8_t nibbles[6] = {
+        static_cast<uint8_t>(b[0] >> 4), static_cast<uint8_t>(b[0] & 0x0FU),
+        static_cast<uint8_t>(b[1] >> 4), static_cast<uint8_t>(b[1] & 0x0FU),
+        static_cast<uint8_t>(b[2] >> 4), static_cast<uint8_t>(b[2] & 0x0FU)
+    };
+    for (uint8_t i = 0; i < 6; ++i) {
+        const uint8_t n = reverseInvert ? nibbles[5 - i] : nibbles[i];
+        digits[i] = (n <= 9) ? static_cast<char>('0' + n) : '-';
+    }
+    digits[6] = '\0';
+    if (flags != nullptr) {
+        *flags = b[3];
+    }
+}
+
+Nixie6LockStats nixie6GetLockStats() {
+    Nixie6LockStats stats;
+    stats.writerLocks = g_lockCounters.writerLocks.load(std::memory_order_relaxed);
+    stats.writerContended = g_lockCounters.writerContended.load(std::memory_order_relaxed);
+    stats.busContended = g_lockCounters.busContended.load(std::memory_order_relaxed);
+    stats.serviceBusSkips = g_lockCounters.serviceBusSkips.load(std::memory_order_relaxed);
+    stats.snapshotRetries = g_lockCounters.snapshotRetries.load(std::memory_order_relaxed);
+    return stats;
+}
+
 void Nixie6SpiDriver::begin() {
     ScopedNixieDriverLock lock;
     if (!lock.locked()) {
         return;
     }
 
-    pinMode(latchPin_, OUTPUT);
-    pinMode(sckPin_, OUTPUT);
-    pinMode(mosiPin_, OUTPUT);
+    {
+        ScopedDisplayBusLock bus(true);
 
-    digitalWrite(latchPin_, LOW);
-    digitalWrite(sckPin_, LOW);
-    digitalWrite(mosiPin_, LOW);
+        pinMode(latchPin_, OUTPUT);
+        pinMode(sckPin_, OUTPUT);
+        pinMode(mosiPin_, OUTPUT);
 
-    if (USE_HARDWARE_SPI) {
-        // Для ESP32-S3 у HSPI нет "дефолтных" пинов, поэтому нельзя оставлять MISO = -1,
-        // иначе драйвер пытается подключить несуществующий default MISO и печатает ошибку.
-        // Индикация write-only, MISO не используется: задаём любой валидный GPIO-вход.
-        g_displaySpi.begin(sckPin_, SD_SPI_MISO_PIN, mosiPin_, latchPin_);
-        g_displaySpiReady = true;
+        digitalWrite(latchPin_, LOW);
+        digitalWrite(sckPin_, LOW);
+        digitalWrite(mosiPin_, LOW);
+
+        if (USE_HARDWARE_SPI && USE_DMA_TRANSITION_ENGINE) {
+            g_displayDmaReady = initDisplayDmaBus(sckPin_, mosiPin_, latchPin_);
+            if (!g_displayDmaReady) {
+                Serial.print("\n[DISP][WARN] DMA transition engine init failed, fallback to polled SPI");
+            }
+        }
+
+        if (USE_HARDWARE_SPI && !g_displayDmaReady) {
+            // Для ESP32-S3 у HSPI нет "дефолтных" пинов, поэтому нельзя оставлять MISO = -1,
+            // иначе драйвер пытается подключить несуществующий default MISO и печатает ошибку.
+            // Индикация write-only, MISO не используется: задаём любой валидный GPIO-вход.
+            g_displaySpi.begin(sckPin_, SD_SPI_MISO_PIN, mosiPin_, latchPin_);
+            g_displaySpiReady = true;
+        }
+
+        if (!g_displayDmaReady && g_slotTimer == nullptr) {
+            esp_timer_create_args_t args = {};
+            args.callback = &Nixie6SpiDriver::slotTimerThunk;
+            args.arg = this;
+            args.dispatch_method = ESP_TIMER_TASK;
+            args.name = "nix6_slot";
+            if (esp_timer_create(&args, &g_slotTimer) != ESP_OK) {
+                g_slotTimer = nullptr;
+                Serial.print("\n[DISP][WARN] slot timer init failed, transitions fall back to disp_refresh polling");
+            }
+        }
+        (void)activeGammaLut();
     }
 
-    pushFrame();
+    pushFrameLocked();
 }
 
 void Nixie6SpiDriver::setBrightness(uint8_t level) {
+    // Яркость = аппаратный PWM на OE (LEDC), CPU в поддержании уровня не участвует.
     brightness_ = level;
-    (void)brightness_;
+    setDisplayPwmLevel(brightness_);
 }
 
 void Nixie6SpiDriver::showTime(uint8_t hours, uint8_t minutes, uint8_t seconds, bool showColon) {
@@ -160,7 +758,7 @@ void Nixie6SpiDriver::showTime(uint8_t hours, uint8_t minutes, uint8_t seconds,
         mainMode_ = MainMode::Time;
     }
 
-    pushFrame();
+    pushFrameLocked();
 }
 
 void Nixie6SpiDriver::testPattern() {
@@ -177,6 +775,8 @@ void Nixie6SpiDriver::testPattern() {
     f.nibbles[3] = 5;
     f.nibbles[4] = 4;
     f.nibbles[5] = 3;
+
+    ScopedDisplayBusLock bus(true);
     shiftOut32(f.pack());
 }
 
@@ -188,7 +788,10 @@ void Nixie6SpiDriver::showUniformDigits(uint8_t digit) {
 
     if (digit > 9) digit = 9;
     transitionActive_ = false;  // антиотравление/ручные шаблоны — без soft-transition
+    publishState();
+
     const Nixie6Frame f = applyOutputMode(buildUniformFrame(digit));
+    ScopedDisplayBusLock bus(true);
     shiftOut32(f.pack());
 }
 
@@ -205,7 +808,7 @@ void Nixie6SpiDriver::trigger1(bool allowAlarmViews) {
     if (secondaryBranchActive_) {
         secondaryBranchActive_ = false;
         mainMode_ = MainMode::Time;
-        pushFrame();
+        pushFrameLocked();
         return;
     }
 
@@ -226,7 +829,7 @@ void Nixie6SpiDriver::trigger1(bool allowAlarmViews) {
     }
 
     modeEnteredAtMs_ = millis();
-    pushFrame();
+    pushFrameLocked();
 }
 
 void Nixie6SpiDriver::trigger2() {
@@ -242,7 +845,7 @@ void Nixie6SpiDriver::trigger2() {
     if (!secondaryBranchActive_) {
         secondaryBranchActive_ = true;
         auxMode_ = AuxMode::Pressure;
-        pushFrame();
+        pushFrameLocked();
         return;
     }
 
@@ -260,7 +863,7 @@ void Nixie6SpiDriver::trigger2() {
             break;
     }
 
-    pushFrame();
+    pushFrameLocked();
 }
 
 void Nixie6SpiDriver::tick(uint32_t nowMs) {
@@ -275,7 +878,7 @@ void Nixie6SpiDriver::tick(uint32_t nowMs) {
 
     if (mainMode_ != MainMode::Time && (nowMs - modeEnteredAtMs_ >= mainModeTimeoutMs_)) {
         mainMode_ = MainMode::Time;
-        pushFrame();
+        pushFrameLocked();
     }
 }
 
@@ -286,6 +889,7 @@ void Nixie6SpiDriver::enterEditPlaceholder() {
     }
 
     editPlaceholder_ = true;
+    publishState();
 }
 
 void Nixie6SpiDriver::exitEditPlaceholder() {
@@ -295,6 +899,7 @@ void Nixie6SpiDriver::exitEditPlaceholder() {
     }
 
     editPlaceholder_ = false;
+    publishState();
 }
 
 void Nixie6SpiDriver::setStartFlags(uint8_t flags) {
@@ -304,6 +909,7 @@ void Nixie6SpiDriver::setStartFlags(uint8_t flags) {
     }
 
     startFlags_ = flags;
+    publishState();
 }
 
 void Nixie6SpiDriver::setAlarm1(uint8_t hour, uint8_t minute) {
@@ -314,6 +920,7 @@ void Nixie6SpiDriver::setAlarm1(uint8_t hour, uint8_t minute) {
 
     al1Hour_ = hour % 24;
     al1Minute_ = minute % 60;
+    publishState();
 }
 
 void Nixie6SpiDriver::setAlarm2(uint8_t hour, uint8_t minute) {
@@ -324,6 +931,7 @@ void Nixie6SpiDriver::setAlarm2(uint8_t hour, uint8_t minute) {
 
     al2Hour_ = hour % 24;
     al2Minute_ = minute % 60;
+    publishState();
 }
 
 void Nixie6SpiDriver::setPressureMmHg(uint16_t pressure) {
@@ -333,6 +941,7 @@ void Nixie6SpiDriver::setPressureMmHg(uint16_t pressure) {
     }
 
     pressureMmHg_ = pressure;
+    publishState();
 }
 
 void Nixie6SpiDriver::setHumidityPercent(uint8_t humidity) {
@@ -342,6 +951,7 @@ void Nixie6SpiDriver::setHumidityPercent(uint8_t humidity) {
     }
 
     humidityPercent_ = (humidity > 99) ? 99 : humidity;
+    publishState();
 }
 
 void Nixie6SpiDriver::setTemperatureC(int16_t temperature) {
@@ -351,6 +961,7 @@ void Nixie6SpiDriver::setTemperatureC(int16_t temperature) {
     }
 
     temperatureC_ = temperature;
+    publishState();
 }
 
 void Nixie6SpiDriver::updateFromLocalTime(const tm& localTm) {
@@ -359,9 +970,11 @@ void Nixie6SpiDriver::updateFromLocalTime(const tm& localTm) {
         return;
     }
 
+    retireCompletedTransition();
     const tm previousTm = localTm_;
     maybeStartTimeTransition(previousTm, localTm, millis());
     localTm_ = localTm;
+    publishState();
 }
 
 void Nixie6SpiDriver::setMainModeTimeoutMs(uint32_t timeoutMs) {
@@ -374,71 +987,21 @@ void Nixie6SpiDriver::setMainModeTimeoutMs(uint32_t timeoutMs) {
 }
 
 Nixie6View Nixie6SpiDriver::currentView() const {
-    ScopedNixieDriverLock lock;
-    if (!lock.locked()) {
-        return Nixie6View::DefaultTime;
-    }
-
-    if (editPlaceholder_) {
-        return Nixie6View::EditPlaceholder;
-    }
-
-    if (secondaryBranchActive_) {
-        switch (auxMode_) {
-            case AuxMode::Pressure: return Nixie6View::Pressure;
-            case AuxMode::Humidity: return Nixie6View::Humidity;
-            case AuxMode::Temperature: return Nixie6View::Temperature;
-            default: return Nixie6View::Pressure;
-        }
-    }
-
-    switch (mainMode_) {
-        case MainMode::Time: return Nixie6View::DefaultTime;
-        case MainMode::Date: return Nixie6View::Date;
-        case MainMode::Alarm1: return Nixie6View::Alarm1;
-        case MainMode::Alarm2: return Nixie6View::Alarm2;
-        default: return Nixie6View::DefaultTime;
-    }
+    return readPublishedState().view;
 }
 
 Nixie6Frame Nixie6SpiDriver::currentFrame() const {
-    ScopedNixieDriverLock lock;
-    if (!lock.locked()) {
-        return Nixie6Frame{};
-    }
-
-    switch (currentView()) {
-        case Nixie6View::DefaultTime: return buildTimeFrame();
-        case Nixie6View::Date: return buildDateFrame();
-        case Nixie6View::Alarm1: return buildAlarmFrame(al1Hour_, al1Minute_);
-        case Nixie6View::Alarm2: return buildAlarmFrame(al2Hour_, al2Minute_);
-        case Nixie6View::Pressure: return buildPressureFrame();
-        case Nixie6View::Humidity: return buildHumidityFrame();
-        case Nixie6View::Temperature: return buildTemperatureFrame();
-        case Nixie6View::EditPlaceholder:
-        default:
-            return secondaryBranchActive_ ? buildPressureFrame() : buildTimeFrame();
-    }
+    return readPublishedState().frame;
 }
 
 uint32_t Nixie6SpiDriver::packedFrame() const {
-    ScopedNixieDriverLock lock;
-    if (!lock.locked()) {
-        return 0;
-    }
-
     // Логический кадр для диагностики/отладки (без аппаратных трансформаций)
-    return currentFrame().pack();
+    return readPublishedState().frame.pack();
 }
 
 uint32_t Nixie6SpiDriver::packedFrameOutput() const {
-    ScopedNixieDriverLock lock;
-    if (!lock.locked()) {
-        return 0;
-    }
-
     // Кадр после преобразования режима вывода (порядок разрядов)
-    return applyOutputMode(currentFrame()).pack();
+    return readPublishedState().frameOutput;
 }
 
 void Nixie6SpiDriver::pushFrame() {
@@ -447,56 +1010,394 @@ void Nixie6SpiDriver::pushFrame() {
         return;
     }
 
-    // На шину уходит кадр c учетом активной анимации soft-transition (если есть).
-    if (transitionActive_ && (millis() - transitionStartMs_) >= transitionDurationMs_) {
+    pushFrameLocked();
+}
+
+void Nixie6SpiDriver::pushFrameLocked() {
+    retireCompletedTransition();
+    publishState();
+
+    ScopedDisplayBusLock bus(true);
+    if (g_displayDmaReady) {
+        drainDmaTransactions();
+        retireCompletedTransition();
+        if (dmaSequenceQueued_.load(std::memory_order_relaxed)) {
+            // Последовательность уже в DMA и закончится кадром dmaQueuedTarget_.
+            // Если экран сменился или переход отменён — актуальный кадр уйдёт после неё.
+            const uint32_t target = applyOutputMode(buildCurrentFrame()).pack();
+            if (!transitionActive_ || target != dmaQueuedTarget_) {
+                shiftOut32(target);
+            }
+            return;
+        }
+        if (transitionActive_ && startDmaTransition(readPublishedState(), millis())) {
+            return;
+        }
+    } else if (transitionActive_ && startSlotTimer()) {
+        // Слоты выдаёт таймер: первый — не позже чем через TRANSITION_SLOT_US.
+        return;
+    }
+
+    if (transitionActive_ &&
+        transitionElapsedUs(transitionStartMs_) >= static_cast<int32_t>(transitionDurationMs_) * 1000) {
         transitionActive_ = false;
+        publishState();
+    }
+    if (transitionActive_) {
+        // Ни DMA, ни таймера: текущий слот сейчас, остальные — из serviceTransition().
+        outputTransitionSlot(readPublishedState());
+        return;
     }
-    const Nixie6Frame out = frameForOutputNow(millis());
-    shiftOut32(out.pack());
+    shiftOut32(applyOutputMode(buildCurrentFrame()).pack());
 }
 
 void Nixie6SpiDriver::serviceTransition(uint32_t nowMs) {
-    ScopedNixieDriverLock lock;
-    if (!lock.locked()) {
+    if (!isTransitionActive() && !dmaPushPending_.load(std::memory_order_acquire)) {
         return;
     }
+    if (!g_displayDmaReady && g_slotTimerRunning.load(std::memory_order_acquire)) {
+        return;  // слоты выдаёт esp_timer
+    }
 
-    if (!transitionActive_) {
+    // Путь disp_refresh не ждёт никого: если шину держит писатель, он сам выведет актуальный кадр.
+    ScopedDisplayBusLock bus(false);
+    if (!bus.locked()) {
+        bumpCounter(g_lockCounters.serviceBusSkips);
         return;
     }
-    if ((nowMs - transitionStartMs_) >= transitionDurationMs_) {
-        transitionActive_ = false;
-        shiftOut32(transitionTo_.pack());
+
+    // Снимок читается уже под шиной: всё, что писатель опубликовал раньше, учтено здесь,
+    // а всё, что позже, он выведет сам после нас.
+    if (g_displayDmaReady) {
+        // Слоты выдаёт DMA; здесь забираем завершённые транзакции, дозаполняем кольцо
+        // и запускаем переход, если pushFrame() ещё не успел это сделать.
+        drainDmaTransactions();
+        const PublishedState s = readPublishedState();
+        if (isPendingTransition(s) && !dmaSequenceQueued_.load(std::memory_order_relaxed) &&
+            !startDmaTransition(s, nowMs)) {
+            shiftOutWire(s.toWire);
+            completedTransitionId_.store(s.transitionId, std::memory_order_release);
+        }
+        return;
+    }
+
+    const PublishedState s = readPublishedState();
+    if (isPendingTransition(s) && startSlotTimer()) {
         return;
     }
-    const Nixie6Frame out = frameForOutputNow(nowMs);
-    shiftOut32(out.pack());
+    outputTransitionSlot(s);
+}
+
+void Nixie6SpiDriver::slotTimerThunk(void* arg) {
+    static_cast<Nixie6SpiDriver*>(arg)->onSlotTimer();
+}
+
+void Nixie6SpiDriver::onSlotTimer() {
+    ScopedDisplayBusLock bus(false);
+    if (!bus.locked()) {
+        bumpCounter(g_lockCounters.serviceBusSkips);
+        return;
+    }
+    outputTransitionSlot(readPublishedState());
+}
+
+void Nixie6SpiDriver::outputTransitionSlot(const PublishedState& s) {
+    if (!isPendingTransition(s)) {
+        stopSlotTimer();
+        return;
+    }
+
+    const int32_t elapsedUs = transitionElapsedUs(s.transitionStartMs);
+    if (elapsedUs >= static_cast<int32_t>(s.transitionDurationMs) * 1000) {
+        shiftOutWire(s.toWire);
+        completedTransitionId_.store(s.transitionId, std::memory_order_release);
+        stopSlotTimer();
+        return;
+    }
+
+    if (!g_timerEngineStarted || g_timerEngineTransitionId != s.transitionId) {
+        g_timerEngine.start(activeGammaLut(), transitionTotalSlots(s.transitionDurationMs));
+        g_timerEngineTransitionId = s.transitionId;
+        g_timerEngineStarted = true;
+    }
+    shiftOutWire(g_timerEngine.step(slotIndexFromUs(elapsedUs)) ? s.toWire : s.fromWire);
 }
 
 void Nixie6SpiDriver::cancelTransition() {
+    // Вызывается disp_refresh на каждом проходе вне режима времени: без перехода — без блокировок.
+    if (!isTransitionActive() && !dmaPushPending_.load(std::memory_order_acquire)) {
+        return;
+    }
+
     ScopedNixieDriverLock lock;
     if (!lock.locked()) {
         return;
     }
 
     transitionActive_ = false;
+    publishState();
+
+    ScopedDisplayBusLock bus(true);
+    if (!g_displayDmaReady) {
+        stopSlotTimer();
+        return;
+    }
+
+    // Остаток перехода в кольцо больше не докладываем; поставленное доиграет само.
+    g_dmaSchedule.active = false;
+    g_dmaFinalQueued = false;
+    drainDmaTransactions();
+    if (dmaSequenceQueued_.load(std::memory_order_relaxed)) {
+        // Прервать очередь DMA нельзя: актуальный кадр выводится сразу после неё.
+        shiftOut32(applyOutputMode(buildCurrentFrame()).pack());
+    }
 }
 
 bool Nixie6SpiDriver::isTransitionActive() const {
-    ScopedNixieDriverLock lock;
-    if (!lock.locked()) {
+    return isPendingTransition(readPublishedState()) ||
+           dmaSequenceQueued_.load(std::memory_order_acquire);
+}
+
+uint32_t Nixie6SpiDriver::transitionServiceIntervalMs(uint32_t nowMs) const {
+    const bool queued = dmaSequenceQueued_.load(std::memory_order_acquire);
+    if (!isTransitionActive() && !dmaPushPending_.load(std::memory_order_acquire)) {
+        return 0;
+    }
+
+    int32_t leftMs = 0;
+    if (g_displayDmaReady) {
+        if (!queued) {
+            return 1;
+        }
+        // DMA сам выдаёт слоты: просыпаемся дозаполнить кольцо или к концу последовательности.
+        leftMs = static_cast<int32_t>(dmaWakeAtMs_.load(std::memory_order_relaxed) - nowMs);
+    } else {
+        if (!g_slotTimerRunning.load(std::memory_order_acquire)) {
+            return 1;
+        }
+        // Слоты выдаёт таймер: задача нужна только после конца перехода.
+        const PublishedState s = readPublishedState();
+        leftMs = static_cast<int32_t>(s.transitionStartMs + s.transitionDurationMs - nowMs);
+    }
+
+    if (leftMs < 1) {
+        return 1;
+    }
+    return (leftMs > 20) ? 20U : static_cast<uint32_t>(leftMs);
+}
+
+void Nixie6SpiDriver::publishState() {
+    // Двойной буфер + счётчик: нечётное значение = идёт запись в "другой" слот.
+    // Читатель берёт последний завершённый слот и никогда не ждёт писателя.
+    const uint32_t seq = publishSeq_.load(std::memory_order_relaxed);
+    publishSeq_.store(seq + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    PublishedState& s = published_[((seq >> 1) + 1U) & 1U];
+    s.view = viewLocked();
+    s.frame = buildCurrentFrame();
+    s.frameOutput = applyOutputMode(s.frame).pack();
+    s.transitionId = transitionId_;
+    s.transitionActive = transitionActive_;
+    s.transitionStartMs = transitionStartMs_;
+    s.transitionDurationMs = transitionDurationMs_;
+    s.transitionTarget = transitionTo_.pack();
+    memcpy(s.fromWire, transitionFromWire_, sizeof(s.fromWire));
+    memcpy(s.toWire, transitionToWire_, sizeof(s.toWire));
+
+    publishSeq_.store(seq + 2U, std::memory_order_release);
+}
+
+Nixie6SpiDriver::PublishedState Nixie6SpiDriver::readPublishedState() const {
+    for (;;) {
+        const uint32_t seq = publishSeq_.load(std::memory_order_acquire);
+        const PublishedState s = published_[(seq >> 1) & 1U];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // Слот мог быть перезаписан, только если писатель начал уже вторую публикацию после seq.
+        if (publishSeq_.load(std::memory_order_relaxed) - (seq & ~1U) < 3U) {
+            return s;
+        }
+        bumpCounter(g_lockCounters.snapshotRetries);
+    }
+}
+
+bool Nixie6SpiDriver::isPendingTransition(const PublishedState& s) const {
+    return s.transitionActive &&
+           completedTransitionId_.load(std::memory_order_acquire) != s.transitionId;
+}
+
+void Nixie6SpiDriver::retireCompletedTransition() {
+    // Финальный кадр уже выведен сервисом/DMA: писатель снимает флаг у себя.
+    if (transitionActive_ &&
+        completedTransitionId_.load(std::memory_order_acquire) == transitionId_) {
+        transitionActive_ = false;
+    }
+}
+
+bool Nixie6SpiDriver::startDmaTransition(const PublishedState& s, uint32_t nowMs) {
+    if (!g_displayDmaReady || dmaSequenceQueued_.load(std::memory_order_relaxed) || dmaInFlight_ > 0) {
+        return false;
+    }
+
+    // Отсчёт ведём от старта перехода: часть могла пройти до постановки в очередь,
+    // а при hold старт ещё впереди (первые слоты — старый кадр).
+    const int32_t elapsedUs = transitionElapsedUs(s.transitionStartMs);
+    if (elapsedUs >= static_cast<int32_t>(s.transitionDurationMs) * 1000) {
+        return false;
+    }
+
+    memcpy(g_dmaRunBuffers[0] + DMA_RUN_BUFFER_BYTES - 4, s.fromWire, 4);
+    memcpy(g_dmaRunBuffers[1] + DMA_RUN_BUFFER_BYTES - 4, s.toWire, 4);
+
+    DmaSchedule& d = g_dmaSchedule;
+    d.engine.start(activeGammaLut(), transitionTotalSlots(s.transitionDurationMs));
+    d.startMs = s.transitionStartMs;
+    const int32_t firstSlot = slotIndexFromUs(elapsedUs);
+    d.runFrame = d.engine.step(firstSlot) ? 1 : 0;
+    d.runSlots = 1;
+    d.nextSlot = firstSlot + 1;
+    d.hasDecision = false;
+    g_dmaFinalQueued = false;
+
+    // Первая транзакция — только защёлка кадра первого слота.
+    if (!queueDmaTransaction(d.runFrame, 4)) {
         return false;
     }
+    d.active = true;
+
+    // Пока идёт последовательность, на выходах то старый, то новый кадр.
+    g_lastLatchedValid = false;
+    memcpy(g_dmaFinalWire, s.toWire, sizeof(g_dmaFinalWire));
+    ++g_busStats.dmaSequences;
+
+    dmaQueuedTarget_ = s.transitionTarget;
+    dmaQueuedTransitionId_ = s.transitionId;
+    dmaSequenceQueued_.store(true, std::memory_order_release);
+    fillDmaRing(nowMs);
+    return true;
+}
+
+bool Nixie6SpiDriver::queueDmaTransaction(uint8_t frameIdx, uint16_t lengthBytes) {
+    if (dmaInFlight_ >= DMA_RING_TRANSACTIONS) {
+        return false;
+    }
+    const int64_t traceStartUs = latchTraceStartUs();
+
+    // Транзакции завершаются по порядку, поэтому ячейка ringHead уже свободна.
+    spi_transaction_t& t = g_dmaTransactions[g_dmaSchedule.ringHead];
+    memset(&t, 0, sizeof(t));
+    t.length = static_cast<size_t>(lengthBytes) * 8U;
+    t.tx_buffer = g_dmaRunBuffers[frameIdx] + DMA_RUN_BUFFER_BYTES - lengthBytes;
+    if (spi_device_queue_trans(g_displayDmaDevice, &t, 0) != ESP_OK) {
+        return false;
+    }
+
+    g_dmaSchedule.ringHead = static_cast<uint16_t>((g_dmaSchedule.ringHead + 1U) % DMA_RING_TRANSACTIONS);
+    ++dmaInFlight_;
+    accountBusTransfer(lengthBytes, 1, busTimeUs(lengthBytes, DISPLAY_DMA_SPI_HZ));
+    if (g_latencyArmed && dmaInFlight_ == 1) {
+        // Очередь была пуста: защёлка произойдёт в конце этой транзакции.
+        closeLatencySample(static_cast<uint32_t>(esp_timer_get_time()) +
+                               busTimeUs(lengthBytes, DISPLAY_DMA_SPI_HZ),
+                           true);
+    }
+    traceLatch(g_dmaRunBuffers[frameIdx] + DMA_RUN_BUFFER_BYTES - 4, traceStartUs, true);
+    return true;
+}
+
+void Nixie6SpiDriver::fillDmaRing(uint32_t nowMs) {
+    DmaSchedule& d = g_dmaSchedule;
+    while (d.active) {
+        const uint16_t runBytes = static_cast<uint16_t>(d.runSlots * DMA_SLOT_BYTES);
+        if (d.nextSlot >= static_cast<int32_t>(d.engine.totalSlots)) {
+            // Финал: последняя серия доигрывается, затем защёлкивается новый кадр.
+            if (!queueDmaTransaction(1, runBytes)) {
+                break;
+            }
+            d.active = false;
+            g_dmaFinalQueued = true;
+            break;
+        }
+
+        if (!d.hasDecision) {
+            d.decision = d.engine.step(d.nextSlot) ? 1 : 0;
+            d.hasDecision = true;
+        }
+        if (d.decision == d.runFrame && d.runSlots < DMA_MAX_RUN_SLOTS) {
+            ++d.runSlots;
+            ++d.nextSlot;
+            d.hasDecision = false;
+            continue;
+        }
+
+        // Длина транзакции = время показа предыдущей серии, в конце — защёлка следующей.
+        if (!queueDmaTransaction(d.decision, runBytes)) {
+            break;
+        }
+        d.runFrame = d.decision;
+        d.runSlots = 1;
+        ++d.nextSlot;
+        d.hasDecision = false;
+    }
+
+    uint32_t wakeAtMs = 0;
+    if (d.active) {
+        // Поставленные транзакции покрывают время до начала текущей (ещё не закрытой) серии.
+        const int32_t coveredSlots = d.nextSlot - static_cast<int32_t>(d.runSlots);
+        const uint32_t coveredUntilMs =
+            d.startMs + static_cast<uint32_t>((coveredSlots * static_cast<int32_t>(TRANSITION_SLOT_US)) / 1000);
+        wakeAtMs = nowMs + static_cast<uint32_t>(static_cast<int32_t>(coveredUntilMs - nowMs) / 2);
+    } else {
+        wakeAtMs = d.startMs + (d.engine.totalSlots * TRANSITION_SLOT_US) / 1000UL + 1;
+    }
+    dmaWakeAtMs_.store(wakeAtMs, std::memory_order_relaxed);
+}
+
+void Nixie6SpiDriver::drainDmaTransactions() {
+    while (dmaInFlight_ > 0) {
+        spi_transaction_t* done = nullptr;
+        if (spi_device_get_trans_result(g_displayDmaDevice, &done, 0) != ESP_OK) {
+            break;
+        }
+        --dmaInFlight_;
+    }
+
+    if (dmaSequenceQueued_.load(std::memory_order_relaxed)) {
+        if (g_dmaSchedule.active) {
+            if (dmaInFlight_ == 0) {
+                // Кольцо опустело раньше дозаполнения: последняя серия показана дольше плана.
+                ++g_busStats.dmaUnderruns;
+            }
+            fillDmaRing(millis());
+        }
+        if (dmaInFlight_ > 0) {
+            return;
+        }
+
+        // Переход доигран до конца: писатель снимет transitionActive_ по совпадению id.
+        completedTransitionId_.store(dmaQueuedTransitionId_, std::memory_order_release);
+        dmaSequenceQueued_.store(false, std::memory_order_release);
+        if (g_dmaFinalQueued) {
+            rememberLatchedWire(g_dmaFinalWire);
+        }
+    }
 
-    return transitionActive_;
+    if (dmaInFlight_ > 0) {
+        return;
+    }
+
+    if (dmaPushPending_.load(std::memory_order_relaxed)) {
+        dmaPushPending_.store(false, std::memory_order_release);
+        shiftOut32(dmaPendingValue_);
+    }
 }
 
 uint8_t Nixie6SpiDriver::tens(uint8_t value) {
-    return (value / 10) % 10;
+    return static_cast<uint8_t>(kWirePairStd[value % 100] >> 4);
 }
 
 uint8_t Nixie6SpiDriver::ones(uint8_t value) {
-    return value % 10;
+    return static_cast<uint8_t>(kWirePairStd[value % 100] & 0x0FU);
 }
 
 Nixie6Frame Nixie6SpiDriver::buildTimeFrame() const {
@@ -508,9 +1409,9 @@ Nixie6Frame Nixie6SpiDriver::buildTimeFrameFromTm(const tm& sourceTm) const {
     // Для режима времени по умолчанию оба разделителя включены.
     f.startFlags = statusFlagsWithSeparators(true, true);
 
-    const uint8_t hour = static_cast<uint8_t>((sourceTm.tm_hour < 0) ? 0 : sourceTm.tm_hour % 24);
-    const uint8_t minute = static_cast<uint8_t>((sourceTm.tm_min < 0) ? 0 : sourceTm.tm_min % 60);
-    const uint8_t second = static_cast<uint8_t>((sourceTm.tm_sec < 0) ? 0 : sourceTm.tm_sec % 60);
+    const uint8_t hour = clampTmField(sourceTm.tm_hour, 24);
+    const uint8_t minute = clampTmField(sourceTm.tm_min, 60);
+    const uint8_t second = clampTmField(sourceTm.tm_sec, 60);
 
     // Стандартный порядок (режим 1):
     // ЧАС-МИН-СЕК + служебный байт (0x03)
@@ -648,6 +1549,7 @@ Nixie6Frame Nixie6SpiDriver::applyOutputMode(const Nixie6Frame& frame) const {
 }
 
 void Nixie6SpiDriver::maybeStartTimeTransition(const tm& previousTm, const tm& newTm, uint32_t nowMs) {
+    const uint16_t previousDurationMs = transitionDurationMs_;
     softTransitionEnabled_ = g_softTransitionEnabled;
     transitionDurationMs_ = g_transitionDurationMs;
 
@@ -677,31 +1579,79 @@ void Nixie6SpiDriver::maybeStartTimeTransition(const tm& previousTm, const tm& n
         return;
     }
 
-    transitionFrom_ = prevOut;
+    // Hold (п.6 плана): после перехода новый кадр держится holdMs, и только потом
+    // начинается следующий. Если следующий ещё ждёт своей очереди и не виден — меняем цель.
+    uint32_t startMs = nowMs;
+    bool retarget = false;
+    if (transitionId_ != 0) {
+        if (transitionActive_ && static_cast<int32_t>(transitionStartMs_ - nowMs) > 0) {
+            retarget = true;
+            startMs = transitionStartMs_;
+        } else {
+            const uint32_t holdEndMs = transitionStartMs_ + previousDurationMs + g_transitionHoldMs;
+            if (static_cast<int32_t>(holdEndMs - nowMs) > 0) {
+                startMs = holdEndMs;
+            }
+        }
+    }
+
     transitionTo_ = nextOut;
-    transitionStartMs_ = nowMs;
+
+    // Кадры перехода кэшируются сразу в формате шины: в слотах остаётся только копирование 4 байт.
+    const bool reverseInvert = isReverseBitsOutputMode();
+    const uint8_t flags = statusFlagsWithSeparators(true, true);
+    if (!retarget) {
+        encodeTimeWireBytes(clampTmField(previousTm.tm_hour, 24),
+                            clampTmField(previousTm.tm_min, 60),
+                            clampTmField(previousTm.tm_sec, 60),
+                            flags, reverseInvert, transitionFromWire_);
+    }
+    encodeTimeWireBytes(clampTmField(newTm.tm_hour, 24),
+                        clampTmField(newTm.tm_min, 60),
+                        clampTmField(newTm.tm_sec, 60),
+                        flags, reverseInvert, transitionToWire_);
+
+    transitionStartMs_ = startMs;
     transitionActive_ = true;
+    ++transitionId_;
 }
 
-Nixie6Frame Nixie6SpiDriver::frameForOutputNow(uint32_t nowMs) const {
-    if (!transitionActive_) {
-        return applyOutputMode(currentFrame());
+Nixie6View Nixie6SpiDriver::viewLocked() const {
+    if (editPlaceholder_) {
+        return Nixie6View::EditPlaceholder;
     }
 
-    const uint32_t elapsed = nowMs - transitionStartMs_;
-    if (elapsed >= transitionDurationMs_) {
-        // const-функция: возврат конечного кадра; сброс флага выполняется в push/service ниже
-        return transitionTo_;
+    if (secondaryBranchActive_) {
+        switch (auxMode_) {
+            case AuxMode::Pressure: return Nixie6View::Pressure;
+            case AuxMode::Humidity: return Nixie6View::Humidity;
+            case AuxMode::Temperature: return Nixie6View::Temperature;
+            default: return Nixie6View::Pressure;
+        }
     }
 
-    // Линейный рост доли нового кадра: 1/10 -> 10/10 за transitionDurationMs.
-    uint8_t newSlots = static_cast<uint8_t>(1 + (elapsed * (TRANSITION_SLOTS - 1)) / transitionDurationMs_);
-    if (newSlots > TRANSITION_SLOTS) {
-        newSlots = TRANSITION_SLOTS;
+    switch (mainMode_) {
+        case MainMode::Time: return Nixie6View::DefaultTime;
+        case MainMode::Date: return Nixie6View::Date;
+        case MainMode::Alarm1: return Nixie6View::Alarm1;
+        case MainMode::Alarm2: return Nixie6View::Alarm2;
+        default: return Nixie6View::DefaultTime;
     }
+}
 
-    const uint32_t slot = (micros() / TRANSITION_SLOT_US) % TRANSITION_SLOTS;
-    return (slot < newSlots) ? transitionTo_ : transitionFrom_;
+Nixie6Frame Nixie6SpiDriver::buildCurrentFrame() const {
+    switch (viewLocked()) {
+        case Nixie6View::DefaultTime: return buildTimeFrame();
+        case Nixie6View::Date: return buildDateFrame();
+        case Nixie6View::Alarm1: return buildAlarmFrame(al1Hour_, al1Minute_);
+        case Nixie6View::Alarm2: return buildAlarmFrame(al2Hour_, al2Minute_);
+        case Nixie6View::Pressure: return buildPressureFrame();
+        case Nixie6View::Humidity: return buildHumidityFrame();
+        case Nixie6View::Temperature: return buildTemperatureFrame();
+        case Nixie6View::EditPlaceholder:
+        default:
+            return secondaryBranchActive_ ? buildPressureFrame() : buildTimeFrame();
+    }
 }
 
 void Nixie6SpiDriver::writeBit(bool value) {
@@ -731,40 +1681,66 @@ uint8_t Nixie6SpiDriver::statusFlagsWithSeparators(bool showHmSeparator,
     return flags;
 }
 
+// shiftOut32()/shiftOutWire()/drain/startDma вызываются только под ScopedDisplayBusLock.
 void Nixie6SpiDriver::shiftOut32(uint32_t value) {
-    const bool reverseBitsInNibble =
-        (config.clock_type == CLOCK_TYPE_NIXIE && config.clock_digits == 6 &&
-         config.nix6_output_mode == NIX6_OUTPUT_REVERSE_INVERT);
+    if (g_displayDmaReady && dmaInFlight_ > 0) {
+        // Шина занята последовательностью перехода: кадр уйдёт сразу после неё.
+        dmaPendingValue_ = value;
+        dmaPushPending_.store(true, std::memory_order_release);
+        return;
+    }
 
-    if (USE_HARDWARE_SPI && g_displaySpiReady) {
-        // Порядок нибблов полностью повторяет текущий протокол bit-bang:
-        // n0..n5 (данные), затем n6..n7 (служебный байт).
-        // Сдвиги: 20,16,12,8,4,0,28,24
-        const int8_t nibbleShifts[8] = {20, 16, 12, 8, 4, 0, 28, 24};
-        uint8_t nibbles[8] = {0};
-        for (uint8_t i = 0; i < 8; ++i) {
-            uint8_t n = static_cast<uint8_t>((value >> nibbleShifts[i]) & 0x0FU);
-            if (reverseBitsInNibble) {
-                n = reverseNibbleBits(n);
-            }
-            nibbles[i] = n;
-        }
+    uint8_t tx[4];
+    encodeWireBytes(value, isReverseBitsOutputMode(), tx);
+    shiftOutWire(tx);
+}
+
+void Nixie6SpiDriver::shiftOutWire(const uint8_t* tx) {
+    if (g_displayDmaReady && dmaInFlight_ > 0) {
+        return;
+    }
+
+    ++g_busStats.pushes;
+    if (g_lastLatchedValid && memcmp(tx, g_lastLatchedWire, sizeof(g_lastLatchedWire)) == 0) {
+        // На выходах регистра уже этот кадр: ни байтов на шине, ни импульса LATCH.
+        ++g_busStats.skippedPushes;
+        return;
+    }
+    rememberLatchedWire(tx);
+    const int64_t traceStartUs = latchTraceStartUs();
+
+    if (g_displayDmaReady) {
+        // Здесь LATCH = аппаратный CS: подъём в конце транзакции. Старт выбирается по известной
+        // фазе PWM так, чтобы конец 32 бит пришёлся на окно гашения.
+        waitDisplayBlankWindow(busTimeUs(4, DISPLAY_DMA_SPI_HZ));
+        spi_transaction_t t = {};
+        t.flags = SPI_TRANS_USE_TXDATA;
+        t.length = 32;
+        memcpy(t.tx_data, tx, 4);
+        spi_device_polling_transmit(g_displayDmaDevice, &t);
+        accountBusTransfer(4, 1, busTimeUs(4, DISPLAY_DMA_SPI_HZ));
+        closeLatencySample(static_cast<uint32_t>(esp_timer_get_time()), false);
+        traceLatch(tx, traceStartUs, false);
+        return;
+    }
 
-        uint8_t tx[4] = {
-            static_cast<uint8_t>((nibbles[0] << 4) | nibbles[1]),
-            static_cast<uint8_t>((nibbles[2] << 4) | nibbles[3]),
-            static_cast<uint8_t>((nibbles[4] << 4) | nibbles[5]),
-            static_cast<uint8_t>((nibbles[6] << 4) | nibbles[7])
-        };
+    if (USE_HARDWARE_SPI && g_displaySpiReady) {
+        uint8_t buf[4];
+        memcpy(buf, tx, sizeof(buf));  // SPIClass::transfer() перезаписывает буфер принятыми данными
 
         g_displaySpi.beginTransaction(SPISettings(DISPLAY_SPI_HZ, MSBFIRST, SPI_MODE0));
         digitalWrite(latchPin_, LOW);
-        g_displaySpi.transfer(tx, sizeof(tx));
+        g_displaySpi.transfer(buf, sizeof(buf));
         digitalWrite(mosiPin_, LOW);
+        // Защёлкиваем только в окне гашения PWM (OE=OFF), чтобы не было разрыва кадра.
+        waitDisplayBlankWindow();
         digitalWrite(latchPin_, HIGH);
         delayMicroseconds(LATCH_PULSE_US);
         digitalWrite(latchPin_, LOW);
         g_displaySpi.endTransaction();
+        accountBusTransfer(4, 1, busTimeUs(4, DISPLAY_SPI_HZ));
+        closeLatencySample(static_cast<uint32_t>(esp_timer_get_time()), false);
+        traceLatch(tx, traceStartUs, false);
         return;
     }
 
@@ -775,38 +1751,22 @@ void Nixie6SpiDriver::shiftOut32(uint32_t value) {
     digitalWrite(latchPin_, LOW);
     digitalWrite(sckPin_, LOW);
 
-    // Передаём сначала 24 бита данных (6 нибблов),
-    // а служебный байт (startFlags, включая 0x03) — последним.
-    // Режим 1: прямые биты (b3..b0), режим 2: обратные биты (b0..b3).
-    auto writeNibbleByMode = [this, reverseBitsInNibble](uint8_t nibble) {
-        if (reverseBitsInNibble) {
-            for (uint8_t bit = 0; bit < 4; ++bit) {
-                const bool b = ((nibble >> bit) & 0x1U) != 0;
-                writeBit(b);
-            }
-            return;
-        }
-
-        for (int8_t bit = 3; bit >= 0; --bit) {
-            const bool b = ((nibble >> bit) & 0x1U) != 0;
-            writeBit(b);
+    // Сначала 24 бита данных (6 нибблов), служебный байт (startFlags) — последним.
+    // Обращение битов для режима 2 уже заложено в таблицы кодирования: всегда MSB first.
+    for (uint8_t i = 0; i < 4; ++i) {
+        for (int8_t bit = 7; bit >= 0; --bit) {
+            writeBit(((tx[i] >> bit) & 0x1U) != 0);
         }
-    };
-
-    // 6 нибблов данных: bits [23:0]
-    for (int8_t shift = 20; shift >= 0; shift -= 4) {
-        writeNibbleByMode(static_cast<uint8_t>((value >> shift) & 0x0FU));
-    }
-
-    // 2 ниббла служебного байта: bits [31:24]
-    for (int8_t shift = 28; shift >= 24; shift -= 4) {
-        writeNibbleByMode(static_cast<uint8_t>((value >> shift) & 0x0FU));
     }
 
     digitalWrite(mosiPin_, LOW);
 
-    // Импульс фиксации (LATCH) длительностью 2 мкс
+    // Импульс фиксации (LATCH) длительностью 2 мкс — в окне гашения PWM
+    waitDisplayBlankWindow();
     digitalWrite(latchPin_, HIGH);
     delayMicroseconds(LATCH_PULSE_US);
     digitalWrite(latchPin_, LOW);
+    accountBusTransfer(4, 1, 32U * (DATA_SETUP_US + SCK_HIGH_US));
+    closeLatencySample(static_cast<uint32_t>(esp_timer_get_time()), false);
+    traceLatch(tx, traceStartUs, false);
 }
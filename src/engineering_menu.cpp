@@ -108,7 +108,11 @@ static void printHardwareMenu() {
     const bool nixieClockType = (config.clock_type == CLOCK_TYPE_NIXIE ||
                                  config.clock_type == CLOCK_TYPE_NIXIE_HAND);
     if (nixieClockType) {
-        Serial.printf("\n║ Мягкая смена цифр: %s", nixie6IsSoftTransitionEnabled() ? "Вкл" : "Выкл");
+        Serial.printf("\n║ Мягкая смена цифр: %s (%u мс, gamma %.1f, hold %u мс)",
+                      nixie6IsSoftTransitionEnabled() ? "Вкл" : "Выкл",
+                      static_cast<unsigned>(nixie6GetTransitionDurationMs()),
+                      nixie6GetTransitionGamma(),
+                      static_cast<unsigned>(nixie6GetTransitionHoldMs()));
     } else {
         Serial.printf("\n║ Мягкая смена цифр: Недоступно");
     }
@@ -125,6 +129,7 @@ static void printHardwareMenu() {
     Serial.println("8  IR <1/0>      - Наличие датчика движения");
     Serial.println("9  Light sens cal- Калибровка датчика освещения");
     Serial.println("10 disp fx on|off- эффект мягкой смены цифр (только NIXIE clock)");
+    Serial.println("   disp fx dur <40-500> / gamma <1.0-3.0> / hold <0-100> - параметры эффекта");
     printEngineeringSubmenuNavigation();
     Serial.print("> ");
 }
@@ -153,14 +158,11 @@ static void printNix6OutputMenu() {
 }
 
 static uint32_t getCurrentLocalDateYmd() {
-    time_t nowUtc = getCurrentUTCTime();
-    if (nowUtc == 0) {
+    const TimeSnapshot now = getTimeSnapshot();
+    if (now.utc == 0) {
         return 0;
     }
-
-    time_t local = utcToLocal(nowUtc);
-    struct tm tmLocal;
-    gmtime_r(&local, &tmLocal);
+    const tm& tmLocal = now.localTm;
 
     const uint32_t y = static_cast<uint32_t>(tmLocal.tm_year + 1900);
     const uint32_t m = static_cast<uint32_t>(tmLocal.tm_mon + 1);
@@ -395,6 +397,30 @@ static bool handleHardwareMenu(const String &command) {
         return true;
     }
 
+    if (cmd.startsWith("disp fx dur ") || cmd.startsWith("disp fx gamma ") || cmd.startsWith("disp fx hold ")) {
+        const int sep = cmd.lastIndexOf(' ');
+        const String arg = cmd.substring(sep + 1);
+        if (arg.length() == 0 || !isDigit(arg.charAt(0))) {
+            Serial.println("\n[DISP][FX] Ошибка: ожидается число");
+            Serial.print("> ");
+            return true;
+        }
+
+        if (cmd.startsWith("disp fx dur ")) {
+            nixie6SetTransitionDurationMs(static_cast<uint16_t>(arg.toInt()));
+        } else if (cmd.startsWith("disp fx gamma ")) {
+            nixie6SetTransitionGamma(arg.toFloat());
+        } else {
+            nixie6SetTransitionHoldMs(static_cast<uint16_t>(arg.toInt()));
+        }
+        Serial.printf("\n[DISP][FX] dur=%u мс, gamma=%.2f, hold=%u мс\n",
+                      static_cast<unsigned>(nixie6GetTransitionDurationMs()),
+                      nixie6GetTransitionGamma(),
+                      static_cast<unsigned>(nixie6GetTransitionHoldMs()));
+        Serial.print("> ");
+        return true;
+    }
+
     if (cmd.equals("disp fx on") || cmd.equals("disp fx off") || cmd.startsWith("10 ")) {
         bool parsed = false;
         bool enable = false;
@@ -2,6 +2,8 @@
 #include "config.h"
 
 #include <math.h>
+#include <driver/ledc.h>
+#include <esp_timer.h>
 
 // Инициализация объектов
 ESP32Encoder encoder;
@@ -11,12 +13,75 @@ portMUX_TYPE timerMux = portMUX_INITIALIZER_UNLOCKED;
 HardwareSource currentTimeSource = INTERNAL_RTC;
 bool ds3231_available = false;
 volatile bool timeUpdatedFromSQW = false;
+volatile uint32_t sqwEdgeMicros = 0;
+static volatile TaskHandle_t sqwTickTaskHandle = nullptr;
 static bool sqwInterruptAttached = false;
 static bool displayOutputEnabled = true;
 
 static constexpr uint8_t SR595_OE_ACTIVE_LEVEL = LOW;
 static constexpr uint8_t SR595_OE_INACTIVE_LEVEL = HIGH;
 
+// Аппаратный PWM яркости (layer A из DISPLAY_PWM_TRANSITION_PLAN.md).
+// 20 кГц: период 50 мкс, слот soft-transition 400 мкс = ровно 8 периодов PWM.
+// OE активен по LOW, поэтому duty (доля HIGH) = доля гашения = max - яркость.
+static constexpr uint32_t SR595_OE_PWM_HZ = 20000;
+static constexpr uint32_t SR595_OE_PWM_PERIOD_US = 1000000UL / SR595_OE_PWM_HZ;
+static constexpr uint32_t SR595_OE_LATCH_GUARD_US = 2;  // LATCH не ближе 2 мкс к концу окна гашения
+static constexpr ledc_timer_bit_t SR595_OE_PWM_RES = LEDC_TIMER_10_BIT;
+static constexpr uint32_t SR595_OE_PWM_MAX_DUTY = (1UL << 10) - 1;
+static constexpr ledc_mode_t SR595_OE_PWM_MODE = LEDC_LOW_SPEED_MODE;
+static constexpr ledc_timer_t SR595_OE_PWM_TIMER = LEDC_TIMER_1;
+static constexpr ledc_channel_t SR595_OE_PWM_CHANNEL = LEDC_CHANNEL_7;  // каналы 0.. оставляем Arduino ledc*
+static bool displayOePwmReady = false;
+static uint8_t displayPwmLevel = 255;
+// esp_timer в момент сброса счётчика таймера LEDC. hpoint = 0: окно гашения (OE = HIGH)
+// начинается в каждом периоде с нуля счётчика. LEDC и esp_timer тактуются от одного
+// кварца, а 80 МГц / (20 кГц * 1024) делится дробным делителем LEDC точно — фаза не уходит.
+static int64_t displayOePwmStartUs = 0;
+
+static bool initDisplayOePwm() {
+    ledc_timer_config_t timerCfg = {};
+    timerCfg.speed_mode = SR595_OE_PWM_MODE;
+    timerCfg.duty_resolution = SR595_OE_PWM_RES;
+    timerCfg.timer_num = SR595_OE_PWM_TIMER;
+    timerCfg.freq_hz = SR595_OE_PWM_HZ;
+    timerCfg.clk_cfg = LEDC_AUTO_CLK;
+    if (ledc_timer_config(&timerCfg) != ESP_OK) {
+        return false;
+    }
+
+    ledc_channel_config_t channelCfg = {};
+    channelCfg.gpio_num = SR595_OE_PIN;
+    channelCfg.speed_mode = SR595_OE_PWM_MODE;
+    channelCfg.channel = SR595_OE_PWM_CHANNEL;
+    channelCfg.intr_type = LEDC_INTR_DISABLE;
+    channelCfg.timer_sel = SR595_OE_PWM_TIMER;
+    channelCfg.duty = 0;  // 100% яркости до первого setDisplayPwmLevel()
+    channelCfg.hpoint = 0;
+    if (ledc_channel_config(&channelCfg) != ESP_OK) {
+        return false;
+    }
+
+    // Начало периода PWM фиксируем сбросом счётчика: дальше фаза OE известна без чтения GPIO.
+    if (ledc_timer_rst(SR595_OE_PWM_MODE, SR595_OE_PWM_TIMER) != ESP_OK) {
+        return false;
+    }
+    displayOePwmStartUs = esp_timer_get_time();
+    return true;
+}
+
+static void applyDisplayOeDuty() {
+    if (!displayOePwmReady) {
+        digitalWrite(SR595_OE_PIN, displayOutputEnabled ? SR595_OE_ACTIVE_LEVEL : SR595_OE_INACTIVE_LEVEL);
+        return;
+    }
+
+    const uint32_t onDuty = (static_cast<uint32_t>(displayPwmLevel) * SR595_OE_PWM_MAX_DUTY) / 255U;
+    const uint32_t blankDuty = displayOutputEnabled ? (SR595_OE_PWM_MAX_DUTY - onDuty) : (SR595_OE_PWM_MAX_DUTY + 1);
+    ledc_set_duty(SR595_OE_PWM_MODE, SR595_OE_PWM_CHANNEL, blankDuty);
+    ledc_update_duty(SR595_OE_PWM_MODE, SR595_OE_PWM_CHANNEL);
+}
+
 void initHardware() {
 // Настройка пинов Энкодера и кнопок
     pinMode(ENC_A, INPUT_PULLUP);
@@ -35,6 +100,7 @@ void initHardware() {
     digitalWrite(SR595_LATCH_PIN, LOW);
     digitalWrite(SR595_OE_PIN, SR595_OE_ACTIVE_LEVEL);
     displayOutputEnabled = true;
+    displayOePwmReady = initDisplayOePwm();
 
     // Инициализация энкодера
     encoder.attachSingleEdge(ENC_A, ENC_B);
@@ -47,13 +113,53 @@ void initHardware() {
 
 void setDisplayOutputEnabled(bool enabled) {
     displayOutputEnabled = enabled;
-    digitalWrite(SR595_OE_PIN, enabled ? SR595_OE_ACTIVE_LEVEL : SR595_OE_INACTIVE_LEVEL);
+    applyDisplayOeDuty();
 }
 
 bool isDisplayOutputEnabled() {
     return displayOutputEnabled;
 }
 
+void setDisplayPwmLevel(uint8_t level) {
+    if (level == displayPwmLevel) {
+        return;
+    }
+    displayPwmLevel = level;
+    if (displayOutputEnabled) {
+        applyDisplayOeDuty();
+    }
+}
+
+uint8_t getDisplayPwmLevel() {
+    return displayPwmLevel;
+}
+
+bool isDisplayOePwmActive() {
+    return displayOePwmReady;
+}
+
+void waitDisplayBlankWindow(uint32_t leadUs) {
+    // Без PWM, на 100% яркости или при погашенном дисплее окна гашения нет/ждать нечего.
+    if (!displayOePwmReady || !displayOutputEnabled || displayPwmLevel == 255) {
+        return;
+    }
+
+    // Фаза периода PWM в момент защёлки (через leadUs) — по времени от сброса таймера LEDC.
+    const uint32_t onDuty = (static_cast<uint32_t>(displayPwmLevel) * SR595_OE_PWM_MAX_DUTY) / 255U;
+    const uint32_t blankUs = ((SR595_OE_PWM_MAX_DUTY - onDuty) * SR595_OE_PWM_PERIOD_US) / (SR595_OE_PWM_MAX_DUTY + 1);
+    const int64_t nowUs = esp_timer_get_time();
+    const uint32_t phaseUs =
+        static_cast<uint32_t>((nowUs + leadUs - displayOePwmStartUs) % SR595_OE_PWM_PERIOD_US);
+    if (phaseUs + SR595_OE_LATCH_GUARD_US <= blankUs) {
+        return;  // защёлка и так попадает в окно гашения
+    }
+
+    // Ожидание до начала следующего окна: не больше периода минус окно, без опроса GPIO.
+    const int64_t untilUs = nowUs + (SR595_OE_PWM_PERIOD_US - phaseUs);
+    while (esp_timer_get_time() < untilUs) {
+    }
+}
+
 uint16_t readLightSensorFiltered(uint8_t samples, uint8_t adcResolutionBits) {
     (void)samples;
     (void)adcResolutionBits;
@@ -69,7 +175,22 @@ uint16_t readLightSensorFiltered(uint8_t samples, uint8_t adcResolutionBits) {
 }
 
 void IRAM_ATTR onSQWInterrupt() {
+    sqwEdgeMicros = micros();
     timeUpdatedFromSQW = true;
+
+    // Задача секундного тика будится прямо отсюда: кадр меняется без ожидания прохода loop().
+    TaskHandle_t tickTask = sqwTickTaskHandle;
+    if (tickTask != nullptr) {
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+        vTaskNotifyGiveFromISR(tickTask, &higherPriorityTaskWoken);
+        if (higherPriorityTaskWoken == pdTRUE) {
+            portYIELD_FROM_ISR();
+        }
+    }
+}
+
+void setSqwTickTaskHandle(TaskHandle_t task) {
+    sqwTickTaskHandle = task;
 }
 
 void setupInterrupts() {
@@ -119,6 +240,61 @@ float getDS3231Temperature() {
     }
 }
 
+// Регистр Aging Offset (0x10): знаковый, 1 LSB ≈ 0.1 ppm при 25°C, >0 — генератор медленнее.
+// RTClib его не знает, поэтому обращаемся к DS3231 через Wire напрямую.
+static constexpr uint8_t DS3231_I2C_ADDR = 0x68;
+static constexpr uint8_t DS3231_REG_CONTROL = 0x0E;
+static constexpr uint8_t DS3231_REG_AGING = 0x10;
+static constexpr uint8_t DS3231_CONTROL_CONV = 0x20;
+
+static bool ds3231ReadRegister(uint8_t reg, uint8_t& value) {
+    Wire.beginTransmission(DS3231_I2C_ADDR);
+    Wire.write(reg);
+    if (Wire.endTransmission(false) != 0) {
+        return false;
+    }
+    if (Wire.requestFrom(static_cast<uint8_t>(DS3231_I2C_ADDR), static_cast<uint8_t>(1)) != 1) {
+        return false;
+    }
+    value = static_cast<uint8_t>(Wire.read());
+    return true;
+}
+
+static bool ds3231WriteRegister(uint8_t reg, uint8_t value) {
+    Wire.beginTransmission(DS3231_I2C_ADDR);
+    Wire.write(reg);
+    Wire.write(value);
+    return Wire.endTransmission() == 0;
+}
+
+bool ds3231ReadAgingOffset(int8_t& aging) {
+    if (!rtc || !ds3231_available) {
+        return false;
+    }
+    uint8_t raw = 0;
+    if (!ds3231ReadRegister(DS3231_REG_AGING, raw)) {
+        return false;
+    }
+    aging = static_cast<int8_t>(raw);
+    return true;
+}
+
+bool ds3231WriteAgingOffset(int8_t aging) {
+    if (!rtc || !ds3231_available) {
+        return false;
+    }
+    if (!ds3231WriteRegister(DS3231_REG_AGING, static_cast<uint8_t>(aging))) {
+        return false;
+    }
+    // Новое значение применяется при следующем пересчёте температуры (раз в 64 с) —
+    // запускаем пересчёт сразу.
+    uint8_t control = 0;
+    if (ds3231ReadRegister(DS3231_REG_CONTROL, control) && (control & DS3231_CONTROL_CONV) == 0) {
+        ds3231WriteRegister(DS3231_REG_CONTROL, static_cast<uint8_t>(control | DS3231_CONTROL_CONV));
+    }
+    return true;
+}
+
 // Форматированный вывод
 void printDS3231Temperature() {
     if (!ds3231_available) {
@@ -13,6 +13,7 @@
 #include "input_handler.h"
 #include "platform_profile.h"
 #include "runtime_counter.h"
+#include "rtc_discipline.h"
 #include <esp_system.h>
 
 static bool sqwFailed = false;
@@ -20,6 +21,49 @@ extern bool printEnabled;
 static DisplayManager displayManager;
 static bool displayEditMode = false;
 static TaskHandle_t g_displayRefreshTaskHandle = nullptr;
+
+// Секундный тик разделён на две части:
+// - коммит кадра (UTC + 1, перевод в локальное, вывод на индикацию) — в задаче sec_tick,
+//   которую будит прямо ISR SQW; от фронта до смены цифр — десятки мкс, а не 0..20+ мс loop();
+// - всё остальное (лог, бой, будильники, сверка с RTC, sync) — отложено в loop() через очередь.
+struct SecondTickCommit {
+    time_t utc = 0;
+    uint32_t seconds = 1;  // сколько секунд прошло с прошлого коммита (фронты, накопленные за время блокировки)
+    tm local{};
+    bool displayActiveByScheduleNow = false;
+    bool overrideWasActive = false;
+    bool displayActiveNow = false;
+};
+static TaskHandle_t g_secondTickTaskHandle = nullptr;
+static QueueHandle_t g_secondTickQueue = nullptr;
+static SemaphoreHandle_t g_secondTickMutex = nullptr;  // коммит из sec_tick и из loop (fallback/команды)
+static constexpr UBaseType_t SECOND_TICK_QUEUE_LENGTH = 8;
+static constexpr UBaseType_t SECOND_TICK_TASK_PRIO = 3;  // выше disp_refresh (2)
+static uint32_t g_secondTickQueueDrops = 0;
+// Пропуск больше минуты (или назад) считается переводом часов, а не пропущенными тиками.
+static constexpr time_t SECOND_TICK_MAX_CATCH_UP_SEC = 60;
+static time_t g_lastCommittedTickUtc = 0;  // под g_secondTickMutex
+static bool g_displayBenchRunning = false;  // под g_secondTickMutex: кадры выводит disp bench, коммит секунд отложен
+
+// У DisplayManager своего замка нет: всё, что loop() в нём меняет (сон, антиотравление,
+// экраны, яркость), идёт под тем же мьютексом, что и кадр секунды в commitSecondTick().
+// До создания мьютекса (ранний setup) - без блокировки: sec_tick ещё не запущен.
+class ScopedSecondTickLock {
+public:
+    ScopedSecondTickLock()
+        : locked_(g_secondTickMutex != nullptr && xSemaphoreTake(g_secondTickMutex, portMAX_DELAY) == pdTRUE) {}
+    ~ScopedSecondTickLock() {
+        if (locked_) {
+            xSemaphoreGive(g_secondTickMutex);
+        }
+    }
+    ScopedSecondTickLock(const ScopedSecondTickLock&) = delete;
+    ScopedSecondTickLock& operator=(const ScopedSecondTickLock&) = delete;
+
+private:
+    bool locked_;
+};
+
 static volatile bool g_powerFailDetected = false;
 static volatile bool g_powerFailIrqPending = false;
 static volatile uint32_t g_powerFailIrqMicros = 0;
@@ -41,6 +85,7 @@ static void onOtaTransferStartDisplayMarker() {
     }
 
     setDisplayOutputEnabled(true);
+    ScopedSecondTickLock lock;
     displayManager.showOtaTransferStartMarker();
 }
 
@@ -71,31 +116,28 @@ static void displayRefreshTask(void* param) {
 
         // 2) Во время sync подстраховываем периодический апдейт времени,
         // чтобы индикация не "подвисала" из-за сетевой активности.
-        if (isSyncInProgress() && isDisplayOutputEnabled() && !isAntiPoisonActive()) {
-            const time_t utcNow = getCurrentUTCTime();
-            const time_t localNow = utcToLocal(utcNow);
-            tm localTm{};
-            gmtime_r(&localNow, &localTm);
-
-            displayManager.updateFromLocalTime(localTm,
-                                               nowMs,
-                                               config.alarm1.hour, config.alarm1.minute,
-                                               config.alarm2.hour, config.alarm2.minute);
-            if (displayManager.hasActiveAnimation()) {
-                vTaskDelay(pdMS_TO_TICKS(1));
-            } else {
-                vTaskDelay(pdMS_TO_TICKS(20));
+        if (isSyncInProgress() && isDisplayOutputEnabled()) {
+            const TimeSnapshot now = getTimeSnapshot();
+            {
+                // Проверка антиотравления и кадр - под мьютексом тика, как в commitSecondTick()
+                ScopedSecondTickLock lock;
+                if (!isAntiPoisonActive()) {
+                    displayManager.updateFromLocalTime(now.localTm,
+                                                       nowMs,
+                                                       config.alarm1.hour, config.alarm1.minute,
+                                                       config.alarm2.hour, config.alarm2.minute);
+                }
             }
+            const uint32_t serviceMs = displayManager.animationServiceIntervalMs(millis());
+            vTaskDelay(pdMS_TO_TICKS(serviceMs > 0 ? serviceMs : 20));
             continue;
         }
 
-        // 3) В обычном режиме: если есть активная анимация — держим >=1кГц сервис,
+        // 3) В обычном режиме: если есть активная анимация — сервис с периодом,
+        // который запросил backend (дозаполнение кольца DMA / конец перехода, 1 мс без таймера),
         // иначе спим дольше для экономии CPU.
-        if (displayManager.hasActiveAnimation()) {
-            vTaskDelay(pdMS_TO_TICKS(1));
-        } else {
-            vTaskDelay(pdMS_TO_TICKS(20));
-        }
+        const uint32_t serviceMs = displayManager.animationServiceIntervalMs(millis());
+        vTaskDelay(pdMS_TO_TICKS(serviceMs > 0 ? serviceMs : 20));
     }
 }
 
@@ -117,23 +159,23 @@ static const char* resetReasonText(esp_reset_reason_t reason) {
 }
 
 static void stopCathodesAntiPoisonProcedure(const char* reason = nullptr) {
-    if (!displayManager.isAntiPoisonActive()) {
-        return;
+    {
+        ScopedSecondTickLock lock;
+        if (!displayManager.isAntiPoisonActive()) {
+            return;
+        }
+        displayManager.stopAntiPoison();
     }
 
-    displayManager.stopAntiPoison();
-
     if (reason && reason[0] != '\0') {
         Serial.printf("[ANTIPOISON] Остановлено: %s\n", reason);
     }
 }
 
 static void triggerDisplaySleepOverrideIfNeeded() {
-    const time_t utcNow = getCurrentUTCTime();
-    const time_t localNow = utcToLocal(utcNow);
-    tm localTm{};
-    gmtime_r(&localNow, &localTm);
+    const tm localTm = getTimeSnapshot().localTm;
 
+    ScopedSecondTickLock lock;
     if (!displayManager.isSleepOverrideActive() && !displayManager.isDisplayActiveBySchedule(localTm)) {
         displayManager.triggerSleepOverrideIfNeeded(localTm);
         Serial.print("\n[DISP] Ручная активация: выход из текущего цикла гашения");
@@ -141,10 +183,7 @@ static void triggerDisplaySleepOverrideIfNeeded() {
 }
 
 static void printRuntimeStateSnapshot() {
-    const time_t utcNow = getCurrentUTCTime();
-    const time_t localNow = utcToLocal(utcNow);
-    tm localTm{};
-    gmtime_r(&localNow, &localTm);
+    const tm localTm = getTimeSnapshot().localTm;
 
     const bool displayActiveNow = displayManager.isDisplayActiveNow(localTm);
     const bool bellEnabled = bellSchedulerIsEnabled();
@@ -185,7 +224,12 @@ static bool isAntiPoisonActive() {
 }
 
 static bool startCathodesAntiPoisonProcedure() {
-    const bool started = displayManager.startAntiPoison();
+    bool started = false;
+    {
+        // Под мьютексом тика: кадр секунды либо уже выведен, либо увидит запущенный цикл
+        ScopedSecondTickLock lock;
+        started = displayManager.startAntiPoison();
+    }
     if (started) {
         Serial.println("Kathodes anti-poison procedure started");
     }
@@ -193,15 +237,14 @@ static bool startCathodesAntiPoisonProcedure() {
 }
 
 static bool ensureDisplayActiveForManualAntiPoison() {
-    const time_t utcNow = getCurrentUTCTime();
-    const time_t localNow = utcToLocal(utcNow);
-    tm localTm{};
-    gmtime_r(&localNow, &localTm);
+    const tm localTm = getTimeSnapshot().localTm;
 
-    const bool displayActiveNow = displayManager.isDisplayActiveNow(localTm);
-    if (!displayActiveNow) {
-        displayManager.triggerSleepOverrideIfNeeded(localTm);
-        Serial.println("[ANTIPOISON] Ручной запуск: выхожу из режима гашения дисплея");
+    {
+        ScopedSecondTickLock lock;
+        if (!displayManager.isDisplayActiveNow(localTm)) {
+            displayManager.triggerSleepOverrideIfNeeded(localTm);
+            Serial.println("[ANTIPOISON] Ручной запуск: выхожу из режима гашения дисплея");
+        }
     }
 
     if (!isDisplayOutputEnabled()) {
@@ -212,12 +255,16 @@ static bool ensureDisplayActiveForManualAntiPoison() {
 }
 
 static void serviceCathodesAntiPoisonProcedure(uint32_t nowMs) {
-    if (!displayManager.isAntiPoisonActive()) {
-        return;
+    bool ended = false;
+    {
+        ScopedSecondTickLock lock;
+        if (!displayManager.isAntiPoisonActive()) {
+            return;
+        }
+        displayManager.serviceAntiPoison(nowMs);
+        ended = !displayManager.isAntiPoisonActive();
     }
-
-    displayManager.serviceAntiPoison(nowMs);
-    if (!displayManager.isAntiPoisonActive()) {
+    if (ended) {
         Serial.println("Kathodes anti-poison procedure ended");
     }
 }
@@ -236,38 +283,61 @@ void runAntiPoisonNow() {
     }
 }
 
-void processSecondTick();
-
-static void processSecondTicksByMillis(unsigned long currentMillis, unsigned long& lastSecondCheck) {
-    if (lastSecondCheck == 0) {
-        lastSecondCheck = currentMillis;
+void runDisplayBenchNow(uint16_t ticks) {
+    if (!displayManager.supportsSoftTransition()) {
+        Serial.println("[DISP][BENCH] Пропущено: доступно только для Nixie 6");
         return;
     }
-
-    const unsigned long elapsed = currentMillis - lastSecondCheck;
-    if (elapsed < 1000) {
+    if (otaIsBusy() || isSyncInProgress() || isAntiPoisonActive()) {
+        Serial.println("[DISP][BENCH] Пропущено: идёт OTA/синхронизация/антиотравление");
+        return;
+    }
+    if (!isDisplayOutputEnabled() || !displayManager.isTimeViewActive()) {
+        // Вне time view disp_refresh гасит переходы — прогон показал бы только конечные кадры.
+        Serial.println("[DISP][BENCH] Пропущено: индикация погашена или открыт не экран времени");
         return;
     }
 
-    uint32_t ticksToRun = elapsed / 1000;
-    if (ticksToRun > 1) {
-        // Если пропущены секунды, берём опорное время заново из активного источника.
-        requestTimeTickResync();
+    // Пока идёт прогон, sec_tick не перетирает кадры: опору по SQW он двигает как обычно,
+    // а коммит секунд откладывает — первый тик после прогона учтёт накопленные секунды разом.
+    // Мьютекс берётся только на переключение флага: уже начатый коммит тика успевает завершиться.
+    if (g_secondTickMutex == nullptr || xSemaphoreTake(g_secondTickMutex, portMAX_DELAY) != pdTRUE) {
+        return;
     }
+    g_displayBenchRunning = true;
+    xSemaphoreGive(g_secondTickMutex);
 
-    const uint32_t maxCatchUpTicks = 8;
-    if (ticksToRun > maxCatchUpTicks) {
-        ticksToRun = maxCatchUpTicks;
+    const time_t localNow = getTimeSnapshot().local;
+    if (!displayManager.runLatchBench(localNow, ticks)) {
+        Serial.println("[DISP][BENCH] Не удалось запустить (нет памяти под трассу)");
     }
 
-    for (uint32_t i = 0; i < ticksToRun; ++i) {
-        processSecondTick();
+    // Вернуть на индикацию реальное время, не дожидаясь следующего тика.
+    if (xSemaphoreTake(g_secondTickMutex, portMAX_DELAY) == pdTRUE) {
+        g_displayBenchRunning = false;
+        const TimeSnapshot after = getTimeSnapshot();
+        displayManager.updateFromLocalTime(after.localTm, millis(),
+                                           config.alarm1.hour, config.alarm1.minute,
+                                           config.alarm2.hour, config.alarm2.minute);
+        xSemaphoreGive(g_secondTickMutex);
     }
+}
 
-    lastSecondCheck += ticksToRun * 1000;
-    if (currentMillis - lastSecondCheck > 5000) {
-        lastSecondCheck = currentMillis;
+void processSecondTick();
+static void processSecondTickFrom(uint32_t sqwEdgeUs);
+static bool startSecondTickTask();
+static void drainDeferredSecondTicks();
+
+// Тик без SQW: секунда наступила, когда сменилась целая секунда часов UTC. Пропущенные
+// секунды (долгий handleCommand и т.п.) досчитывает commitSecondTick() по тем же часам.
+static void processSecondTicksByClock() {
+    static time_t lastPolledUtc = 0;
+    const time_t nowUtc = static_cast<time_t>(getCurrentUTCTimeUs() / 1000000LL);
+    if (nowUtc == lastPolledUtc) {
+        return;
     }
+    lastPolledUtc = nowUtc;
+    processSecondTick();
 }
 
 static void handleDisplayButtonAction(uint8_t buttonEvent) {
@@ -280,6 +350,7 @@ static void handleDisplayButtonAction(uint8_t buttonEvent) {
         return;
     }
 
+    ScopedSecondTickLock lock;
     switch (buttonEvent) {
         case BUTTON_PRESSED:
             displayManager.handleAction(DisplayAction::NextMainView);
@@ -339,6 +410,7 @@ static void onEncoderEvent(int32_t delta, int32_t position) {
         return;
     }
 
+    ScopedSecondTickLock lock;
     if (delta > 0) {
         displayManager.handleAction(DisplayAction::NextMainView);
     } else if (delta < 0) {
@@ -357,6 +429,7 @@ void setup() {
     displayManager.begin();
     initNTPClient();
     checkTimeSource(); 
+    rtcDisciplineInit();
     printDS3231Temperature();
     printESP32Temperature();
 
@@ -393,6 +466,15 @@ void setup() {
         }
     }
 
+    if (g_secondTickMutex == nullptr) {
+        g_secondTickMutex = xSemaphoreCreateMutex();
+    }
+    if (startSecondTickTask()) {
+        Serial.println("\n[TICK] Second tick task started (core=1, prio=3, SQW notify)");
+    } else {
+        Serial.println("\n[TICK][WARN] Failed to start second tick task, ticks stay in loop()");
+    }
+
         printRuntimeStateSnapshot();
     
     // Асинхронная синхронизация - не блокирует setup()
@@ -411,7 +493,6 @@ void setup() {
 }
 
 void loop() {
-    static unsigned long lastSecondCheck = 0;
     static unsigned long lastSQWCheck = 0;
     static bool sqwMonitorArmed = false;
     unsigned long currentMillis = millis();
@@ -473,6 +554,11 @@ void loop() {
         serviceCathodesAntiPoisonProcedure(currentMillis);
     }
     chimeSchedulerService();
+    {
+        ScopedSecondTickLock lock;
+        displayManager.serviceBrightness(currentMillis);
+    }
+    serviceTimeSourceHealth(currentMillis);
  
     // === ОБРАБОТКА СЕКУНДНЫХ СОБЫТИЙ ===
     // Работает всегда, чтобы индикация на дисплее оставалась актуальной и в меню.
@@ -489,29 +575,31 @@ void loop() {
         if (timeUpdatedFromSQW) {
             portENTER_CRITICAL(&timerMux);
             timeUpdatedFromSQW = false;
+            const uint32_t sqwEdgeUs = sqwEdgeMicros;
             portEXIT_CRITICAL(&timerMux);
             lastSQWCheck = currentMillis;
-            lastSecondCheck = currentMillis;
             sqwFailed = false;
-            processSecondTick();
+            if (g_secondTickTaskHandle == nullptr) {
+                // Без задачи sec_tick — прежний путь: весь тик из loop().
+                processSecondTickFrom(sqwEdgeUs);
+            }
         }
         else if (!sqwFailed && (currentMillis - lastSQWCheck >= 5000)) {
             sqwFailed = true;
-            Serial.print("\n[WARN] SQW не поступает 5 сек, переход на millis!");
-            requestTimeTickResync();
-            lastSecondCheck = currentMillis;
+            Serial.print("\n[WARN] SQW не поступает 5 сек, переход на опрос часов!");
             processSecondTick();
         }
         else if (sqwFailed) {
-            processSecondTicksByMillis(currentMillis, lastSecondCheck);
+            processSecondTicksByClock();
         }
     }
     else {
         sqwMonitorArmed = false;
         sqwFailed = false;
         lastSQWCheck = currentMillis;
-        processSecondTicksByMillis(currentMillis, lastSecondCheck);
+        processSecondTicksByClock();
     }
+    drainDeferredSecondTicks();
     
     delay(10);
 }
@@ -543,6 +631,12 @@ static void handlePowerFailExitScenario() {
         bleTerminalDisable();
     }
 
+    if (g_secondTickTaskHandle != nullptr) {
+        setSqwTickTaskHandle(nullptr);
+        vTaskDelete(g_secondTickTaskHandle);
+        g_secondTickTaskHandle = nullptr;
+    }
+
     if (g_displayRefreshTaskHandle != nullptr) {
         vTaskDelete(g_displayRefreshTaskHandle);
         g_displayRefreshTaskHandle = nullptr;
@@ -556,7 +650,10 @@ static void handlePowerFailExitScenario() {
     if (displayManager.supportsAntiPoison() && isAntiPoisonActive()) {
         stopCathodesAntiPoisonProcedure("power fail");
     }
-    displayManager.stopAnimations();
+    {
+        ScopedSecondTickLock lock;
+        displayManager.stopAnimations();
+    }
     setDisplayOutputEnabled(false);
 
     // 2) Отключаем SQW-выход DS3231 для минимизации разряда батареи
@@ -613,42 +710,151 @@ static void handlePowerFailExitScenario() {
     }
 }
 
-void processSecondTick() {
+static bool commitSecondTick(uint32_t sqwEdgeUs, SecondTickCommit& out) {
     static bool tickUtcInitialized = false;
     static bool lastDsState = false;
-    static time_t tickUtc = 0;
-    static time_t lastFiveMinuteSyncMarkUtc = 0;
+
+    const uint32_t tickStartUs = micros();
+    if (g_secondTickMutex == nullptr || xSemaphoreTake(g_secondTickMutex, portMAX_DELAY) != pdTRUE) {
+        return false;
+    }
+
+    // Секунда берётся из общих часов UTC (опора по SQW, без I2C): на фронте SQW опора
+    // только что сдвинута на этот фронт, поэтому секунда всегда "свежая".
+    if (sqwEdgeUs != 0) {
+        timeSourceOnSqwEdge(sqwEdgeUs);
+    }
+    if (g_displayBenchRunning) {
+        xSemaphoreGive(g_secondTickMutex);
+        return false;
+    }
+    const bool timeAdjustedNow = consumeTimeAdjustedFlag();
+    const time_t tickUtc = static_cast<time_t>(getCurrentUTCTimeUs() / 1000000LL);
+
+    uint32_t seconds = 1;
+    if (tickUtcInitialized && lastDsState == ds3231_available && !timeAdjustedNow) {
+        const time_t diff = tickUtc - g_lastCommittedTickUtc;
+        if (diff >= 0 && diff <= SECOND_TICK_MAX_CATCH_UP_SEC) {
+            seconds = static_cast<uint32_t>(diff);  // 0 — повторный коммит той же секунды
+        }
+    }
+    tickUtcInitialized = true;
+    lastDsState = ds3231_available;
+    g_lastCommittedTickUtc = tickUtc;
+
+    out.utc = tickUtc;
+    out.seconds = seconds;
+    // Снимок секунды — общий для дисплея, будильников и меню до следующего тика.
+    out.local = publishTimeSnapshot(tickUtc).localTm;
+    out.displayActiveByScheduleNow = displayManager.isDisplayActiveBySchedule(out.local);
+    out.overrideWasActive = displayManager.isSleepOverrideActive();
+    out.displayActiveNow = displayManager.isDisplayActiveNow(out.local);
+
+    // Универсальное обновление дисплея по политике типа часов
+    const uint8_t currentSecond = static_cast<uint8_t>(tickUtc % 60);
+    if (isAntiPoisonActive()) {
+        // Пока идет антиотравление, не перетираем цифры штатным обновлением.
+    } else if (out.displayActiveNow && displayManager.shouldUpdateOnSecond(currentSecond)) {
+        displayManager.markSecondTick(sqwEdgeUs, tickStartUs);
+        displayManager.updateFromLocalTime(out.local, millis(),
+                                           config.alarm1.hour, config.alarm1.minute,
+                                           config.alarm2.hour, config.alarm2.minute);
+    }
+
+    xSemaphoreGive(g_secondTickMutex);
+    return true;
+}
+
+static void processSecondTickDeferred(const SecondTickCommit& tick);
+
+static void processSecondTickFrom(uint32_t sqwEdgeUs) {
+    SecondTickCommit tick;
+    if (commitSecondTick(sqwEdgeUs, tick)) {
+        processSecondTickDeferred(tick);
+    }
+}
+
+void processSecondTick() {
+    processSecondTickFrom(0);
+}
+
+static void secondTickTask(void* param) {
+    (void)param;
+
+    while (true) {
+        // Сколько фронтов накопилось, неважно: прошедшие секунды считает commitSecondTick() по часам UTC.
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        SecondTickCommit tick;
+        if (!commitSecondTick(sqwEdgeMicros, tick)) {
+            continue;
+        }
+        if (xQueueSend(g_secondTickQueue, &tick, 0) != pdTRUE) {
+            ++g_secondTickQueueDrops;  // loop() стоит дольше 8 секунд — отложенная часть тика потеряна
+        }
+    }
+}
+
+static bool startSecondTickTask() {
+    if (g_secondTickTaskHandle != nullptr) {
+        return true;
+    }
+    if (g_secondTickQueue == nullptr) {
+        g_secondTickQueue = xQueueCreate(SECOND_TICK_QUEUE_LENGTH, sizeof(SecondTickCommit));
+        if (g_secondTickQueue == nullptr) {
+            return false;
+        }
+    }
+
+    const BaseType_t taskOk = xTaskCreatePinnedToCore(
+        secondTickTask,
+        "sec_tick",
+        4096,
+        nullptr,
+        SECOND_TICK_TASK_PRIO,
+        &g_secondTickTaskHandle,
+        1
+    );
+    if (taskOk != pdPASS) {
+        g_secondTickTaskHandle = nullptr;
+        return false;
+    }
+    setSqwTickTaskHandle(g_secondTickTaskHandle);
+    return true;
+}
+
+static void drainDeferredSecondTicks() {
+    if (g_secondTickQueue == nullptr) {
+        return;
+    }
+
+    SecondTickCommit tick;
+    while (xQueueReceive(g_secondTickQueue, &tick, 0) == pdTRUE) {
+        processSecondTickDeferred(tick);
+    }
+    if (g_secondTickQueueDrops > 0) {
+        Serial.printf("\n[TICK][WARN] Потеряно отложенных тиков: %lu", static_cast<unsigned long>(g_secondTickQueueDrops));
+        g_secondTickQueueDrops = 0;
+    }
+}
+
+static void processSecondTickDeferred(const SecondTickCommit& tick) {
     static int32_t lastAntiPoisonHourMarker = -1;
     static bool displayStateInitialized = false;
     static bool prevDisplayShouldBeEnabled = true;
     static bool bellStateInitialized = false;
     static bool prevBellEnabled = false;
     static bool prevBellActive = false;
-    const bool timeAdjustedNow = consumeTimeAdjustedFlag();
 
-    // Инициализация/реинициализация базового UTC из активного источника
-    if (!tickUtcInitialized || lastDsState != ds3231_available || timeAdjustedNow) {
-        tickUtc = getCurrentUTCTime();
-        tickUtcInitialized = true;
-        lastDsState = ds3231_available;
-    } else {
-        // Основной режим: считаем секунды локально, без чтения RTC каждую секунду
-        tickUtc += 1;
+    for (uint32_t i = 0; i < tick.seconds; ++i) {
+        runtimeCounterOnSecondTick();
     }
 
-    runtimeCounterOnSecondTick();
-
-    time_t currentTime = tickUtc;
-    time_t localTime = utcToLocal(currentTime);
-    
-    struct tm* tm_info = gmtime(&currentTime);
-    struct tm local_tm_info;
-    gmtime_r(&localTime, &local_tm_info);
-    uint8_t currentSecond = tm_info->tm_sec;
-    const bool displayActiveByScheduleNow = displayManager.isDisplayActiveBySchedule(local_tm_info);
-    const bool overrideWasActive = displayManager.isSleepOverrideActive();
-    const bool displayActiveNow = displayManager.isDisplayActiveNow(local_tm_info);
-    if (overrideWasActive && !displayManager.isSleepOverrideActive() && displayActiveByScheduleNow) {
+    const time_t currentTime = tick.utc;
+    const tm& local_tm_info = tick.local;
+    const uint8_t currentSecond = static_cast<uint8_t>(currentTime % 60);
+    const bool displayActiveByScheduleNow = tick.displayActiveByScheduleNow;
+    const bool displayActiveNow = tick.displayActiveNow;
+    if (tick.overrideWasActive && !displayManager.isSleepOverrideActive() && displayActiveByScheduleNow) {
         Serial.println("\n[DISP] Ручная активация сброшена: наступил штатный интервал активности");
     }
 
@@ -708,17 +914,22 @@ void processSecondTick() {
         prevBellActive = bellActive;
     }
 
-    // Универсальное обновление дисплея по политике типа часов
-    if (isAntiPoisonActive()) {
-        // Пока идет антиотравление, не перетираем цифры штатным обновлением.
-    } else if (displayActiveNow && displayManager.shouldUpdateOnSecond(currentSecond)) {
-        displayManager.updateFromLocalTime(local_tm_info, millis(),
-                                           config.alarm1.hour, config.alarm1.minute,
-                                           config.alarm2.hour, config.alarm2.minute);
+    // Кадр секунды уже выведен в commitSecondTick(); здесь — всё, что может подождать.
+    // Секунды, пропущенные между коммитами, проходят через бой и будильники по порядку,
+    // чтобы событие на пропущенной секунде не потерялось.
+    for (uint32_t back = (tick.seconds > 1) ? (tick.seconds - 1) : 0; back > 0; --back) {
+        const time_t skippedUtc = currentTime - static_cast<time_t>(back);
+        const time_t skippedLocal = utcToLocal(skippedUtc);
+        tm skippedTm = {};
+        gmtime_r(&skippedLocal, &skippedTm);
+        chimeSchedulerOnTick(skippedTm);
+        checkAlarmsAtTick(skippedUtc, skippedTm);
+    }
+    // seconds == 0 — повторный коммит той же секунды: событие этой секунды уже отработано.
+    const bool newSecond = tick.seconds > 0;
+    if (newSecond) {
+        chimeSchedulerOnTick(local_tm_info);
     }
-
-    // Неблокирующие небезусловные действия — после коммита кадра секунды.
-    chimeSchedulerOnTick(local_tm_info);
 
     const DisplayDebugInfo dispDbg = displayManager.getDebugInfo();
     
@@ -749,38 +960,18 @@ void processSecondTick() {
         }
     }
     
-    checkAlarmsAtTick(currentTime, local_tm_info);
-
-    // Контрольная сверка строго в 00 секунд каждых 5 минут: 00, 05, 10, ...
-    // ВАЖНО: делаем после обновления кадра секунды, чтобы SQW->display задержка
-    // оставалась максимально стабильной и не зависела от I2C операций.
-    // Источник сверки = текущий активный источник времени (DS3231 или System RTC)
-    struct tm tickUtcTm;
-    gmtime_r(&currentTime, &tickUtcTm);
-    if (tickUtcTm.tm_sec == 0 && (tickUtcTm.tm_min % 5) == 0 && currentTime != lastFiveMinuteSyncMarkUtc) {
-        const time_t checkedUtc = getCurrentUTCTime();
-        lastFiveMinuteSyncMarkUtc = currentTime;
-
-        // Применяем корректировку в базу тика уже ПОСЛЕ коммита текущего кадра,
-        // чтобы не менять отображаемую секунду в этом проходе.
-        if (checkedUtc > 0) {
-            tickUtc = checkedUtc;
-        }
-
-        if (printEnabled) {
-            if (currentTimeSource == EXTERNAL_DS3231 && ds3231_available) {
-                Serial.print("\n[DS3231] RTC time read");
-            } else {
-                Serial.print("\n[RTC] RTC time read");
-            }
-        }
+    if (newSecond) {
+        checkAlarmsAtTick(currentTime, local_tm_info);
     }
-    
-    // Синхронизация
+
+    // Синхронизация: окна 03:05/15:05 остаются, но окно пропускается, если по измеренному
+    // уходу DS3231 до следующей синхронизации можно подождать (rtc_discipline).
     static uint8_t lastSyncHour = 255;
     if (!otaIsEnabled() && (local_tm_info.tm_hour == 3 || local_tm_info.tm_hour == 15) && local_tm_info.tm_min == 5) {
         if (local_tm_info.tm_hour != lastSyncHour) {
-            syncTimeAsync();
+            if (rtcDisciplineSyncDue(currentTime)) {
+                syncTimeAsync();
+            }
             lastSyncHour = local_tm_info.tm_hour;
         }
     }
@@ -1,9 +1,11 @@
 #include "menu_manager.h"
 
 #include "config.h"
+#include "display/nixie_6_spi.h"
 #include "hardware.h"
 #include "platform_profile.h"
 #include "runtime_counter.h"
+#include "rtc_discipline.h"
 #include "time_utils.h"
 
 #include <Arduino.h>
@@ -165,12 +167,66 @@ void printInfoMenu() {
     Serial.printf("\nТип часов: %s\n", getClockTypeLabelForInfo());
     if (config.clock_type == CLOCK_TYPE_NIXIE && config.clock_digits == 6) {
         Serial.printf("Режим вывода Nix 6: %s\n", getNix6OutputModeLabelForInfo());
+        const Nixie6LockStats lockStats = nixie6GetLockStats();
+        Serial.printf("Синхронизация Nix 6: захватов %lu (ожиданий %lu), шина занята %lu, "
+                      "пропуск слотов %lu, повторов снимка %lu\n",
+                      static_cast<unsigned long>(lockStats.writerLocks),
+                      static_cast<unsigned long>(lockStats.writerContended),
+                      static_cast<unsigned long>(lockStats.busContended),
+                      static_cast<unsigned long>(lockStats.serviceBusSkips),
+                      static_cast<unsigned long>(lockStats.snapshotRetries));
+        const Nixie6LatencyStats lat = nixie6GetLatencyStats();
+        if (lat.sqwToLatch.samples > 0) {
+            Serial.printf("Задержка SQW -> LATCH: avg %.2f мс, max %.2f мс (%lu замеров, подробно: disp lat)\n",
+                          static_cast<float>(static_cast<double>(lat.sqwToLatch.totalUs) /
+                                             lat.sqwToLatch.samples / 1000.0),
+                          lat.sqwToLatch.maxUs / 1000.0f,
+                          static_cast<unsigned long>(lat.sqwToLatch.samples));
+        } else {
+            Serial.println("Задержка SQW -> LATCH: нет замеров (нет SQW или индикация не обновлялась)");
+        }
     }
     Serial.printf("Аудио/будильник: %s\n", config.audio_module_enabled ? "Есть" : "Нет");
     Serial.printf("Ручное управление: %s\n", platformUiControlModeName(config.ui_control_mode));
     Serial.printf("Источник времени: %s",
                   currentTimeSource == EXTERNAL_DS3231 ? "DS3231" : "Внутренний RTC");
     printDS3231Temperature();
+    const TimeSourceHealth timeHealth = getTimeSourceHealth();
+    Serial.printf("\nОпора UTC: %s, проверок %lu, чтений DS3231 %lu, ошибок I2C %lu, исправлений %lu",
+                  !timeHealth.anchorValid ? "нет (системное время)"
+                                          : (timeHealth.anchorSqwAligned ? "по SQW" : "по чтению DS3231"),
+                  static_cast<unsigned long>(timeHealth.probes),
+                  static_cast<unsigned long>(timeHealth.rtcReads),
+                  static_cast<unsigned long>(timeHealth.i2cErrors),
+                  static_cast<unsigned long>(timeHealth.corrections));
+    const UtcClockStatus clockStatus = getUtcClockStatus();
+    Serial.printf("\nЧасы UTC: точность ±%lu мкс, уход %+ld ppb%s",
+                  static_cast<unsigned long>(clockStatus.uncertaintyUs),
+                  static_cast<long>(clockStatus.driftPpb),
+                  clockStatus.driftSettled ? "" : " (оценка уточняется)");
+
+    const NtpSyncReport ntpReport = getLastNtpReport();
+    if (ntpReport.valid) {
+        Serial.printf("\nПоследний NTP: сервер %u (ответили %u), stratum %u, ответов %u, задержка %.1f мс, поправка %+.1f мс",
+                      static_cast<unsigned>(ntpReport.serverIndex),
+                      static_cast<unsigned>(ntpReport.serversAnswered),
+                      static_cast<unsigned>(ntpReport.stratum),
+                      static_cast<unsigned>(ntpReport.samples),
+                      ntpReport.delayUs / 1000.0,
+                      ntpReport.offsetUs / 1000.0);
+        int32_t phaseUs = 0;
+        if (getLastRtcWritePhase(phaseUs)) {
+            Serial.printf("\nФаза SQW после записи DS3231: %+ld мкс", static_cast<long>(phaseUs));
+        }
+    }
+    printNtpScoreboard();
+    const RtcDisciplineStatus disc = rtcDisciplineGetStatus();
+    if (ds3231_available) {
+        Serial.printf("\nПодстройка DS3231: Aging %s%d, уход %+.3f ppm (измерений %u), синхронизация раз в %.1f ч%s",
+                      disc.agingKnown ? "" : "?", static_cast<int>(disc.agingOffset),
+                      disc.lastDriftPpb / 1000.0, static_cast<unsigned>(disc.samples),
+                      disc.syncIntervalSec / 3600.0f, disc.baselineValid ? "" : " (нет базы NTP)");
+    }
 
     Serial.printf("\nWiFi SSID: %s\n", config.wifi_ssid);
     Serial.printf("NTP сервер 1: %s\n", config.ntp_server_1);
@@ -143,6 +143,10 @@ void printTimeMenu() {
     Serial.println("  tz auto / tza      - Автоматическое определение пояса");
     Serial.println("  tz manual / tzm    - Отключить автоопределение");
     Serial.println("  tz check / tzc     - Сравнить правила DST (ezTime vs таблица)");
+    Serial.println("  tz bench / tzb     - Замер скорости конвертации UTC → местное");
+    Serial.println("  tz verify [лет] / tzv - Проверка обратной конвертации (текущий пояс)");
+    Serial.println("  tz verify all / tzva  - То же для всех пресетов и зон tzdb");
+    Serial.println("  tz fuzz [N] [seed] / tzf - Случайные проверки конвертаций по всем зонам");
 
     printMappingMenuCommands();  //Управление меню
 }
@@ -228,18 +232,18 @@ void handleTimeMenu(String command) {
                     return;
                 }
                 
-                uint8_t count = getPresetsCount();
+                uint8_t count = getSelectableZonesCount();
                 
                 if (num >= 1 && num <= count) {
-                    // Получаем preset по индексу (индекс = номер - 1)
-                    const TimezonePreset* preset = getPresetByIndex(num - 1);
-                    if (preset) {
+                    // Получаем зону по индексу (индекс = номер - 1)
+                    const char* zone_name = getSelectableZoneName(num - 1);
+                    if (zone_name) {
                         // Устанавливаем часовой пояс
-                        if (setTimezone(preset->zone_name)) {
-                            Serial.printf("\n[TZ] Установлена зона: %s\n", preset->display_name);
+                        if (setTimezone(zone_name)) {
+                            Serial.printf("\n[TZ] Установлена зона: %s\n", getZoneDisplayName(zone_name));
                             onTimezoneActivated();
                         } else {
-                            Serial.printf("\n[TZ] Ошибка при установке зоны: %s\n", preset->zone_name);
+                            Serial.printf("\n[TZ] Ошибка при установке зоны: %s\n", zone_name);
                         }
                         tz_list_state = 0;
                         return;
@@ -288,6 +292,33 @@ void handleTimeMenu(String command) {
             tz_list_state = 0;
             return;
         }
+        if (cmdLower.equals("tz bench") || cmdLower.equals("tzb")) {
+            runTimezoneBenchmark();
+            tz_list_state = 0;
+            return;
+        }
+        if (cmdLower.startsWith("tz fuzz") || cmdLower.equals("tzf") || cmdLower.startsWith("tzf ")) {
+            String args = cmdLower.startsWith("tzf") ? cmdLower.substring(3) : cmdLower.substring(7);
+            args.trim();
+            const int space = args.indexOf(' ');
+            const uint32_t samples = static_cast<uint32_t>(args.toInt());
+            const uint32_t seed = (space > 0) ? strtoul(args.substring(space + 1).c_str(), nullptr, 0) : 0;
+            runTimezoneFuzz(samples, seed);
+            tz_list_state = 0;
+            return;
+        }
+        if (cmdLower.equals("tz verify all") || cmdLower.equals("tzva")) {
+            runTimezoneRoundTripCheck(true, 10);
+            tz_list_state = 0;
+            return;
+        }
+        if (cmdLower.startsWith("tz verify") || cmdLower.equals("tzv") || cmdLower.startsWith("tzv ")) {
+            String arg = cmdLower.startsWith("tzv") ? cmdLower.substring(3) : cmdLower.substring(9);
+            arg.trim();
+            runTimezoneRoundTripCheck(false, arg.length() > 0 ? arg.toInt() : 10);
+            tz_list_state = 0;
+            return;
+        }
         if (cmdLower.equals("auto sync en") || cmdLower.equals("ase")) {
             enableAutoSync();
             return;
@@ -599,6 +630,11 @@ void printQuickHelp() {
     Serial.println("  menu / m     - Главное меню");
     Serial.println("  sync         - Синхронизировать с NTP");
     Serial.println("  antipoison / a - Антиотравление");
+    Serial.println("  disp stat [reset] - Трафик шины индикации");
+    Serial.println("  disp lat [reset]  - Задержка SQW -> смена цифр");
+    Serial.println("  disp bench [N]   - Прогон N тиков с трассой защёлок");
+    Serial.println("  audio bench      - Такты на отсчёт регулятора громкости");
+    Serial.println("  audio stat [reset] - Конвейер DMA звука: доливы, пробуждения, опустошения");
     Serial.println("  reset / rst  - Перезагрузить устройство");
 
     Serial.println("\n  Работа с беспроводными интерфейсами:\n");
@@ -620,11 +656,14 @@ void printSettings() {
     Serial.println(config.time_config.timezone_name[0] ? config.time_config.timezone_name : "(не установлена)");
     Serial.print("Режим: ");
     Serial.println(config.time_config.automatic_localtime ? "ezTime (online)" : "Таблица (offline)");
-    Serial.print("Текущее смещение: UTC");
-    Serial.println(config.time_config.current_offset >= 0 ? "+" : "");
-    Serial.println(config.time_config.current_offset);
+    // Снимок секунды: смещение с минутами (current_offset - целые часы)
+    const TimeSnapshot now = getTimeSnapshot();
+    char offset_str[16];
+    formatUtcOffset(offset_str, sizeof(offset_str), static_cast<int32_t>(now.offsetSec / 60));
+    Serial.print("Текущее смещение: ");
+    Serial.println(offset_str);
     Serial.print("DST активен: ");
-    Serial.println(config.time_config.current_dst_active ? "YES" : "NO");
+    Serial.println(now.dst ? "YES" : "NO");
 }
 
 // Функции setManualTimezone() и setManualTimezoneOffset() удалены как мёртвый код:
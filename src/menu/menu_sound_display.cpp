@@ -200,6 +200,9 @@ void printDisplayMenu() {
         Serial.printf("\n║ Автояркость:          %s", config.brightness_control_enabled ? "ВКЛ" : "ВЫКЛ");
         Serial.printf("\n║ Порог max яркости:    %u", static_cast<unsigned>(config.brightness_sensor_max));
         Serial.printf("\n║ Порог min яркости:    %u", static_cast<unsigned>(config.brightness_sensor_min));
+        Serial.printf("\n║ Яркость (PWM на OE):  %u/255%s",
+                      static_cast<unsigned>(getDisplayPwmLevel()),
+                      isDisplayOePwmActive() ? "" : " (PWM недоступен)");
         Serial.printf("\n║ Фильтр датчика света: samples=%u, adc=%u-bit",
                       static_cast<unsigned>(config.light_filter_samples),
                       static_cast<unsigned>(config.light_sensor_resolution_bits));
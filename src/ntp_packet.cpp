@@ -0,0 +1,59 @@
+#include "ntp_packet.h"
+
+#include <string.h>
+
+static inline uint32_t readBe32(const uint8_t* p) {
+    return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+           (static_cast<uint32_t>(p[2]) << 8) | static_cast<uint32_t>(p[3]);
+}
+
+static inline void writeBe32(uint8_t* p, uint32_t v) {
+    p[0] = static_cast<uint8_t>(v >> 24);
+    p[1] = static_cast<uint8_t>(v >> 16);
+    p[2] = static_cast<uint8_t>(v >> 8);
+    p[3] = static_cast<uint8_t>(v);
+}
+
+void ntpBuildRequest(uint8_t* packet, const NtpCookie& cookie) {
+    memset(packet, 0, NTP_PACKET_SIZE);
+    packet[0] = 0x23;  // LI = 0, VN = 4, Mode = 3 (клиент)
+    writeBe32(packet + 40, cookie.sec);
+    writeBe32(packet + 44, cookie.frac);
+}
+
+int64_t ntpTimestampToUnixUs(const uint8_t* p) {
+    const uint32_t sec = readBe32(p);
+    const uint32_t frac = readBe32(p + 4);
+    int64_t ntpSec = static_cast<int64_t>(sec);
+    if ((sec & 0x80000000UL) == 0) {
+        ntpSec += 0x100000000LL;
+    }
+    const int64_t fracUs = static_cast<int64_t>((static_cast<uint64_t>(frac) * 1000000ULL) >> 32);
+    return (ntpSec - NTP_UNIX_EPOCH_DELTA) * 1000000LL + fracUs;
+}
+
+NtpReplyStatus ntpParseReply(const uint8_t* reply, const NtpCookie& cookie,
+                             int64_t t1Us, int64_t t4Us, int64_t maxDelayUs, NtpExchange& out) {
+    if (readBe32(reply + 24) != cookie.sec || readBe32(reply + 28) != cookie.frac) {
+        return NtpReplyStatus::Foreign;
+    }
+
+    out.leap = reply[0] >> 6;
+    out.mode = reply[0] & 0x07;
+    out.stratum = reply[1];
+    if (out.mode != 4 || out.leap == 3 || out.stratum == 0 || out.stratum > 15) {
+        return NtpReplyStatus::Rejected;
+    }
+
+    const int64_t t2Us = ntpTimestampToUnixUs(reply + 32);
+    const int64_t t3Us = ntpTimestampToUnixUs(reply + 40);
+    const int64_t serverHoldUs = t3Us - t2Us;
+    const int64_t delayUs = (t4Us - t1Us) - serverHoldUs;
+    if (serverHoldUs < 0 || delayUs < 0 || delayUs > maxDelayUs) {
+        return NtpReplyStatus::BadTiming;
+    }
+
+    out.utcUs = t3Us + delayUs / 2;
+    out.delayUs = delayUs;
+    return NtpReplyStatus::Ok;
+}
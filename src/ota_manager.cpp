@@ -3,6 +3,7 @@
 #include "config.h"
 #include "time_utils.h"
 #include "ble_terminal.h"
+#include "wifi_fast_connect.h"
 
 #include <WiFi.h>
 #include <ArduinoOTA.h>
@@ -47,17 +48,14 @@ bool connectWifiForOta() {
             continue;
         }
 
-        Serial.printf("\n[OTA] -> [WiFi] Подключение к сети %s: %s", c.label, c.ssid);
-        WiFi.begin(c.ssid, c.pass);
-
-        while (WiFi.status() != WL_CONNECTED && millis() < deadline) {
-            delay(250);
-            Serial.print(".");
+        const uint32_t nowMs = millis();
+        if (static_cast<int32_t>(deadline - nowMs) <= 0) {
+            break;
         }
 
-        if (WiFi.status() == WL_CONNECTED) {
+        Serial.printf("\n[OTA] -> [WiFi] Подключение к сети %s: %s", c.label, c.ssid);
+        if (wifiFastConnect(c.ssid, c.pass, deadline - nowMs, "[OTA] -> [WiFi]")) {
             g_wifiOwnedByOta = true;
-            Serial.printf("\n[OTA] -> [WiFi] Подключено к: %s", c.ssid);
             return true;
         }
 
@@ -0,0 +1,206 @@
+#include "rtc_discipline.h"
+
+#include "config.h"
+#include "hardware.h"
+
+#include <Preferences.h>
+
+namespace {
+
+constexpr const char* DISC_NS = "rtc_disc";
+constexpr const char* DISC_KEY = "state";
+constexpr const char* DISC_PARTITION = "cfg_nvs";
+constexpr uint32_t DISC_MAGIC = 0x52544344;  // RTCD
+constexpr uint32_t DISC_VERSION = 1;
+
+// Короче 6 ч ошибка в единицы мс ещё сравнима с погрешностью NTP — уход не оцениваем.
+constexpr uint32_t DISC_MIN_INTERVAL_SEC = 6UL * 3600UL;
+constexpr int32_t DISC_PPB_PER_LSB = 100;           // Aging Offset: 1 LSB ≈ 0.1 ppm
+constexpr int32_t DISC_MAX_STEP_LSB = 20;           // не больше 2 ppm за одну синхронизацию
+constexpr int32_t DISC_RESIDUAL_FLOOR_PPB = 50;     // меньше не обещаем: температура, квантование
+constexpr int64_t DISC_TARGET_ERROR_US = 50000;     // допустимая ошибка к следующей синхронизации
+constexpr uint32_t DISC_INTERVAL_MIN_SEC = 12UL * 3600UL;     // как прежнее расписание 03:05/15:05
+constexpr uint32_t DISC_INTERVAL_MAX_SEC = 7UL * 24UL * 3600UL;
+constexpr uint32_t DISC_DUE_MARGIN_SEC = 3600;      // окно 03:05 не пропускаем из-за секунд
+
+struct DisciplineRecord {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t baselineUtc;   // 0 — базы нет
+    int32_t lastDriftPpb;
+    int32_t lastErrorMs;
+    uint32_t syncIntervalSec;
+    uint16_t samples;
+    uint16_t reserved;
+    uint32_t crc;
+};
+
+DisciplineRecord g_state = {};
+bool g_loaded = false;
+int8_t g_agingOffset = 0;
+bool g_agingKnown = false;
+int64_t g_lastErrorUs = 0;
+
+uint32_t fnv1aHash(const uint8_t* bytes, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; ++i) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+uint32_t hashRecord(const DisciplineRecord& rec) {
+    return fnv1aHash(reinterpret_cast<const uint8_t*>(&rec), sizeof(DisciplineRecord) - sizeof(rec.crc));
+}
+
+void loadState() {
+    if (g_loaded) {
+        return;
+    }
+    g_loaded = true;
+    g_state = DisciplineRecord();
+    g_state.syncIntervalSec = DISC_INTERVAL_MIN_SEC;
+
+    Preferences prefs;
+    if (!prefs.begin(DISC_NS, true, DISC_PARTITION)) {
+        return;
+    }
+    DisciplineRecord rec = {};
+    const bool ok = prefs.getBytesLength(DISC_KEY) == sizeof(rec) &&
+                    prefs.getBytes(DISC_KEY, &rec, sizeof(rec)) == sizeof(rec);
+    prefs.end();
+    if (ok && rec.magic == DISC_MAGIC && rec.version == DISC_VERSION && rec.crc == hashRecord(rec)) {
+        g_state = rec;
+        g_lastErrorUs = static_cast<int64_t>(rec.lastErrorMs) * 1000LL;
+    }
+}
+
+void saveState() {
+    g_state.magic = DISC_MAGIC;
+    g_state.version = DISC_VERSION;
+    g_state.crc = hashRecord(g_state);
+
+    Preferences prefs;
+    if (!prefs.begin(DISC_NS, false, DISC_PARTITION)) {
+        return;
+    }
+    prefs.putBytes(DISC_KEY, &g_state, sizeof(g_state));
+    prefs.end();
+}
+
+uint32_t intervalForResidualPpb(int32_t residualPpb) {
+    if (residualPpb < 0) {
+        residualPpb = -residualPpb;
+    }
+    if (residualPpb < DISC_RESIDUAL_FLOOR_PPB) {
+        residualPpb = DISC_RESIDUAL_FLOOR_PPB;
+    }
+    // ошибка [мкс] = уход [ppb] * время [с] / 1000
+    const int64_t intervalSec = (DISC_TARGET_ERROR_US * 1000LL) / residualPpb;
+    if (intervalSec < DISC_INTERVAL_MIN_SEC) {
+        return DISC_INTERVAL_MIN_SEC;
+    }
+    if (intervalSec > DISC_INTERVAL_MAX_SEC) {
+        return DISC_INTERVAL_MAX_SEC;
+    }
+    return static_cast<uint32_t>(intervalSec);
+}
+
+} // namespace
+
+void rtcDisciplineInit() {
+    loadState();
+    g_agingKnown = ds3231ReadAgingOffset(g_agingOffset);
+}
+
+void rtcDisciplineOnNtpSample(time_t ntpUtc, int64_t rtcErrorUs, bool measurable) {
+    loadState();
+    if (!ds3231_available) {
+        return;
+    }
+    if (!measurable || g_state.baselineUtc == 0 || ntpUtc <= static_cast<time_t>(g_state.baselineUtc)) {
+        Serial.print("\n[DS3231] Уход не оценивается: нет базы (DS3231 выставлен не по NTP или нет SQW)");
+        return;
+    }
+    const uint32_t elapsedSec = static_cast<uint32_t>(ntpUtc - static_cast<time_t>(g_state.baselineUtc));
+    if (elapsedSec < DISC_MIN_INTERVAL_SEC) {
+        return;
+    }
+
+    // Ошибка накоплена с момента записи по NTP (тогда она была ~0): уход = ошибка / время.
+    const int32_t driftPpb = static_cast<int32_t>((rtcErrorUs * 1000LL) / static_cast<int64_t>(elapsedSec));
+    g_lastErrorUs = rtcErrorUs;
+    g_state.lastDriftPpb = driftPpb;
+    g_state.lastErrorMs = static_cast<int32_t>(rtcErrorUs / 1000LL);
+    if (g_state.samples < UINT16_MAX) {
+        ++g_state.samples;
+    }
+    Serial.printf("\n[DS3231] Ошибка за %.1f ч: %+.1f мс, уход %+.3f ppm",
+                  elapsedSec / 3600.0f, rtcErrorUs / 1000.0, driftPpb / 1000.0);
+
+    // Спешит (ошибка > 0) — увеличиваем Aging Offset (замедляет генератор).
+    int32_t stepLsb = (driftPpb >= 0) ? (driftPpb + DISC_PPB_PER_LSB / 2) / DISC_PPB_PER_LSB
+                                      : -((-driftPpb + DISC_PPB_PER_LSB / 2) / DISC_PPB_PER_LSB);
+    if (stepLsb > DISC_MAX_STEP_LSB) stepLsb = DISC_MAX_STEP_LSB;
+    if (stepLsb < -DISC_MAX_STEP_LSB) stepLsb = -DISC_MAX_STEP_LSB;
+
+    int32_t appliedLsb = 0;
+    int8_t aging = 0;
+    if (stepLsb != 0 && ds3231ReadAgingOffset(aging)) {
+        int32_t next = static_cast<int32_t>(aging) + stepLsb;
+        next = (next > 127) ? 127 : ((next < -128) ? -128 : next);
+        if (next != aging && ds3231WriteAgingOffset(static_cast<int8_t>(next))) {
+            appliedLsb = next - aging;
+            g_agingOffset = static_cast<int8_t>(next);
+            g_agingKnown = true;
+            Serial.printf("\n[DS3231] Aging Offset: %d -> %d", static_cast<int>(aging), static_cast<int>(next));
+        }
+    }
+
+    const int32_t residualPpb = driftPpb - appliedLsb * DISC_PPB_PER_LSB;
+    g_state.syncIntervalSec = intervalForResidualPpb(residualPpb);
+    Serial.printf("\n[DS3231] Остаточный уход ~%+.3f ppm, следующая синхронизация через %.1f ч",
+                  residualPpb / 1000.0, g_state.syncIntervalSec / 3600.0f);
+    saveState();
+}
+
+void rtcDisciplineOnRtcSet(time_t utc, bool fromNtp) {
+    loadState();
+    const uint32_t baseline = (fromNtp && ds3231_available) ? static_cast<uint32_t>(utc) : 0;
+    if (baseline == g_state.baselineUtc) {
+        return;
+    }
+    g_state.baselineUtc = baseline;
+    if (baseline == 0) {
+        // Без базы уход неизвестен — возвращаемся к прежнему шагу синхронизации.
+        g_state.syncIntervalSec = DISC_INTERVAL_MIN_SEC;
+    }
+    saveState();
+}
+
+bool rtcDisciplineSyncDue(time_t nowUtc) {
+    loadState();
+    const time_t lastSync = static_cast<time_t>(config.time_config.last_ntp_sync);
+    if (!ds3231_available || g_state.baselineUtc == 0 || lastSync == 0 || nowUtc < lastSync) {
+        return true;
+    }
+    const uint32_t interval = (g_state.syncIntervalSec > DISC_DUE_MARGIN_SEC)
+                                  ? (g_state.syncIntervalSec - DISC_DUE_MARGIN_SEC)
+                                  : 0;
+    return static_cast<uint32_t>(nowUtc - lastSync) >= interval;
+}
+
+RtcDisciplineStatus rtcDisciplineGetStatus() {
+    loadState();
+    RtcDisciplineStatus st;
+    st.baselineValid = g_state.baselineUtc != 0;
+    st.baselineUtc = g_state.baselineUtc;
+    st.agingOffset = g_agingOffset;
+    st.agingKnown = g_agingKnown;
+    st.lastDriftPpb = g_state.lastDriftPpb;
+    st.lastErrorUs = g_lastErrorUs;
+    st.samples = g_state.samples;
+    st.syncIntervalSec = g_state.syncIntervalSec;
+    return st;
+}
@@ -2,7 +2,16 @@
 #include "config.h"
 #include "hardware.h"
 #include "timezone_manager.h"
+#include "wifi_fast_connect.h"
+#include "rtc_discipline.h"
+#include "ntp_packet.h"
+#include "utc_anchor.h"
 #include <ezTime.h>
+#include <atomic>
+#include <esp_timer.h>
+#include <Preferences.h>
+#include <lwip/dns.h>
+#include <lwip/tcpip.h>
 
 extern WiFiUDP ntpUDP;         // Определен где-то еще (возможно в .ino)
 extern NTPClient *timeClient;  // Определен в config.cpp
@@ -19,6 +28,108 @@ static char syncSsid1[sizeof(config.wifi_ssid)] = {0};
 static char syncPass1[sizeof(config.wifi_pass)] = {0};
 static char syncSsid2[sizeof(config.wifi_ssid_2)] = {0};
 static char syncPass2[sizeof(config.wifi_pass_2)] = {0};
+static constexpr uint32_t WIFI_SYNC_CONNECT_TIMEOUT_MS = 9000;  // как прежние 30 попыток по 300 мс
+
+// ===== КЭШ UTC (getCurrentUTCTime без I2C) =====
+// getCurrentUTCTime() зовут disp_refresh (во время sync — каждые 1..20 мс), меню, будильники.
+// Вместо probe + rtc->now() на каждый вызов UTC считается от опорной точки "секунда DS3231 +
+// момент esp_timer, к которому она относится". Фронт SQW подтягивает фазу опоры,
+// serviceTimeSourceHealth() по расписанию проверяет DS3231 и сверяет с ним секунды.
+// Читатели берут опору без блокировок (seqlock), писатели сериализованы спинлоком.
+static constexpr uint32_t TIME_SOURCE_HEALTH_PERIOD_MS = 10000;
+static constexpr uint32_t TIME_SOURCE_PROBE_PERIOD_MS = 1000;   // DS3231 нет или была ошибка I2C
+static constexpr int64_t UTC_ANCHOR_COMPARE_GUARD_US = 100000;  // не сверять у границы секунды
+// Оценка ухода esp_timer относительно DS3231 (по периоду SQW) и погрешности показаний.
+static constexpr int32_t UTC_DRIFT_EMA_SHIFT = 4;               // EMA с весом 1/16
+static constexpr uint16_t UTC_DRIFT_SETTLED_SAMPLES = 16;
+static constexpr int64_t UTC_DRIFT_MAX_PPB = 200000;            // > 200 ppm — выброс (пропуск фронта, дребезг)
+static constexpr uint32_t UTC_SQW_EDGE_JITTER_US = 20;          // задержка входа в ISR
+static constexpr uint32_t UTC_RESIDUAL_DRIFT_PPM_SETTLED = 2;
+static constexpr uint32_t UTC_RESIDUAL_DRIFT_PPM_UNSETTLED = 50;
+// Запись DS3231 на границе секунды UTC (setTimeToAllSourcesUs)
+static constexpr int64_t UTC_ALIGNED_WRITE_MIN_LEAD_US = 20000;   // ближе к границе — пишем на следующей
+static constexpr int64_t UTC_ALIGNED_WRITE_WAKE_LEAD_US = 1000;   // таймер будит за 1 мс, дальше — ожидание
+static constexpr int64_t UTC_RTC_SECONDS_ACK_US = 300;            // START + адрес + регистр + секунды на 100 кГц
+static constexpr int64_t UTC_ALIGNED_WRITE_TRIM_MAX_US = 5000;
+static constexpr int64_t UTC_SQW_PHASE_WAIT_US = 200000;          // ждём спад SQW не дольше 1.2 с после записи
+static constexpr UBaseType_t UTC_ALIGNED_WRITE_PRIORITY = 20;     // ниже системных WiFi/esp_timer
+static int64_t g_alignedWriteTrimUs = 0;                          // выучено по замерам фазы SQW
+static int32_t g_lastRtcWritePhaseUs = 0;
+static bool g_lastRtcWritePhaseValid = false;
+
+struct UtcAnchor {
+    time_t utc = 0;
+    int64_t atUs = 0;         // esp_timer_get_time(), к которому относится начало секунды utc
+    bool valid = false;
+    bool sqwAligned = false;  // atUs = фронт SQW (иначе — момент чтения, фаза секунды неизвестна)
+    bool writeAligned = false;  // atUs = запись регистра секунд: фаза известна, но для ухода не годится
+    int32_t driftPpb = 0;     // >0: esp_timer спешит относительно DS3231
+    uint16_t driftSamples = 0;
+};
+static UtcAnchor g_utcAnchor;
+static std::atomic<uint32_t> g_utcAnchorSeq{0};
+static portMUX_TYPE g_utcAnchorWriteMux = portMUX_INITIALIZER_UNLOCKED;
+static TimeSourceHealth g_timeSourceHealth;
+
+static bool readUtcAnchor(UtcAnchor& out) {
+    while (true) {
+        const uint32_t seq = g_utcAnchorSeq.load(std::memory_order_acquire);
+        if ((seq & 1U) != 0) {
+            continue;  // писатель на другом ядре внутри секции — несколько тактов
+        }
+        out = g_utcAnchor;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (g_utcAnchorSeq.load(std::memory_order_relaxed) == seq) {
+            return out.valid;
+        }
+    }
+}
+
+// Вызывать только внутри portENTER_CRITICAL(&g_utcAnchorWriteMux)
+static void writeUtcAnchorLocked(const UtcAnchor& anchor) {
+    g_utcAnchorSeq.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    g_utcAnchor = anchor;
+    g_utcAnchorSeq.fetch_add(1, std::memory_order_release);
+}
+
+static void setUtcAnchor(time_t utc, int64_t atUs, bool writeAligned = false) {
+    portENTER_CRITICAL(&g_utcAnchorWriteMux);
+    // Оценка ухода esp_timer не зависит от того, откуда взята секунда, — сохраняем её.
+    UtcAnchor anchor;
+    anchor.utc = utc;
+    anchor.atUs = atUs;
+    anchor.valid = true;
+    anchor.writeAligned = writeAligned;
+    anchor.driftPpb = g_utcAnchor.driftPpb;
+    anchor.driftSamples = g_utcAnchor.driftSamples;
+    writeUtcAnchorLocked(anchor);
+    portEXIT_CRITICAL(&g_utcAnchorWriteMux);
+}
+
+static void invalidateUtcAnchor() {
+    portENTER_CRITICAL(&g_utcAnchorWriteMux);
+    UtcAnchor anchor;
+    anchor.driftPpb = g_utcAnchor.driftPpb;
+    anchor.driftSamples = g_utcAnchor.driftSamples;
+    writeUtcAnchorLocked(anchor);
+    portEXIT_CRITICAL(&g_utcAnchorWriteMux);
+}
+
+// UTC в мкс от опоры: прошедшее по esp_timer время исправляется на измеренный уход.
+static inline int64_t utcUsFromAnchor(const UtcAnchor& anchor, int64_t nowUs) {
+    const int64_t elapsedUs = nowUs - anchor.atUs;
+    const int64_t correctionUs = (elapsedUs * anchor.driftPpb) / 1000000000LL;
+    return static_cast<int64_t>(anchor.utc) * 1000000LL + elapsedUs - correctionUs;
+}
+
+static inline time_t utcSecondsFromUs(int64_t utcUs) {
+    return static_cast<time_t>((utcUs >= 0) ? (utcUs / 1000000) : -((999999 - utcUs) / 1000000));
+}
+
+static inline time_t utcFromAnchor(const UtcAnchor& anchor, int64_t nowUs) {
+    return utcSecondsFromUs(utcUsFromAnchor(anchor, nowUs));
+}
 
 static bool readDs3231Status(uint8_t& statusOut) {
     Wire.beginTransmission(0x68);
@@ -78,7 +189,7 @@ static bool isDs3231DateTimeValid(const DateTime& dt) {
 }
 
 // Основная функция проверки и инициализации источников времени
-// Вызывается при старте и потом при каждом получении времени
+// Вызывается при старте и потом по расписанию из serviceTimeSourceHealth()
 void checkTimeSource() {
     static bool firstCheck = true;
     static bool firstRunMessage = true;
@@ -190,6 +301,7 @@ void checkTimeSource() {
     // Если статус изменился (DS3231 появился/исчез)
     if (ds3231_now_available != ds3231_available) {
         ds3231_available = ds3231_now_available;
+        invalidateUtcAnchor();  // опора перечитается из нового источника
         
         if (ds3231_available) {
             currentTimeSource = EXTERNAL_DS3231;
@@ -274,26 +386,254 @@ void checkTimeSource() {
     
 }
 
-time_t getCurrentUTCTime() {
-    // Всегда проверяем актуальность источника, но не допускаем рекурсии
-    // (checkTimeSource() местами читает время RTC напрямую).
-    static bool checkInProgress = false;
-    if (!checkInProgress) {
-        checkInProgress = true;
-        checkTimeSource();
-        checkInProgress = false;
+static time_t anchorUtcFromRtcFallback() {
+    time_t sys_time;
+    time(&sys_time);
+    return sys_time;
+}
+
+// Одно чтение DS3231 -> новая опора (первое чтение после старта, смены источника, ошибки).
+static time_t anchorUtcFromRtc() {
+    const DateTime now = rtc->now();
+    const int64_t readUs = esp_timer_get_time();
+    ++g_timeSourceHealth.rtcReads;
+    if (!isDs3231DateTimeValid(now)) {
+        ++g_timeSourceHealth.i2cErrors;
+        return anchorUtcFromRtcFallback();
     }
-    
+    const time_t utc = convertDateTimeToTimeT(now);
+    setUtcAnchor(utc, readUs);
+    return utc;
+}
+
+time_t getCurrentUTCTime() {
+    return utcSecondsFromUs(getCurrentUTCTimeUs());
+}
+
+int64_t getCurrentUTCTimeUs() {
+    // Состояние DS3231 проверяет serviceTimeSourceHealth() по расписанию, здесь I2C нет.
     if (currentTimeSource == EXTERNAL_DS3231 && rtc && ds3231_available) {
-        // ТОЛЬКО чтение, БЕЗ обновления системного времени
-        DateTime now = rtc->now();
-        return convertDateTimeToTimeT(now);
+        UtcAnchor anchor;
+        if (!readUtcAnchor(anchor)) {
+            (void)anchorUtcFromRtc();
+            if (!readUtcAnchor(anchor)) {
+                return static_cast<int64_t>(anchorUtcFromRtcFallback()) * 1000000LL;
+            }
+        }
+        return utcUsFromAnchor(anchor, esp_timer_get_time());
+    }
+
+    // Системное время ESP32 (внутренний RTC) — с микросекундами
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return static_cast<int64_t>(tv.tv_sec) * 1000000LL + tv.tv_usec;
+}
+
+UtcClockStatus getUtcClockStatus() {
+    UtcClockStatus status;
+    UtcAnchor anchor;
+    const bool anchored = readUtcAnchor(anchor);
+    const int64_t nowUs = esp_timer_get_time();
+    status.utcUs = getCurrentUTCTimeUs();
+    status.driftPpb = anchor.driftPpb;
+    status.driftSettled = anchor.driftSamples >= UTC_DRIFT_SETTLED_SAMPLES;
+
+    if (currentTimeSource != EXTERNAL_DS3231 || !ds3231_available || !anchored) {
+        status.source = UtcClockSource::SystemClock;
+        status.uncertaintyUs = 1000000;  // системные часы ставятся с точностью до секунды
+        return status;
+    }
+
+    const int64_t ageUs = nowUs - anchor.atUs;
+    status.anchorAgeMs = static_cast<uint32_t>(ageUs / 1000);
+    if (!anchor.sqwAligned) {
+        // Регистр DS3231 прочитан в произвольной фазе: истинное время в [S, S+1)
+        status.source = UtcClockSource::Ds3231Read;
+        status.uncertaintyUs = 1000000;
+        return status;
+    }
+
+    const uint32_t residualPpm = status.driftSettled ? UTC_RESIDUAL_DRIFT_PPM_SETTLED
+                                                     : UTC_RESIDUAL_DRIFT_PPM_UNSETTLED;
+    status.source = UtcClockSource::Ds3231Sqw;
+    status.uncertaintyUs = UTC_SQW_EDGE_JITTER_US +
+                           static_cast<uint32_t>((ageUs * residualPpm) / 1000000LL);
+    return status;
+}
+
+// ===== СНИМОК ВРЕМЕНИ СЕКУНДЫ =====
+// Секундный тик публикует один снимок (UTC, локальное время, смещение, DST, источник),
+// и дисплей, будильники, меню читают его вместо getCurrentUTCTime() + utcToLocal() +
+// gmtime_r(). Если тик ещё не публиковал текущую секунду (нет SQW, loop занят),
+// снимок строится при чтении и тоже публикуется. Чтение — seqlock, как у опоры UTC.
+static TimeSnapshot g_timeSnapshot;
+static bool g_timeSnapshotValid = false;
+static std::atomic<uint32_t> g_timeSnapshotSeq{0};
+static portMUX_TYPE g_timeSnapshotWriteMux = portMUX_INITIALIZER_UNLOCKED;
+
+static bool readTimeSnapshot(TimeSnapshot& out) {
+    while (true) {
+        const uint32_t seq = g_timeSnapshotSeq.load(std::memory_order_acquire);
+        if ((seq & 1U) != 0) {
+            continue;
+        }
+        out = g_timeSnapshot;
+        const bool valid = g_timeSnapshotValid;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (g_timeSnapshotSeq.load(std::memory_order_relaxed) == seq) {
+            return valid;
+        }
+    }
+}
+
+static void writeTimeSnapshot(const TimeSnapshot* snapshot) {
+    portENTER_CRITICAL(&g_timeSnapshotWriteMux);
+    g_timeSnapshotSeq.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    if (snapshot) {
+        g_timeSnapshot = *snapshot;
+    }
+    g_timeSnapshotValid = snapshot != nullptr;
+    g_timeSnapshotSeq.fetch_add(1, std::memory_order_release);
+    portEXIT_CRITICAL(&g_timeSnapshotWriteMux);
+}
+
+static TimeSnapshot buildTimeSnapshot(time_t utc) {
+    TimeSnapshot snap;
+    snap.utc = utc;
+    snap.local = utcToLocal(utc, snap.dst);
+    gmtime_r(&snap.local, &snap.localTm);
+    snap.offsetSec = static_cast<int32_t>(snap.local - utc);
+    snap.source = getUtcClockStatus().source;
+    return snap;
+}
+
+TimeSnapshot publishTimeSnapshot(time_t utc) {
+    const TimeSnapshot snap = buildTimeSnapshot(utc);
+    writeTimeSnapshot(&snap);
+    return snap;
+}
+
+void invalidateTimeSnapshot() {
+    writeTimeSnapshot(nullptr);
+}
+
+TimeSnapshot getTimeSnapshot() {
+    const int64_t nowUs = getCurrentUTCTimeUs();
+    const time_t nowUtc = utcSecondsFromUs(nowUs);
+    TimeSnapshot snap;
+    if (!readTimeSnapshot(snap) || snap.utc != nowUtc) {
+        snap = buildTimeSnapshot(nowUtc);
+        writeTimeSnapshot(&snap);
+    }
+    snap.subSecondUs = static_cast<uint32_t>(nowUs - static_cast<int64_t>(nowUtc) * 1000000LL);
+    return snap;
+}
+
+void timeSourceOnSqwEdge(uint32_t sqwEdgeUs) {
+    // micros() = младшие 32 бита esp_timer_get_time(): восстанавливаем 64-битный момент фронта.
+    const int64_t nowUs = esp_timer_get_time();
+    const int64_t edgeUs = nowUs - static_cast<uint32_t>(static_cast<uint32_t>(nowUs) - sqwEdgeUs);
+
+    portENTER_CRITICAL(&g_utcAnchorWriteMux);
+    UtcAnchor anchor = g_utcAnchor;
+    const int64_t deltaUs = edgeUs - anchor.atUs;
+    if (anchor.valid && deltaUs > 0) {
+        // От фронта и от записи DS3231 — округление, от момента чтения — вверх.
+        const int64_t seconds = utcSecondsToSqwEdge(deltaUs, anchor.sqwAligned || anchor.writeAligned);
+        if (anchor.sqwAligned && seconds > 0) {
+            // Период SQW по esp_timer: (delta - N с) / N с = уход esp_timer в ppb.
+            const int64_t ppb = ((deltaUs - seconds * 1000000LL) * 1000LL) / seconds;
+            if (ppb > -UTC_DRIFT_MAX_PPB && ppb < UTC_DRIFT_MAX_PPB) {
+                if (anchor.driftSamples == 0) {
+                    anchor.driftPpb = static_cast<int32_t>(ppb);
+                } else {
+                    anchor.driftPpb += static_cast<int32_t>((ppb - anchor.driftPpb) >> UTC_DRIFT_EMA_SHIFT);
+                }
+                if (anchor.driftSamples < UINT16_MAX) {
+                    ++anchor.driftSamples;
+                }
+            }
+        }
+        anchor.utc += static_cast<time_t>(seconds);
+        anchor.atUs = edgeUs;
+        anchor.sqwAligned = true;
+        anchor.writeAligned = false;
+        writeUtcAnchorLocked(anchor);
+    }
+    portEXIT_CRITICAL(&g_utcAnchorWriteMux);
+}
+
+void serviceTimeSourceHealth(uint32_t nowMs) {
+    static uint32_t lastCheckMs = 0;
+    static bool checkedOnce = false;
+    const uint32_t periodMs = ds3231_available ? TIME_SOURCE_HEALTH_PERIOD_MS : TIME_SOURCE_PROBE_PERIOD_MS;
+    if (checkedOnce && (nowMs - lastCheckMs < periodMs)) {
+        return;
+    }
+    checkedOnce = true;
+    lastCheckMs = nowMs;
+
+    ++g_timeSourceHealth.probes;
+    checkTimeSource();
+    if (currentTimeSource != EXTERNAL_DS3231 || !rtc || !ds3231_available) {
+        return;
+    }
+
+    UtcAnchor anchor;
+    if (!readUtcAnchor(anchor)) {
+        (void)anchorUtcFromRtc();
+        return;
+    }
+    // Опора по SQW сверяется только в середине секунды: чтение DS3231 по I2C занимает ~1 мс
+    // и у границы секунды дало бы ложное расхождение.
+    const bool phaseKnown = anchor.sqwAligned || anchor.writeAligned;
+    const int64_t phaseUs = (esp_timer_get_time() - anchor.atUs) % 1000000;
+    if (phaseKnown &&
+        (phaseUs < UTC_ANCHOR_COMPARE_GUARD_US || phaseUs > 1000000 - UTC_ANCHOR_COMPARE_GUARD_US)) {
+        lastCheckMs = nowMs - periodMs + 300;  // повторить через 300 мс
+        return;
+    }
+
+    const DateTime now = rtc->now();
+    const int64_t readUs = esp_timer_get_time();
+    ++g_timeSourceHealth.rtcReads;
+    if (!isDs3231DateTimeValid(now)) {
+        // Ошибка I2C/мусор: опоре больше не верим, источник перепроверяется раньше срока.
+        ++g_timeSourceHealth.i2cErrors;
+        invalidateUtcAnchor();
+        lastCheckMs = nowMs - periodMs + TIME_SOURCE_PROBE_PERIOD_MS;
+        return;
+    }
+
+    const time_t rtcUtc = convertDateTimeToTimeT(now);
+    const time_t cachedUtc = utcFromAnchor(anchor, readUs);
+    const time_t diff = rtcUtc - cachedUtc;
+    if (diff == 0 || (!phaseKnown && (diff == 1 || diff == -1))) {
+        return;  // без SQW фаза опоры неизвестна: ±1 с — ещё не расхождение
+    }
+
+    ++g_timeSourceHealth.corrections;
+    Serial.printf("\n[TIME] Опора UTC расходится с DS3231 на %ld с, исправляю", static_cast<long>(diff));
+    portENTER_CRITICAL(&g_utcAnchorWriteMux);
+    UtcAnchor fixed = g_utcAnchor;
+    if (fixed.sqwAligned || fixed.writeAligned) {
+        fixed.utc += diff;  // фаза от SQW/записи верна, сдвигаются только секунды
     } else {
-        // Берем системное время
-        time_t sys_time;
-        time(&sys_time);
-        return sys_time;
+        fixed.utc = rtcUtc;
+        fixed.atUs = readUs;
     }
+    fixed.valid = true;
+    writeUtcAnchorLocked(fixed);
+    portEXIT_CRITICAL(&g_utcAnchorWriteMux);
+}
+
+TimeSourceHealth getTimeSourceHealth() {
+    TimeSourceHealth health = g_timeSourceHealth;
+    UtcAnchor anchor;
+    health.anchorValid = readUtcAnchor(anchor);
+    health.anchorSqwAligned = health.anchorValid && anchor.sqwAligned;
+    return health;
 }
 
 time_t convertDateTimeToTimeT(const DateTime& dt) {
@@ -335,14 +675,144 @@ void setTimeToAllSources(time_t utcTime) {
     if(ds3231_available && rtc) {
         DateTime dt = convertTimeTToDateTime(utcTime);
         rtc->adjust(dt);
+        // Запись секунд сбрасывает делитель DS3231: новая секунда начинается сейчас.
+        setUtcAnchor(utcTime, esp_timer_get_time(), true);
         Serial.print("\n[DS3231] обновлен");
+    } else {
+        invalidateUtcAnchor();
     }
     
    // Serial.print("Текущее время: ");
    // printTimeFromTimeT(utcTime);
+    // Время задано не по NTP: накопленная ошибка DS3231 больше не отсчитывается от известной точки.
+    rtcDisciplineOnRtcSet(utcTime, false);
+    invalidateTimeSnapshot();
+    timeAdjustedFlag = true;
+}
+
+// --- Запись DS3231 на границе секунды UTC ---
+// Запись регистра секунд сбрасывает делитель DS3231 (в момент ACK байта секунд), а спад
+// SQW приходит ровно через 1 с после него. Будит задачу одноразовый esp_timer (аппаратный
+// таймер) за ~1 мс до границы, остаток добирается ожиданием по esp_timer с поднятым
+// приоритетом; запись стартует раньше на время передачи адреса, регистра и байта секунд.
+// Фаза следующего спада SQW относительно UTC замеряется и идёт в поправку следующей записи.
+
+static TaskHandle_t g_alignedWriteWaiter = nullptr;  // задача синхронизации создаётся заново на каждый запуск
+
+static void alignedRtcWriteTimerCallback(void* arg) {
+    (void)arg;
+    TaskHandle_t waiter = g_alignedWriteWaiter;
+    if (waiter != nullptr) {
+        xTaskNotifyGive(waiter);
+    }
+}
+
+// Ждём спад SQW после записи и возвращаем его фазу относительно ожидаемой секунды UTC.
+static bool measureSqwPhaseAfterWrite(int64_t writeBoundaryEspUs, int32_t& phaseErrorUs) {
+    const uint32_t edgeBefore = sqwEdgeMicros;
+    const int64_t expectedEdgeEspUs = writeBoundaryEspUs + 1000000LL;
+    while (esp_timer_get_time() < expectedEdgeEspUs + UTC_SQW_PHASE_WAIT_US) {
+        const uint32_t edge = sqwEdgeMicros;
+        if (edge != edgeBefore) {
+            // micros() и esp_timer_get_time() — один счётчик, сравниваем по младшим 32 битам.
+            phaseErrorUs = static_cast<int32_t>(edge - static_cast<uint32_t>(expectedEdgeEspUs));
+            if (phaseErrorUs > -500000 && phaseErrorUs < 500000) {
+                return true;
+            }
+        }
+        vTaskDelay(1);
+    }
+    return false;
+}
+
+static int64_t writeDs3231AtUtcBoundary(int64_t utcUs, int64_t atEspUs, time_t& writtenUtc) {
+    static esp_timer_handle_t alignTimer = nullptr;
+    if (alignTimer == nullptr) {
+        esp_timer_create_args_t args = {};
+        args.callback = &alignedRtcWriteTimerCallback;
+        args.arg = nullptr;
+        args.dispatch_method = ESP_TIMER_TASK;
+        args.name = "rtc_align";
+        if (esp_timer_create(&args, &alignTimer) != ESP_OK) {
+            alignTimer = nullptr;
+        }
+    }
+
+    // Граница с запасом: таймер должен успеть завестись, а поправка — уложиться.
+    const int64_t nowEsp = esp_timer_get_time();
+    const int64_t nowUtcUs = utcUs + (nowEsp - atEspUs);
+    int64_t boundaryUtcUs = (nowUtcUs / 1000000LL + 1) * 1000000LL;
+    if (boundaryUtcUs - nowUtcUs < UTC_ALIGNED_WRITE_MIN_LEAD_US) {
+        boundaryUtcUs += 1000000LL;
+    }
+    const int64_t boundaryEspUs = atEspUs + (boundaryUtcUs - utcUs);
+    const int64_t startEspUs = boundaryEspUs - (UTC_RTC_SECONDS_ACK_US + g_alignedWriteTrimUs);
+
+    const int64_t wakeInUs = startEspUs - UTC_ALIGNED_WRITE_WAKE_LEAD_US - esp_timer_get_time();
+    g_alignedWriteWaiter = xTaskGetCurrentTaskHandle();
+    ulTaskNotifyTake(pdTRUE, 0);
+    if (alignTimer != nullptr && wakeInUs > 0 && esp_timer_start_once(alignTimer, static_cast<uint64_t>(wakeInUs)) == ESP_OK) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(static_cast<uint32_t>(wakeInUs / 1000) + 100));
+    } else if (wakeInUs > 0) {
+        vTaskDelay(pdMS_TO_TICKS(static_cast<uint32_t>(wakeInUs / 1000)));
+    }
+    g_alignedWriteWaiter = nullptr;
+
+    // Последнюю миллисекунду не отдаём планировщику (WiFi-задачи ядра 0 выше по приоритету).
+    const UBaseType_t prevPriority = uxTaskPriorityGet(nullptr);
+    vTaskPrioritySet(nullptr, UTC_ALIGNED_WRITE_PRIORITY);
+    while (esp_timer_get_time() < startEspUs) {
+    }
+    writtenUtc = static_cast<time_t>(boundaryUtcUs / 1000000LL);
+    rtc->adjust(convertTimeTToDateTime(writtenUtc));
+    vTaskPrioritySet(nullptr, prevPriority);
+    return boundaryEspUs;
+}
+
+void setTimeToAllSourcesUs(int64_t utcUs, int64_t atEspUs) {
+    // utcUs — UTC на момент atEspUs (esp_timer): время, прошедшее с замера, добавляем сами.
+    if (ds3231_available && rtc) {
+        time_t writtenUtc = 0;
+        const int64_t boundaryEspUs = writeDs3231AtUtcBoundary(utcUs, atEspUs, writtenUtc);
+        setUtcAnchor(writtenUtc, boundaryEspUs, true);
+        Serial.print("\n[DS3231] обновлен на границе секунды");
+
+        int32_t phaseErrorUs = 0;
+        if (measureSqwPhaseAfterWrite(boundaryEspUs, phaseErrorUs)) {
+            // >0 — спад SQW позже секунды UTC: в следующий раз начинаем запись раньше.
+            int64_t trim = g_alignedWriteTrimUs + phaseErrorUs;
+            trim = (trim > UTC_ALIGNED_WRITE_TRIM_MAX_US) ? UTC_ALIGNED_WRITE_TRIM_MAX_US : trim;
+            trim = (trim < -UTC_ALIGNED_WRITE_TRIM_MAX_US) ? -UTC_ALIGNED_WRITE_TRIM_MAX_US : trim;
+            g_alignedWriteTrimUs = trim;
+            g_lastRtcWritePhaseUs = phaseErrorUs;
+            g_lastRtcWritePhaseValid = true;
+            Serial.printf("\n[DS3231] Фаза SQW относительно UTC: %+ld мкс (поправка записи %+ld мкс)",
+                          static_cast<long>(phaseErrorUs), static_cast<long>(g_alignedWriteTrimUs));
+        } else {
+            g_lastRtcWritePhaseValid = false;
+            Serial.print("\n[DS3231] Фаза SQW после записи не измерена (нет спада SQW)");
+        }
+    } else {
+        invalidateUtcAnchor();
+    }
+
+    const int64_t nowUtcUs = utcUs + (esp_timer_get_time() - atEspUs);
+    struct timeval tv = {
+        static_cast<time_t>(nowUtcUs / 1000000LL),
+        static_cast<suseconds_t>(nowUtcUs % 1000000LL)
+    };
+    settimeofday(&tv, NULL);
+    Serial.print("\n[RTC] обновлен");
+
+    invalidateTimeSnapshot();
     timeAdjustedFlag = true;
 }
 
+bool getLastRtcWritePhase(int32_t& phaseErrorUs) {
+    phaseErrorUs = g_lastRtcWritePhaseUs;
+    return g_lastRtcWritePhaseValid;
+}
+
 bool consumeTimeAdjustedFlag() {
     if (!timeAdjustedFlag) {
         return false;
@@ -355,23 +825,561 @@ void requestTimeTickResync() {
     timeAdjustedFlag = true;
 }
 
-static bool applyNtpTime(time_t utcTime, bool force, bool auto_sync_was_enabled) {
+// ===== NTP: обмен четырьмя метками времени =====
+// NTPClient::forceUpdate() ждёт ответ шагами delay(10) и берёт только целые секунды
+// transmit timestamp, поэтому секунда "плавает" в пределах окна опроса. Здесь T1/T4
+// меряются esp_timer, T2/T3 берутся с дробной частью, задержка сети вычитается, а из
+// нескольких запросов к серверу остаётся ответ с наименьшей круговой задержкой.
+// Все настроенные серверы опрашиваются одновременно (свой сокет на сервер), так что
+// мёртвый сервер не удлиняет синхронизацию и время работы радио.
+static constexpr uint8_t NTP_SERVER_COUNT = 3;
+static constexpr uint16_t NTP_SERVER_PORT = 123;
+static constexpr uint16_t NTP_LOCAL_PORT = 2390;               // сервер N -> порт 2390 + N - 1
+static constexpr uint8_t NTP_SAMPLES_PER_SERVER = 4;
+static constexpr uint8_t NTP_DEAD_AFTER_ROUNDS = 2;             // молчит 2 раунда подряд — больше не ждём
+static constexpr uint32_t NTP_DNS_TIMEOUT_MS = 3000;
+static constexpr uint32_t NTP_REPLY_TIMEOUT_MS = 800;
+static constexpr uint32_t NTP_SAMPLE_GAP_MS = 150;
+static constexpr int64_t NTP_MAX_DELAY_US = 500000;
+// Выбор ответа: серверы "согласны", если смещения расходятся не больше половины суммы
+// задержек плюс запас; каждая ступень stratum и штраф по истории стоят как лишняя задержка.
+static constexpr int64_t NTP_AGREEMENT_SLACK_US = 25000;
+static constexpr int64_t NTP_STRATUM_PENALTY_US = 5000;
+static constexpr int64_t NTP_PREFERRED_BONUS_US = 10000;
+static constexpr uint32_t NTP_FAILURE_PENALTY_US = 200000;      // за 100% неответов в истории
+
+// Табло серверов в cfg_nvs: привязано к имени сервера (хэш), при смене имени слот обнуляется.
+static constexpr const char* NTP_SCORE_NS = "ntp";
+static constexpr const char* NTP_SCORE_KEY = "score";
+static constexpr const char* NTP_SCORE_PARTITION = "cfg_nvs";
+static constexpr uint32_t NTP_SCORE_MAGIC = 0x4E545053;  // NTPS
+static constexpr uint32_t NTP_SCORE_VERSION = 1;
+static constexpr uint16_t NTP_SCORE_HISTORY = 64;        // дальше счётчики делятся пополам
+static constexpr uint8_t NTP_SCORE_DELAY_EMA_SHIFT = 2;  // EMA с весом 1/4
+
+struct NtpSample {
+    int64_t utcUs = 0;     // UTC на момент espUs: T3 + половина задержки
+    int64_t espUs = 0;     // esp_timer_get_time() при приёме ответа (T4)
+    int64_t delayUs = 0;   // круговая задержка без времени обработки на сервере
+    int64_t offsetUs = 0;  // насколько локальные часы UTC отстают от сервера
+    uint8_t stratum = 0;
+};
+
+// Состояние одного сервера на время синхронизации
+struct NtpServerSlot {
+    const char* host = nullptr;
+    IPAddress ip;
+    bool dnsOk = false;
+    bool alive = false;        // DNS разрешён, сервер ещё опрашивается
+    bool waiting = false;      // запрос текущего раунда без ответа
+    uint8_t missedRounds = 0;
+    NtpCookie cookie;
+    int64_t sendEsp = 0;
+    uint8_t samples = 0;
+    NtpSample best;
+    int64_t minOffsetUs = 0;
+    int64_t maxOffsetUs = 0;
+};
+
+struct NtpScoreRecord {
+    uint32_t magic;
+    uint32_t version;
+    NtpServerScore servers[NTP_SERVER_COUNT];
+    uint32_t crc;
+};
+
+static NtpSyncReport g_lastNtpReport;
+static NtpServerScore g_ntpScores[NTP_SERVER_COUNT] = {};
+static bool g_ntpScoresLoaded = false;
+
+static uint32_t ntpFnv1a(const uint8_t* bytes, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; ++i) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static const char* getNtpServerByIndex(uint8_t index) {
+    switch (index) {
+        case 1: return config.ntp_server_1;
+        case 2: return config.ntp_server_2;
+        case 3: return config.ntp_server_3;
+        default: return nullptr;
+    }
+}
+
+// --- Табло серверов ---
+
+static void loadNtpScores() {
+    if (g_ntpScoresLoaded) {
+        return;
+    }
+    g_ntpScoresLoaded = true;
+
+    Preferences prefs;
+    if (!prefs.begin(NTP_SCORE_NS, true, NTP_SCORE_PARTITION)) {
+        return;
+    }
+    NtpScoreRecord rec = {};
+    const bool ok = prefs.getBytesLength(NTP_SCORE_KEY) == sizeof(rec) &&
+                    prefs.getBytes(NTP_SCORE_KEY, &rec, sizeof(rec)) == sizeof(rec);
+    prefs.end();
+    if (!ok || rec.magic != NTP_SCORE_MAGIC || rec.version != NTP_SCORE_VERSION ||
+        rec.crc != ntpFnv1a(reinterpret_cast<const uint8_t*>(&rec), sizeof(rec) - sizeof(rec.crc))) {
+        return;
+    }
+    memcpy(g_ntpScores, rec.servers, sizeof(g_ntpScores));
+}
+
+static void saveNtpScores() {
+    NtpScoreRecord rec = {};
+    rec.magic = NTP_SCORE_MAGIC;
+    rec.version = NTP_SCORE_VERSION;
+    memcpy(rec.servers, g_ntpScores, sizeof(rec.servers));
+    rec.crc = ntpFnv1a(reinterpret_cast<const uint8_t*>(&rec), sizeof(rec) - sizeof(rec.crc));
+
+    Preferences prefs;
+    if (!prefs.begin(NTP_SCORE_NS, false, NTP_SCORE_PARTITION)) {
+        return;
+    }
+    prefs.putBytes(NTP_SCORE_KEY, &rec, sizeof(rec));
+    prefs.end();
+}
+
+// Слот табло для текущего имени сервера (при смене имени история начинается заново)
+static NtpServerScore& ntpScoreFor(uint8_t index) {
+    NtpServerScore& score = g_ntpScores[index - 1];
+    const char* host = getNtpServerByIndex(index);
+    const uint32_t hostHash = ntpFnv1a(reinterpret_cast<const uint8_t*>(host), strlen(host));
+    if (score.hostHash != hostHash) {
+        score = NtpServerScore();
+        score.hostHash = hostHash;
+    }
+    return score;
+}
+
+// Оценка по истории: средняя задержка + штраф за долю неответов. Меньше — лучше.
+static uint32_t ntpHistoryCost(const NtpServerScore& score) {
+    const uint32_t total = static_cast<uint32_t>(score.successes) + score.failures;
+    if (score.successes == 0) {
+        return UINT32_MAX;
+    }
+    return score.avgDelayUs + (NTP_FAILURE_PENALTY_US * score.failures) / total;
+}
+
+static uint8_t ntpPreferredByHistory() {
+    uint8_t bestIndex = 0;
+    uint32_t bestCost = UINT32_MAX;
+    for (uint8_t i = 1; i <= NTP_SERVER_COUNT; ++i) {
+        const char* host = getNtpServerByIndex(i);
+        if (!host || host[0] == '\0') {
+            continue;
+        }
+        const uint32_t cost = ntpHistoryCost(ntpScoreFor(i));
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestIndex = i;
+        }
+    }
+    return bestIndex;
+}
+
+static void ntpScoreUpdate(uint8_t index, const NtpServerSlot& slot, bool chosen) {
+    NtpServerScore& score = ntpScoreFor(index);
+    if (static_cast<uint32_t>(score.successes) + score.failures >= NTP_SCORE_HISTORY) {
+        score.successes /= 2;
+        score.failures /= 2;
+    }
+    if (slot.samples == 0) {
+        ++score.failures;
+        return;
+    }
+    const uint32_t delayUs = static_cast<uint32_t>(slot.best.delayUs);
+    if (score.successes == 0) {
+        score.avgDelayUs = delayUs;
+    } else {
+        const int32_t diff = static_cast<int32_t>(delayUs) - static_cast<int32_t>(score.avgDelayUs);
+        score.avgDelayUs = static_cast<uint32_t>(static_cast<int32_t>(score.avgDelayUs) + diff / (1 << NTP_SCORE_DELAY_EMA_SHIFT));
+    }
+    ++score.successes;
+    score.lastStratum = slot.best.stratum;
+    if (chosen && score.wins < UINT16_MAX) {
+        ++score.wins;
+    }
+}
+
+// --- DNS всех серверов одновременно ---
+// WiFi.hostByName() блокирует до ответа (или таймаута) на каждый сервер по очереди.
+// Запросы lwIP отправляются сразу для всех имён, ответы приходят в колбэк.
+// dns_gethostbyname() и колбэк работают только в задаче tcpip (вызов снаружи без
+// блокировки ядра lwIP портит таблицу DNS), поэтому запуск и отмена идут через
+// tcpip_callback(). Результаты лежат отдельно от слотов синхронизации и помечены
+// поколением: ответ, пришедший после таймаута или отмены, отбрасывается, а не
+// пишется в слоты следующей синхронизации.
+
+enum class NtpDnsState : uint8_t { Pending = 0, Ok = 1, Failed = 2 };
+
+static_assert(NTP_SERVER_COUNT <= 4, "DNS tag keeps the server index in two bits");
+
+// Поколение запроса и состояние упакованы в одно слово: (поколение << 2) | состояние.
+static inline uint32_t ntpDnsTag(uint32_t generation, uint8_t low) {
+    return (generation << 2) | low;
+}
+
+struct NtpDnsResult {
+    uint32_t ipv4 = 0;
+    std::atomic<uint32_t> status{0};
+};
+
+// Пишутся только из задачи tcpip; хосты задаёт синхронизация до запуска.
+static const char* g_ntpDnsHosts[NTP_SERVER_COUNT] = {};
+static NtpDnsResult g_ntpDnsResults[NTP_SERVER_COUNT];
+static uint32_t g_ntpDnsGeneration = 0;  // 0 — запросов нет (отменены)
+
+static void ntpDnsFoundCallback(const char* name, const ip_addr_t* ipaddr, void* arg) {
+    (void)name;
+    const uint32_t tag = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(arg));
+    const uint8_t index = static_cast<uint8_t>(tag & 0x3U);
+    if (g_ntpDnsGeneration == 0 || tag != ntpDnsTag(g_ntpDnsGeneration, index) || index >= NTP_SERVER_COUNT) {
+        return;  // ответ на отменённый запрос
+    }
+    NtpDnsResult& result = g_ntpDnsResults[index];
+    if (ipaddr && IP_IS_V4(ipaddr)) {
+        result.ipv4 = ip_2_ip4(ipaddr)->addr;
+        result.status.store(ntpDnsTag(g_ntpDnsGeneration, static_cast<uint8_t>(NtpDnsState::Ok)),
+                            std::memory_order_release);
+    } else {
+        result.status.store(ntpDnsTag(g_ntpDnsGeneration, static_cast<uint8_t>(NtpDnsState::Failed)),
+                            std::memory_order_release);
+    }
+}
+
+// Ответ (успех или ошибка) именно на запрос этого поколения
+static bool ntpDnsAnswered(uint8_t index, uint32_t generation, NtpDnsState* state) {
+    const uint32_t status = g_ntpDnsResults[index].status.load(std::memory_order_acquire);
+    if ((status >> 2) != generation) {
+        return false;
+    }
+    if (state) {
+        *state = static_cast<NtpDnsState>(status & 0x3U);
+    }
+    return true;
+}
+
+static void ntpDnsStartInTcpip(void* ctx) {
+    g_ntpDnsGeneration = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(ctx));
+    for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+        if (!g_ntpDnsHosts[i]) {
+            continue;
+        }
+        void* arg = reinterpret_cast<void*>(static_cast<uintptr_t>(ntpDnsTag(g_ntpDnsGeneration, i)));
+        ip_addr_t addr;
+        const err_t err = dns_gethostbyname(g_ntpDnsHosts[i], &addr, &ntpDnsFoundCallback, arg);
+        if (err == ERR_OK) {
+            ntpDnsFoundCallback(g_ntpDnsHosts[i], &addr, arg);  // из кэша lwIP
+        } else if (err != ERR_INPROGRESS) {
+            ntpDnsFoundCallback(g_ntpDnsHosts[i], nullptr, arg);
+        }
+    }
+}
+
+static void ntpDnsCancelInTcpip(void* ctx) {
+    (void)ctx;
+    g_ntpDnsGeneration = 0;
+}
+
+static void ntpResolveAll(NtpServerSlot* slots) {
+    // Поколение (30 бит) меняется на каждую синхронизацию; 0 не используется.
+    static uint32_t requestGeneration = 0;
+    requestGeneration = (requestGeneration + 1) & 0x3FFFFFFFUL;
+    if (requestGeneration == 0) {
+        requestGeneration = 1;
+    }
+
+    bool needDns = false;
+    for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+        NtpServerSlot& slot = slots[i];
+        g_ntpDnsHosts[i] = nullptr;
+        if (!slot.host) {
+            continue;
+        }
+        if (slot.ip.fromString(slot.host)) {
+            slot.dnsOk = true;
+            continue;
+        }
+        g_ntpDnsHosts[i] = slot.host;
+        needDns = true;
+    }
+
+    const bool started = needDns &&
+                         tcpip_callback(&ntpDnsStartInTcpip,
+                                        reinterpret_cast<void*>(static_cast<uintptr_t>(requestGeneration))) == ERR_OK;
+    if (started) {
+        const uint32_t startMs = millis();
+        while (millis() - startMs < NTP_DNS_TIMEOUT_MS) {
+            bool allDone = true;
+            for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+                // Статус прошлого поколения — тоже "ещё нет ответа".
+                allDone = allDone && (!g_ntpDnsHosts[i] || ntpDnsAnswered(i, requestGeneration, nullptr));
+            }
+            if (allDone) {
+                break;
+            }
+            vTaskDelay(pdMS_TO_TICKS(5));
+        }
+
+        for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+            NtpDnsState state = NtpDnsState::Pending;
+            if (g_ntpDnsHosts[i] && ntpDnsAnswered(i, requestGeneration, &state) && state == NtpDnsState::Ok) {
+                slots[i].ip = IPAddress(g_ntpDnsResults[i].ipv4);
+                slots[i].dnsOk = true;
+            }
+        }
+        // Не дождавшиеся ответа запросы больше никому не нужны.
+        (void)tcpip_callback(&ntpDnsCancelInTcpip, nullptr);
+    }
+
+    for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+        NtpServerSlot& slot = slots[i];
+        slot.alive = slot.dnsOk;
+        if (slot.host && !slot.dnsOk) {
+            Serial.printf("\n[NTP] DNS ошибка для сервера: %s", slot.host);
+        }
+    }
+}
+
+// --- Обмен пакетами ---
+
+static bool ntpSendRequest(WiFiUDP& udp, NtpServerSlot& slot) {
+    const int64_t nowEsp = esp_timer_get_time();
+    slot.cookie.sec = static_cast<uint32_t>(nowEsp / 1000000LL);
+    slot.cookie.frac = static_cast<uint32_t>(nowEsp) ^ 0x5A5AA5A5UL;
+    uint8_t packet[NTP_PACKET_SIZE];
+    ntpBuildRequest(packet, slot.cookie);
+
+    while (udp.parsePacket() > 0) {
+        udp.flush();  // хвосты прошлых обменов
+    }
+
+    if (!udp.beginPacket(slot.ip, NTP_SERVER_PORT)) {
+        return false;
+    }
+    udp.write(packet, NTP_PACKET_SIZE);
+    slot.sendEsp = esp_timer_get_time();
+    return udp.endPacket() != 0;
+}
+
+// Разбор ответа, если он пришёл. true — получен годный замер.
+static bool ntpReadReply(WiFiUDP& udp, NtpServerSlot& slot, NtpSample& out) {
+    const int size = udp.parsePacket();
+    if (size <= 0) {
+        return false;
+    }
+    const int64_t t4Esp = esp_timer_get_time();
+    const int64_t localAtT4Us = getCurrentUTCTimeUs();
+    if (size < static_cast<int>(NTP_PACKET_SIZE) || udp.remoteIP() != slot.ip) {
+        udp.flush();
+        return false;
+    }
+    uint8_t reply[NTP_PACKET_SIZE];
+    udp.read(reply, NTP_PACKET_SIZE);
+    udp.flush();
+
+    NtpExchange exchange;
+    const NtpReplyStatus status = ntpParseReply(reply, slot.cookie, slot.sendEsp, t4Esp,
+                                                NTP_MAX_DELAY_US, exchange);
+    if (status == NtpReplyStatus::Foreign) {
+        return false;  // не наш ответ
+    }
+    slot.waiting = false;
+
+    if (status == NtpReplyStatus::Rejected) {
+        Serial.printf("\n[NTP] %s: ответ отклонён (mode=%u LI=%u stratum=%u)", slot.host,
+                      static_cast<unsigned>(exchange.mode), static_cast<unsigned>(exchange.leap),
+                      static_cast<unsigned>(exchange.stratum));
+        return false;
+    }
+    if (status != NtpReplyStatus::Ok) {
+        return false;
+    }
+
+    out.utcUs = exchange.utcUs;
+    out.espUs = t4Esp;
+    out.delayUs = exchange.delayUs;
+    out.offsetUs = out.utcUs - localAtT4Us;
+    out.stratum = exchange.stratum;
+    return true;
+}
+
+static void ntpAcceptSample(NtpServerSlot& slot, const NtpSample& sample) {
+    if (slot.samples == 0 || sample.delayUs < slot.best.delayUs) {
+        slot.best = sample;
+    }
+    if (slot.samples == 0) {
+        slot.minOffsetUs = slot.maxOffsetUs = sample.offsetUs;
+    } else {
+        slot.minOffsetUs = (sample.offsetUs < slot.minOffsetUs) ? sample.offsetUs : slot.minOffsetUs;
+        slot.maxOffsetUs = (sample.offsetUs > slot.maxOffsetUs) ? sample.offsetUs : slot.maxOffsetUs;
+    }
+    ++slot.samples;
+}
+
+// Раунды запросов ко всем живым серверам. Ответы ждём опросом с vTaskDelay(1): задача
+// не держит ядро, а T4 получает погрешность не больше тика FreeRTOS (1 мс), а не 10 мс.
+static void ntpQueryAll(WiFiUDP* sockets, NtpServerSlot* slots) {
+    for (uint8_t round = 0; round < NTP_SAMPLES_PER_SERVER; ++round) {
+        if (round > 0) {
+            vTaskDelay(pdMS_TO_TICKS(NTP_SAMPLE_GAP_MS));
+        }
+
+        bool anyWaiting = false;
+        for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+            NtpServerSlot& slot = slots[i];
+            slot.waiting = slot.alive && ntpSendRequest(sockets[i], slot);
+            anyWaiting = anyWaiting || slot.waiting;
+        }
+        if (!anyWaiting) {
+            return;
+        }
+
+        const int64_t roundStartEsp = esp_timer_get_time();
+        while (anyWaiting &&
+               (esp_timer_get_time() - roundStartEsp) < static_cast<int64_t>(NTP_REPLY_TIMEOUT_MS) * 1000LL) {
+            bool received = false;
+            anyWaiting = false;
+            for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+                NtpServerSlot& slot = slots[i];
+                if (!slot.waiting) {
+                    continue;
+                }
+                NtpSample sample;
+                if (ntpReadReply(sockets[i], slot, sample)) {
+                    ntpAcceptSample(slot, sample);
+                    received = true;
+                }
+                anyWaiting = anyWaiting || slot.waiting;
+            }
+            if (!received) {
+                vTaskDelay(1);
+            }
+        }
+
+        for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+            NtpServerSlot& slot = slots[i];
+            if (!slot.alive) {
+                continue;
+            }
+            slot.missedRounds = slot.waiting ? static_cast<uint8_t>(slot.missedRounds + 1) : 0;
+            if (slot.samples == 0 && slot.missedRounds >= NTP_DEAD_AFTER_ROUNDS) {
+                Serial.printf("\n[NTP] %s не отвечает", slot.host);
+                slot.alive = false;
+            }
+        }
+    }
+}
+
+// Выбор ответа: сначала отбрасываются серверы, не согласные ни с одним другим
+// (если ответили хотя бы двое), затем минимум "задержка + штраф за stratum".
+// Сервер из явного выбора пользователя или лучший по истории получает бонус.
+static int8_t ntpSelectServer(const NtpServerSlot* slots, uint8_t preferredIndex) {
+    bool agrees[NTP_SERVER_COUNT] = {false};
+    uint8_t answered = 0;
+    uint8_t agreeing = 0;
+    for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+        answered += (slots[i].samples > 0) ? 1 : 0;
+    }
+    for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+        if (slots[i].samples == 0) {
+            continue;
+        }
+        for (uint8_t j = 0; j < NTP_SERVER_COUNT; ++j) {
+            if (j == i || slots[j].samples == 0) {
+                continue;
+            }
+            int64_t diff = slots[i].best.offsetUs - slots[j].best.offsetUs;
+            diff = (diff < 0) ? -diff : diff;
+            const int64_t windowUs = (slots[i].best.delayUs + slots[j].best.delayUs) / 2 + NTP_AGREEMENT_SLACK_US;
+            if (diff <= windowUs) {
+                agrees[i] = true;
+                break;
+            }
+        }
+        agreeing += agrees[i] ? 1 : 0;
+    }
+
+    // Одиночный ответ или полное расхождение: согласованности нет, выбираем из всех.
+    const bool useAgreement = answered >= 2 && agreeing > 0;
+    if (answered >= 2 && agreeing == 0) {
+        Serial.print("\n[NTP] ⚠️ Серверы расходятся между собой");
+    }
+
+    int8_t bestSlot = -1;
+    int64_t bestCost = 0;
+    for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+        const NtpServerSlot& slot = slots[i];
+        if (slot.samples == 0 || (useAgreement && !agrees[i])) {
+            continue;
+        }
+        int64_t cost = slot.best.delayUs + static_cast<int64_t>(slot.best.stratum - 1) * NTP_STRATUM_PENALTY_US;
+        if (preferredIndex == i + 1) {
+            cost -= NTP_PREFERRED_BONUS_US;
+        }
+        if (bestSlot < 0 || cost < bestCost) {
+            bestSlot = static_cast<int8_t>(i);
+            bestCost = cost;
+        }
+    }
+    return bestSlot;
+}
+
+NtpSyncReport getLastNtpReport() {
+    return g_lastNtpReport;
+}
+
+void printNtpScoreboard() {
+    loadNtpScores();
+    const uint8_t preferred = ntpPreferredByHistory();
+    for (uint8_t i = 1; i <= NTP_SERVER_COUNT; ++i) {
+        const char* host = getNtpServerByIndex(i);
+        if (!host || host[0] == '\0') {
+            continue;
+        }
+        const NtpServerScore& score = ntpScoreFor(i);
+        Serial.printf("\n  NTP %u%s %s: ответов %u, неудач %u, выбран %u раз, задержка ~%.1f мс, stratum %u",
+                      static_cast<unsigned>(i), (i == preferred) ? "*" : " ", host,
+                      static_cast<unsigned>(score.successes), static_cast<unsigned>(score.failures),
+                      static_cast<unsigned>(score.wins), score.avgDelayUs / 1000.0,
+                      static_cast<unsigned>(score.lastStratum));
+    }
+}
+
+static bool applyNtpTime(const NtpSample& sample, bool force, bool auto_sync_was_enabled) {
     // Проверяем, что время валидное (не 1970 год)
     // Используем порог: 2025-07-06 07:05:00 UTC (наше значение по умолчанию)
-    if (utcTime <= 1751785500) { // После 2025-07-06 07:05 UTC
+    const time_t sampleUtc = static_cast<time_t>(sample.utcUs / 1000000LL);
+    if (sampleUtc <= 1751785500) { // После 2025-07-06 07:05 UTC
         Serial.print("\n[NTP] Ошибка: получено некорректное время");
         return false;
     }
 
+    // Ошибка DS3231 к этому моменту = -(поправка NTP), если часы UTC шли по его SQW.
+    const bool rtcPhaseKnown = getUtcClockStatus().source == UtcClockSource::Ds3231Sqw;
+    rtcDisciplineOnNtpSample(sampleUtc, -sample.offsetUs, rtcPhaseKnown);
+
+    // Устанавливаем UTC время во все источники и поднимаем флаг коррекции времени.
+    // DS3231 пишется на границе секунды, поэтому utcTime берётся уже после установки.
+    setTimeToAllSourcesUs(sample.utcUs, sample.espUs);
+    const time_t utcTime = static_cast<time_t>((sample.utcUs + (esp_timer_get_time() - sample.espUs)) / 1000000LL);
+    rtcDisciplineOnRtcSet(utcTime, true);
+
     // Выводим полученное UTC время
     struct tm *tm_utc = gmtime(&utcTime);
     Serial.printf("\n[NTP] Получено UTC: %04d-%02d-%02d %02d:%02d:%02d", 
                tm_utc->tm_year + 1900, tm_utc->tm_mon + 1, tm_utc->tm_mday,
                tm_utc->tm_hour, tm_utc->tm_min, tm_utc->tm_sec);
 
-    // Устанавливаем UTC время во все источники и поднимаем флаг коррекции времени.
-    setTimeToAllSources(utcTime);
-    
     // Показываем информацию о режиме работы с часовыми поясами
     if (config.time_config.automatic_localtime) {
         Serial.print("\n[TZ] Автоматическое определение локального времени включено");
@@ -389,48 +1397,49 @@ static bool applyNtpTime(time_t utcTime, bool force, bool auto_sync_was_enabled)
         }
         
         // Получаем и выводим данные от ezTime
-        int8_t eztime_offset = 0;
+        int32_t eztime_offset_min = 0;
         bool eztime_dst = false;
-        if (!getEzTimeData(utcTime, eztime_offset, eztime_dst)) {
-            // Fallback: используем текущую логику конвертации (может быть таблица/офлайн POSIX)
-            utcToLocal(utcTime);
-            eztime_offset = config.time_config.current_offset;
-            eztime_dst = config.time_config.current_dst_active;
-        }
-        
-        Serial.printf("\n[TZ] - [ONLINE] Сравнение с интернет (ezTime): UTC%+d, DST: %s", 
-                     eztime_offset,
-                     eztime_dst ? "ON" : "OFF");
-        
-        // Сверяем с локальной таблицей
-        const TimezonePreset* preset = findPresetByLocation(config.time_config.timezone_name);
-        if (preset) {
-            bool local_dst = calculateDSTStatus(utcTime, preset);
-            int8_t local_offset = local_dst ? preset->dst_offset : preset->std_offset;
-
-            bool current_match = (eztime_offset == local_offset && eztime_dst == local_dst);
-            struct tm* utc_tm = gmtime(&utcTime);
-            int year = utc_tm ? (utc_tm->tm_year + 1900) : 0;
-            bool rules_match = (year > 0) ? compareDSTRulesWithEzTime(preset, year, 2, false) : true;
-
-            if (current_match && rules_match) {
-                Serial.print("\n[TZ] ✅ СОВПАДЕНИЕ - локальные правила актуальны");
-                if (clearPosixOverrideIfZone(config.time_config.timezone_name)) {
-                    saveConfig();
-                }
-            } else {
-                Serial.print("\n[TZ] ⚠️  РАСХОЖДЕНИЕ! Требуется обновление локальных правил");
-                if (!current_match) {
-                    Serial.printf("\n[TZ]    ezTime: UTC%+d, DST: %s", eztime_offset, eztime_dst ? "ON" : "OFF");
-                    Serial.printf("\n[TZ]    Таблица: UTC%+d, DST: %s", local_offset, local_dst ? "ON" : "OFF");
-                }
-                if (!rules_match) {
-                    Serial.print("\n[TZ]    Переходы DST: РАСХОЖДЕНИЕ");
-                }
+        if (!getEzTimeData(utcTime, eztime_offset_min, eztime_dst)) {
+            // Сверять не с чем: действующие правила (tzdb/офлайн POSIX) не трогаем
+            Serial.print("\n[TZ] ezTime не ответил, сверка правил пропущена");
+        } else {
+            char eztime_str[16];
+            formatUtcOffset(eztime_str, sizeof(eztime_str), eztime_offset_min);
+            Serial.printf("\n[TZ] - [ONLINE] Сравнение с интернет (ezTime): %s, DST: %s",
+                         eztime_str, eztime_dst ? "ON" : "OFF");
+
+            // Сверяем с офлайн-правилами, которые действуют без ezTime и POSIX: tzdb,
+            // иначе таблица. Сохранённый POSIX важнее tzdb, поэтому пишется только
+            // при расхождении именно с ними.
+            int32_t offline_offset_min = 0;
+            bool offline_dst = false;
+            if (getOfflineZoneState(utcTime, offline_offset_min, offline_dst)) {
+                bool current_match = (eztime_offset_min == offline_offset_min && eztime_dst == offline_dst);
+                struct tm* utc_tm = gmtime(&utcTime);
+                int year = utc_tm ? (utc_tm->tm_year + 1900) : 0;
+                bool rules_match = (year > 0) ? compareOfflineRulesWithEzTime(year, 2, false) : true;
+
+                if (current_match && rules_match) {
+                    Serial.print("\n[TZ] ✅ СОВПАДЕНИЕ - локальные правила актуальны");
+                    if (clearPosixOverrideIfZone(config.time_config.timezone_name)) {
+                        saveConfig();
+                    }
+                } else {
+                    Serial.print("\n[TZ] ⚠️  РАСХОЖДЕНИЕ! Требуется обновление локальных правил");
+                    if (!current_match) {
+                        char offline_str[16];
+                        formatUtcOffset(offline_str, sizeof(offline_str), offline_offset_min);
+                        Serial.printf("\n[TZ]    ezTime: %s, DST: %s", eztime_str, eztime_dst ? "ON" : "OFF");
+                        Serial.printf("\n[TZ]    Офлайн: %s, DST: %s", offline_str, offline_dst ? "ON" : "OFF");
+                    }
+                    if (!rules_match) {
+                        Serial.print("\n[TZ]    Переходы DST: РАСХОЖДЕНИЕ");
+                    }
 
-                if (savePosixOverride(config.time_config.timezone_name)) {
-                    saveConfig();
-                    Serial.print("\n[TZ] 💾 POSIX правила сохранены для офлайн-работы");
+                    if (savePosixOverride(config.time_config.timezone_name)) {
+                        saveConfig();
+                        Serial.print("\n[TZ] 💾 POSIX правила сохранены для офлайн-работы");
+                    }
                 }
             }
         }
@@ -439,10 +1448,11 @@ static bool applyNtpTime(time_t utcTime, bool force, bool auto_sync_was_enabled)
         Serial.printf("\n[TZ] Локация: %s (режим: табличные данные)", config.time_config.timezone_name);
         
         // Получаем данные из таблицы
-        utcToLocal(utcTime);  // Это обновит current_offset и current_dst_active
-        Serial.printf("\n[TZ] Данные из таблицы: UTC%+d, DST: %s", 
-                     config.time_config.current_offset,
-                     config.time_config.current_dst_active ? "ON" : "OFF");
+        bool local_dst = false;
+        const time_t local = utcToLocal(utcTime, local_dst);
+        char offset_str[16];
+        formatUtcOffset(offset_str, sizeof(offset_str), static_cast<int32_t>((local - utcTime) / 60));
+        Serial.printf("\n[TZ] Данные из таблицы: %s, DST: %s", offset_str, local_dst ? "ON" : "OFF");
     }
     
     // Обновляем время последней синхронизации в конфиге
@@ -452,65 +1462,84 @@ static bool applyNtpTime(time_t utcTime, bool force, bool auto_sync_was_enabled)
     return true;
 }
 
-static const char* getNtpServerByIndex(uint8_t index) {
-    switch (index) {
-        case 1: return config.ntp_server_1;
-        case 2: return config.ntp_server_2;
-        case 3: return config.ntp_server_3;
-        default: return nullptr;
-    }
-}
-
 static bool trySyncWithNtpServers(bool force, bool auto_sync_was_enabled, uint8_t preferredIndex) {
-    uint8_t order[3];
-    uint8_t count = 0;
-
-    if (preferredIndex >= 1 && preferredIndex <= 3) {
-        order[count++] = preferredIndex;
+    loadNtpScores();
+    if (preferredIndex < 1 || preferredIndex > NTP_SERVER_COUNT) {
+        preferredIndex = ntpPreferredByHistory();
     }
-    for (uint8_t i = 1; i <= 3; ++i) {
-        if (i == preferredIndex) {
-            continue;
+
+    // static: слоты велики для стека задачи. Синхронизация идёт одна (syncInProgress).
+    static NtpServerSlot slots[NTP_SERVER_COUNT];
+    bool anyServer = false;
+    for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+        slots[i] = NtpServerSlot();
+        const char* server = getNtpServerByIndex(i + 1);
+        if (server && server[0] != '\0') {
+            slots[i].host = server;
+            anyServer = true;
         }
-        order[count++] = i;
+    }
+    if (!anyServer) {
+        Serial.print("\n[NTP] Серверы не настроены");
+        return false;
     }
 
-    for (uint8_t i = 0; i < count; ++i) {
-        const char* server = getNtpServerByIndex(order[i]);
-        if (!server || server[0] == '\0') {
-            continue;
-        }
+    Serial.printf("\n[NTP] Опрос серверов параллельно (приоритет: %u)", static_cast<unsigned>(preferredIndex));
+    ntpResolveAll(slots);
 
-        Serial.printf("\n[NTP] Используем сервер: %s", server);
+    WiFiUDP sockets[NTP_SERVER_COUNT];
+    for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+        if (slots[i].alive && !sockets[i].begin(NTP_LOCAL_PORT + i)) {
+            slots[i].alive = false;
+        }
+    }
+    ntpQueryAll(sockets, slots);
+    for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+        sockets[i].stop();
+    }
 
-        IPAddress resolvedIp;
-        if (!WiFi.hostByName(server, resolvedIp)) {
-            Serial.printf("[NTP] DNS ошибка для сервера: %s\n", server);
+    uint8_t answered = 0;
+    for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+        const NtpServerSlot& slot = slots[i];
+        if (slot.samples == 0) {
             continue;
         }
+        ++answered;
+        Serial.printf("\n[NTP] %s: ответов %u/%u, stratum %u, задержка %.1f мс, смещение %+.1f мс, разброс %.1f мс",
+                      slot.host, static_cast<unsigned>(slot.samples), static_cast<unsigned>(NTP_SAMPLES_PER_SERVER),
+                      static_cast<unsigned>(slot.best.stratum), slot.best.delayUs / 1000.0,
+                      slot.best.offsetUs / 1000.0, (slot.maxOffsetUs - slot.minOffsetUs) / 1000.0);
+    }
 
-        try {
-            NTPClient client(ntpUDP, resolvedIp, 0);
-            client.begin();
-            client.setTimeOffset(0); // Запрашиваем UTC
-            
-            if (client.forceUpdate()) {
-                time_t utcTime = client.getEpochTime();
-                if (applyNtpTime(utcTime, force, auto_sync_was_enabled)) {
-                    client.end();
-                    return true;
-                }
-            } else {
-                Serial.print("\n[NTP] Ошибка: forceUpdate() не удался");
-            }
-            
-            client.end();
-        } catch (...) {
-            Serial.print("\n[NTP] Исключение при синхронизации!");
+    const int8_t chosen = ntpSelectServer(slots, preferredIndex);
+    for (uint8_t i = 0; i < NTP_SERVER_COUNT; ++i) {
+        if (slots[i].host) {
+            ntpScoreUpdate(i + 1, slots[i], i == chosen);
         }
     }
+    saveNtpScores();
 
-    return false;
+    if (chosen < 0) {
+        Serial.print("\n[NTP] Ошибка: ни один сервер не ответил");
+        return false;
+    }
+
+    const NtpServerSlot& best = slots[chosen];
+    Serial.printf("\n[NTP] Используем сервер: %s", best.host);
+    if (!applyNtpTime(best.best, force, auto_sync_was_enabled)) {
+        return false;
+    }
+
+    g_lastNtpReport.valid = true;
+    g_lastNtpReport.serverIndex = static_cast<uint8_t>(chosen + 1);
+    g_lastNtpReport.stratum = best.best.stratum;
+    g_lastNtpReport.samples = best.samples;
+    g_lastNtpReport.serversAnswered = answered;
+    g_lastNtpReport.delayUs = static_cast<int32_t>(best.best.delayUs);
+    g_lastNtpReport.offsetUs = best.best.offsetUs;
+    g_lastNtpReport.jitterUs = static_cast<int32_t>(best.maxOffsetUs - best.minOffsetUs);
+    g_lastNtpReport.syncedUtc = config.time_config.last_ntp_sync;
+    return true;
 }
 
 // ===== ASYNC SYNC (FreeRTOS Task) =====
@@ -536,40 +1565,22 @@ static void wifiSyncTask(void* param) {
     delay(200);
     Serial.print("\n[WiFi] WiFi.STA: OK");
 
-    // --- Шаг 2: Подключение к сети 1 ---
-    Serial.print("\n[WiFi] Подключение к сети 1");
-    WiFi.begin(syncSsid1, syncPass1);
-
-    int attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && attempts < 30) {
-        delay(300);
-        Serial.print(".");
-        attempts++;
-    }
-
-    if (WiFi.status() == WL_CONNECTED) {
+    // --- Шаг 2: Подключение к сети 1 (сначала по кэшу BSSID/канала/аренды) ---
+    WifiConnectInfo connectInfo;
+    const char* connectedSsid = nullptr;
+    if (wifiFastConnect(syncSsid1, syncPass1, WIFI_SYNC_CONNECT_TIMEOUT_MS, "[WiFi]", &connectInfo)) {
         networkNum = 1;
-        Serial.printf("\n[WiFi] Подключено к %s (сеть 1)", syncSsid1);
+        connectedSsid = syncSsid1;
     } else {
         Serial.print("\n[WiFi] Не удалось подключиться к сети 1");
-        
+
         // --- Шаг 3: Попытка сети 2 (если настроена) ---
         if (strlen(syncSsid2) > 0) {
-            Serial.print("\n[WiFi] Подключение к сети 2");
             WiFi.disconnect(false);
             delay(100);
-            WiFi.begin(syncSsid2, syncPass2);
-
-            attempts = 0;
-            while (WiFi.status() != WL_CONNECTED && attempts < 30) {
-                delay(300);
-                Serial.print(".");
-                attempts++;
-            }
-
-            if (WiFi.status() == WL_CONNECTED) {
+            if (wifiFastConnect(syncSsid2, syncPass2, WIFI_SYNC_CONNECT_TIMEOUT_MS, "[WiFi]", &connectInfo)) {
                 networkNum = 2;
-                Serial.printf("\n[WiFi] Подключено к %s (сеть 2)", syncSsid2);
+                connectedSsid = syncSsid2;
             } else {
                 Serial.print("\n[WiFi] Не удалось подключиться к сети 2");
             }
@@ -582,23 +1593,21 @@ static void wifiSyncTask(void* param) {
                       WiFi.localIP().toString().c_str(), WiFi.RSSI());
 
         success = trySyncWithNtpServers(syncForceFlag, syncAutoEnabledSnapshot, syncPreferredNtpIndex);
+        if (!success && connectInfo.cachedLease) {
+            // Адрес из кэша мог устареть (роутер сменил подсеть/аренду): в следующий раз — DHCP
+            wifiFastConnectDropLease(connectedSsid);
+        }
 
         // Если не удалось через сеть 1 — попробовать через сеть 2
         if (!success && networkNum == 1 && strlen(syncSsid2) > 0) {
             Serial.print("\n[NTP] Попытка через сеть 2...");
             WiFi.disconnect(false);
             delay(100);
-            WiFi.begin(syncSsid2, syncPass2);
-
-            attempts = 0;
-            while (WiFi.status() != WL_CONNECTED && attempts < 30) {
-                delay(300);
-                Serial.print(".");
-                attempts++;
-            }
-
-            if (WiFi.status() == WL_CONNECTED) {
+            if (wifiFastConnect(syncSsid2, syncPass2, WIFI_SYNC_CONNECT_TIMEOUT_MS, "[WiFi]", &connectInfo)) {
                 success = trySyncWithNtpServers(syncForceFlag, syncAutoEnabledSnapshot, syncPreferredNtpIndex);
+                if (!success && connectInfo.cachedLease) {
+                    wifiFastConnectDropLease(syncSsid2);
+                }
             }
         }
     }
@@ -692,26 +1701,24 @@ void syncTimeAsync(bool force, uint8_t preferredNtpIndex) {
 
 
 bool printTime() {
-    // Получаем время через getCurrentUTCTime() - она сама определит источник
-    time_t utcTime = getCurrentUTCTime();
+    // Снимок секунды: тот же "сейчас", что видят дисплей и будильники
+    const TimeSnapshot now = getTimeSnapshot();
+    time_t utcTime = now.utc;
     
     if (utcTime > 0) {
         
         // Вывод локального времени
-        time_t local = utcToLocal(utcTime);
-        struct tm local_tm;
-        gmtime_r(&local, &local_tm);
         char lbuf[128];
-        strftime(lbuf, sizeof(lbuf), "\nTime: %a %d.%m.%Y %H:%M:%S", &local_tm);
+        strftime(lbuf, sizeof(lbuf), "\nTime: %a %d.%m.%Y %H:%M:%S", &now.localTm);
         Serial.print(lbuf);
         
         // Timezone info
-        Serial.printf(" (TZ: %s) UTC%+d", 
-                     config.time_config.timezone_name,
-                     config.time_config.current_offset);
+        char offset_str[16];
+        formatUtcOffset(offset_str, sizeof(offset_str), static_cast<int32_t>(now.offsetSec / 60));
+        Serial.printf(" (TZ: %s) %s", config.time_config.timezone_name, offset_str);
         
         // DST info - показываем только если активен
-        if (config.time_config.current_dst_active) {
+        if (now.dst) {
             Serial.print(", DST ON");
         }
 
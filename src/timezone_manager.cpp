@@ -1,7 +1,12 @@
 #include "config.h"
 #include "timezone_manager.h"
 #include "menu_manager.h"
+#include "time_utils.h"
+#include "tzdb.h"
 #include <string.h>
+#include <atomic>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
 #include <ezTime.h>
 #include <WiFi.h>
 
@@ -121,6 +126,51 @@ uint8_t getPresetsCount() {
     return PRESETS_COUNT;
 }
 
+// Зоны tzdb, которых нет среди пресетов (дробные смещения и т.п.) - в списке после пресетов
+static const TzdbZone* getExtraZoneByIndex(uint8_t index) {
+    uint8_t found = 0;
+    for (uint16_t i = 0; i < tzdbZoneCount(); i++) {
+        const TzdbZone* zone = tzdbZoneAt(i);
+        if (findPresetByLocation(zone->name)) continue;
+        if (found == index) return zone;
+        found++;
+    }
+    return nullptr;
+}
+
+static uint8_t getExtraZonesCount() {
+    uint8_t count = 0;
+    while (getExtraZoneByIndex(count)) count++;
+    return count;
+}
+
+uint8_t getSelectableZonesCount() {
+    return static_cast<uint8_t>(PRESETS_COUNT + getExtraZonesCount());
+}
+
+const char* getSelectableZoneName(uint8_t index) {
+    if (index < PRESETS_COUNT) return TIMEZONE_PRESETS[index].zone_name;
+    const TzdbZone* zone = getExtraZoneByIndex(static_cast<uint8_t>(index - PRESETS_COUNT));
+    return zone ? zone->name : nullptr;
+}
+
+const char* getZoneDisplayName(const char* location) {
+    const TimezonePreset* preset = findPresetByLocation(location);
+    if (preset) return preset->display_name;
+    const TzdbZone* zone = tzdbFindZone(location);
+    return zone ? zone->displayName : nullptr;
+}
+
+void formatUtcOffset(char* buf, size_t size, int32_t offsetMin) {
+    const char sign = offsetMin < 0 ? '-' : '+';
+    const int32_t absMin = offsetMin < 0 ? -offsetMin : offsetMin;
+    if (absMin % 60) {
+        snprintf(buf, size, "UTC%c%ld:%02ld", sign, (long)(absMin / 60), (long)(absMin % 60));
+    } else {
+        snprintf(buf, size, "UTC%c%ld", sign, (long)(absMin / 60));
+    }
+}
+
 // ========== ВЫЧИСЛЕНИЕ DST ==========
 
 // UTC-safe расчёты (не зависят от TZ системы)
@@ -147,6 +197,20 @@ static unsigned daysInMonth(int year, unsigned month) {
     return static_cast<unsigned>(last_day);
 }
 
+// Год UTC без gmtime() (обратное к daysFromCivil, реентерабельно)
+static int civilYearFromUtc(time_t utc) {
+    int64_t days = static_cast<int64_t>(utc) / 86400;
+    if (static_cast<int64_t>(utc) % 86400 < 0) days--;
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(days - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    const unsigned m = mp < 10 ? mp + 3 : mp - 9;
+    return static_cast<int>(static_cast<int64_t>(yoe) + era * 400 + (m <= 2 ? 1 : 0));
+}
+
 static time_t makeUtcTime(int year, int month, int day, int hour, int minute, int second) {
     int64_t days = daysFromCivil(year, static_cast<unsigned>(month), static_cast<unsigned>(day));
     int64_t secs = days * 86400 + hour * 3600 + minute * 60 + second;
@@ -192,8 +256,7 @@ bool calculateDSTStatus(time_t utc, const TimezonePreset* preset) {
         return false;
     }
     
-    struct tm* tm_utc = gmtime(&utc);
-    int year = tm_utc->tm_year + 1900;
+    int year = civilYearFromUtc(utc);
     
     // Вычисляем точки перехода для текущего года
     time_t dst_start = calculateDSTTransition(year, preset->dst_start_month, preset->dst_start_week,
@@ -210,6 +273,520 @@ bool calculateDSTStatus(time_t utc, const TimezonePreset* preset) {
     return (utc >= dst_start && utc < dst_end);
 }
 
+// ========== КОМПАКТНОЕ ПРАВИЛО ПОЯСА ==========
+// Пресет таблицы и POSIX-строка приводятся к одному виду: два смещения и две даты
+// перехода. Разбор строки - один раз при сохранении/загрузке, вычисление без кучи.
+
+struct TzRuleDate {
+    uint8_t kind;
+    uint8_t month;
+    uint8_t week;
+    uint8_t dow;
+    uint16_t yday;
+    int32_t timeSec;             // Местное время перехода (POSIX допускает -167..167 ч)
+};
+
+struct TzRule {
+    int32_t stdOffsetSec;        // Восток от UTC положителен (UTC+1 = 3600)
+    int32_t dstOffsetSec;
+    bool hasDst;
+    TzRuleDate start;            // Переход на летнее (по стандартному смещению)
+    TzRuleDate end;              // Возврат на зимнее (по летнему смещению)
+};
+
+static bool isLeapYear(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+}
+
+// Момент перехода в UTC; offsetBeforeSec - смещение, действующее до перехода
+static time_t tzRuleDateToUtc(int year, const TzRuleDate& date, int32_t offsetBeforeSec) {
+    int64_t days;
+    if (date.kind == TZ_RULE_JULIAN_NOLEAP) {
+        days = daysFromCivil(year, 1, 1) + date.yday - 1;
+        if (date.yday >= 60 && isLeapYear(year)) days++;
+    } else if (date.kind == TZ_RULE_ZERO_BASED) {
+        days = daysFromCivil(year, 1, 1) + date.yday;
+    } else {
+        int first_dow = weekdayFromCivil(year, date.month, 1);
+        int day = 1 + (date.dow - first_dow + 7) % 7;
+        if (date.week <= 4) {
+            day += (date.week - 1) * 7;
+        } else {
+            day += 3 * 7;
+            if (day + 7 <= static_cast<int>(daysInMonth(year, date.month))) day += 7;
+        }
+        days = daysFromCivil(year, date.month, static_cast<unsigned>(day));
+    }
+    return static_cast<time_t>(days * 86400 + date.timeSec - offsetBeforeSec);
+}
+
+static void tzRuleFromPreset(const TimezonePreset* preset, TzRule& rule) {
+    rule.stdOffsetSec = preset->std_offset * 3600;
+    rule.dstOffsetSec = preset->dst_offset * 3600;
+    rule.hasDst = (preset->dst_offset != preset->std_offset && preset->dst_start_month != 0);
+    rule.start = {TZ_RULE_MONTH_WEEK_DAY, preset->dst_start_month, preset->dst_start_week,
+                  preset->dst_start_dow, 0, preset->dst_start_hour * 3600};
+    rule.end = {TZ_RULE_MONTH_WEEK_DAY, preset->dst_end_month, preset->dst_end_week,
+                preset->dst_end_dow, 0, preset->dst_end_hour * 3600};
+}
+
+static void tzRuleFromTzdb(const TzdbZone* zone, TzRule& rule) {
+    rule.stdOffsetSec = zone->stdOffsetMin * 60;
+    rule.dstOffsetSec = zone->dstOffsetMin * 60;
+    rule.hasDst = zone->hasDst != 0;
+    rule.start = {zone->start.kind, zone->start.month, zone->start.week, zone->start.dow,
+                  zone->start.yday, zone->start.timeMin * 60};
+    rule.end = {zone->end.kind, zone->end.month, zone->end.week, zone->end.dow,
+                zone->end.yday, zone->end.timeMin * 60};
+}
+
+// --- Разбор POSIX TZ: std offset [dst [offset] [,start[/time],end[/time]]] ---
+
+static const char* parsePosixName(const char* p) {
+    const char* begin = p;
+    if (*p == '<') {
+        while (*p && *p != '>') p++;
+        if (*p != '>') return nullptr;
+        return (p - begin >= 2) ? p + 1 : nullptr;
+    }
+    while ((*p >= 'A' && *p <= 'Z') || (*p >= 'a' && *p <= 'z')) p++;
+    return (p - begin >= 3) ? p : nullptr;
+}
+
+static const char* parsePosixNumber(const char* p, int32_t maxValue, int32_t& value) {
+    if (*p < '0' || *p > '9') return nullptr;
+    value = 0;
+    while (*p >= '0' && *p <= '9') {
+        value = value * 10 + (*p - '0');
+        if (value > maxValue) return nullptr;
+        p++;
+    }
+    return p;
+}
+
+// [+-]hh[:mm[:ss]] в секундах
+static const char* parsePosixTime(const char* p, int32_t maxHours, int32_t& seconds) {
+    int32_t sign = 1;
+    if (*p == '+' || *p == '-') {
+        if (*p == '-') sign = -1;
+        p++;
+    }
+    int32_t hours = 0, minutes = 0, secs = 0;
+    p = parsePosixNumber(p, maxHours, hours);
+    if (!p) return nullptr;
+    if (*p == ':') {
+        p = parsePosixNumber(p + 1, 59, minutes);
+        if (!p) return nullptr;
+        if (*p == ':') {
+            p = parsePosixNumber(p + 1, 59, secs);
+            if (!p) return nullptr;
+        }
+    }
+    seconds = sign * (hours * 3600 + minutes * 60 + secs);
+    return p;
+}
+
+static const char* parsePosixRuleDate(const char* p, TzRuleDate& date) {
+    int32_t a = 0, b = 0, c = 0;
+    date = {TZ_RULE_MONTH_WEEK_DAY, 0, 0, 0, 0, 2 * 3600};  // время по умолчанию 02:00
+    if (*p == 'M') {
+        p = parsePosixNumber(p + 1, 12, a);
+        if (!p || a < 1 || *p != '.') return nullptr;
+        p = parsePosixNumber(p + 1, 5, b);
+        if (!p || b < 1 || *p != '.') return nullptr;
+        p = parsePosixNumber(p + 1, 6, c);
+        if (!p) return nullptr;
+        date.month = static_cast<uint8_t>(a);
+        date.week = static_cast<uint8_t>(b);
+        date.dow = static_cast<uint8_t>(c);
+    } else if (*p == 'J') {
+        p = parsePosixNumber(p + 1, 365, a);
+        if (!p || a < 1) return nullptr;
+        date.kind = TZ_RULE_JULIAN_NOLEAP;
+        date.yday = static_cast<uint16_t>(a);
+    } else {
+        p = parsePosixNumber(p, 365, a);
+        if (!p) return nullptr;
+        date.kind = TZ_RULE_ZERO_BASED;
+        date.yday = static_cast<uint16_t>(a);
+    }
+    if (*p == '/') {
+        p = parsePosixTime(p + 1, 167, date.timeSec);
+    }
+    return p;
+}
+
+static bool compilePosixRule(const char* posix, TzRule& rule) {
+    if (!posix) return false;
+    const char* p = parsePosixName(posix);
+    int32_t posixOffset = 0;
+    if (!p || !(p = parsePosixTime(p, 24, posixOffset))) return false;
+
+    // POSIX: смещение на запад положительно (CET-1 = UTC+1)
+    rule.stdOffsetSec = -posixOffset;
+    rule.dstOffsetSec = rule.stdOffsetSec;
+    rule.hasDst = false;
+    if (*p == '\0') return true;
+
+    p = parsePosixName(p);
+    if (!p) return false;
+    rule.hasDst = true;
+    rule.dstOffsetSec = rule.stdOffsetSec + 3600;
+    if (*p != ',' && *p != '\0') {
+        if (!(p = parsePosixTime(p, 24, posixOffset))) return false;
+        rule.dstOffsetSec = -posixOffset;
+    }
+
+    if (*p == '\0') {
+        // Правила не указаны - умолчание POSIX (США): M3.2.0,M11.1.0
+        rule.start = {TZ_RULE_MONTH_WEEK_DAY, 3, 2, 0, 0, 2 * 3600};
+        rule.end = {TZ_RULE_MONTH_WEEK_DAY, 11, 1, 0, 0, 2 * 3600};
+        return true;
+    }
+    if (*p != ',' || !(p = parsePosixRuleDate(p + 1, rule.start))) return false;
+    if (*p != ',' || !(p = parsePosixRuleDate(p + 1, rule.end))) return false;
+    if (*p != '\0') return false;
+
+    if (rule.dstOffsetSec == rule.stdOffsetSec) rule.hasDst = false;
+    return true;
+}
+
+// Значение, которое читают задачи на обоих ядрах: seqlock, как у кэша переходов
+// ниже. Читатель получает копию целиком и номер публикации - чётный seq, который
+// меняется при каждой записи и входит в ключ кэша интервалов.
+template <typename T>
+struct SeqlockSlot {
+    T value;
+    std::atomic<uint32_t> seq;
+};
+
+static portMUX_TYPE tzPublishMux = portMUX_INITIALIZER_UNLOCKED;
+
+template <typename T>
+static uint32_t readSeqlockSlot(const SeqlockSlot<T>& slot, T& out) {
+    while (true) {
+        const uint32_t seq = slot.seq.load(std::memory_order_acquire);
+        if ((seq & 1U) != 0) {
+            continue;
+        }
+        out = slot.value;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) == seq) {
+            return seq;
+        }
+    }
+}
+
+template <typename T>
+static uint32_t writeSeqlockSlot(SeqlockSlot<T>& slot, const T& value) {
+    portENTER_CRITICAL(&tzPublishMux);
+    slot.seq.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.value = value;
+    const uint32_t seq = slot.seq.fetch_add(1, std::memory_order_release) + 1;
+    portEXIT_CRITICAL(&tzPublishMux);
+    return seq;
+}
+
+// Скомпилированное правило вместе со строкой, из которой оно собрано
+struct PublishedTzRule {
+    TzRule rule;
+    bool valid;
+    char source[sizeof(config.time_config.tz_posix)];
+};
+
+// Офлайн POSIX-правило из config, скомпилированное при сохранении/загрузке.
+// Компилирует тот, кто первым заметил новую строку, - в том числе utcToLocal()
+// на любом ядре, поэтому правило не переписывается на месте.
+static SeqlockSlot<PublishedTzRule> posixRuleSlot = {};
+
+// Правила зоны ezTime, захваченные из localTZ.getPosix() после синхронизации.
+// Горячий путь не вызывает ezTime и не создаёт String. Пишет задача синхронизации
+// и смена пояса, читают конвертации на обоих ядрах - тоже через слот.
+static SeqlockSlot<PublishedTzRule> ezTimeRuleSlot = {};
+static bool ezTimeFallbackWarned = false;
+
+// ========== КЭШ ПЕРЕХОДОВ DST ==========
+// Смещение правила постоянно на интервале [validFrom, validUntil) между двумя
+// соседними переходами. Пока UTC внутри интервала, конвертация - сравнение и
+// сложение; переходы пересчитываются раз в полгода или после смены пояса /
+// ручного пресета. utcToLocal() зовут задачи на обоих ядрах - чтение через seqlock.
+
+struct DstIntervalCache {
+    const void* owner;           // Пресет таблицы, зона tzdb или слот правила
+    uint32_t generation;         // Публикация правила слота (0 - пресет и зона)
+    time_t validFrom;
+    time_t validUntil;
+    int32_t offsetSec;
+    int8_t offsetHours;
+    bool dst;
+    bool valid;
+};
+
+static DstIntervalCache dstCache = {nullptr, 0, 0, 0, 0, 0, false, false};
+static std::atomic<uint32_t> dstCacheSeq{0};
+static portMUX_TYPE dstCacheWriteMux = portMUX_INITIALIZER_UNLOCKED;
+static std::atomic<uint32_t> dstCacheRebuilds{0};
+
+static void readDstCache(DstIntervalCache& out) {
+    while (true) {
+        const uint32_t seq = dstCacheSeq.load(std::memory_order_acquire);
+        if ((seq & 1U) != 0) {
+            continue;
+        }
+        out = dstCache;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (dstCacheSeq.load(std::memory_order_relaxed) == seq) {
+            return;
+        }
+    }
+}
+
+static void writeDstCache(const DstIntervalCache& entry) {
+    portENTER_CRITICAL(&dstCacheWriteMux);
+    dstCacheSeq.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    dstCache = entry;
+    dstCacheSeq.fetch_add(1, std::memory_order_release);
+    portEXIT_CRITICAL(&dstCacheWriteMux);
+}
+
+static void invalidateDstCache() {
+    DstIntervalCache empty = {nullptr, 0, 0, 0, 0, 0, false, false};
+    writeDstCache(empty);
+}
+
+// Интервал постоянного смещения, содержащий utc
+static DstIntervalCache buildRuleInterval(time_t utc, const TzRule& rule, const void* owner,
+                                          uint32_t generation) {
+    DstIntervalCache entry = {owner, generation, TZ_TIME_MIN, TZ_TIME_MAX,
+                              rule.stdOffsetSec, 0, false, true};
+
+    if (rule.hasDst) {
+        // Границы интервала могут лежать в соседних годах (зима северного полушария, лето южного)
+        const int year = civilYearFromUtc(utc);
+        bool havePrev = false;
+        for (int y = year - 1; y <= year + 1; y++) {
+            const time_t changes[2] = {tzRuleDateToUtc(y, rule.start, rule.stdOffsetSec),
+                                       tzRuleDateToUtc(y, rule.end, rule.dstOffsetSec)};
+            for (int i = 0; i < 2; i++) {
+                if (changes[i] <= utc) {
+                    if (!havePrev || changes[i] > entry.validFrom) {
+                        havePrev = true;
+                        entry.validFrom = changes[i];
+                        entry.dst = (i == 0);  // после начала DST - летнее, после конца - зимнее
+                    }
+                } else if (changes[i] < entry.validUntil) {
+                    entry.validUntil = changes[i];
+                }
+            }
+        }
+        entry.offsetSec = entry.dst ? rule.dstOffsetSec : rule.stdOffsetSec;
+    }
+
+    entry.offsetHours = static_cast<int8_t>(entry.offsetSec / 3600);
+    return entry;
+}
+
+// current_offset/current_dst_active - для меню и диагностики; меняются только
+// вместе с интервалом, а не на каждой конвертации
+static void publishIntervalToConfig(const DstIntervalCache& entry) {
+    config.time_config.current_offset = entry.offsetHours;
+    config.time_config.current_dst_active = entry.dst;
+}
+
+// Источник правил зоны: копия правила слота, зона tzdb или пресет
+struct TzSource {
+    const void* owner;           // Ключ кэша интервала
+    uint32_t generation;         // Вместе с owner: интервал старого правила не подходит новому
+    TzRule rule;                 // Действует, если zone и preset пусты
+    const TzdbZone* zone;
+    const TimezonePreset* preset;
+};
+
+static inline bool dstCacheHit(const DstIntervalCache& entry, time_t utc, const TzSource& src) {
+    return entry.valid && entry.owner == src.owner && entry.generation == src.generation &&
+           utc >= entry.validFrom && utc < entry.validUntil;
+}
+
+static TzSource tzSourceFromRule(const void* slot, const TzRule& rule, uint32_t generation) {
+    return {slot, generation, rule, nullptr, nullptr};
+}
+
+static TzSource tzSourceFromZone(const TzdbZone* zone) {
+    return {zone, 0, {}, zone, nullptr};
+}
+
+static TzSource tzSourceFromPreset(const TimezonePreset* preset) {
+    return {preset, 0, {}, nullptr, preset};
+}
+
+// Интервал без кэша: соседние интервалы для обратной конвертации, проверки.
+// Зона tzdb: до последнего явного перехода - историческая таблица (бинарный
+// поиск), дальше - правило зоны, состыкованное с последним переходом.
+static DstIntervalCache buildSourceInterval(time_t utc, const TzSource& src) {
+    TzRule rule;
+    if (src.preset) {
+        tzRuleFromPreset(src.preset, rule);
+        return buildRuleInterval(utc, rule, src.owner, src.generation);
+    }
+    if (!src.zone) {
+        return buildRuleInterval(utc, src.rule, src.owner, src.generation);
+    }
+
+    TzdbSpan span;
+    if (tzdbExplicitSpan(src.zone, utc, span)) {
+        return {src.owner, src.generation, span.from, span.until, span.offsetSec,
+                static_cast<int8_t>(span.offsetSec / 3600), span.dst, true};
+    }
+    tzRuleFromTzdb(src.zone, rule);
+    DstIntervalCache entry = buildRuleInterval(utc, rule, src.owner, src.generation);
+    if (entry.validFrom <= span.from) {
+        // Правило ещё не переключало смещение после последнего явного перехода
+        entry.validFrom = span.from;
+        entry.offsetSec = span.offsetSec;
+        entry.offsetHours = static_cast<int8_t>(span.offsetSec / 3600);
+        entry.dst = span.dst;
+    }
+    return entry;
+}
+
+// publish - только для активной зоны: bench/fuzz гоняют через общий кэш чужие
+// источники, их смещение не должно попадать в current_offset
+static DstIntervalCache lookupSourceInterval(time_t utc, const TzSource& src, bool publish) {
+    DstIntervalCache entry;
+    readDstCache(entry);
+    if (dstCacheHit(entry, utc, src)) {
+        return entry;
+    }
+    entry = buildSourceInterval(utc, src);
+    writeDstCache(entry);
+    dstCacheRebuilds.fetch_add(1, std::memory_order_relaxed);
+    if (publish) {
+        publishIntervalToConfig(entry);
+    }
+    return entry;
+}
+
+// Местное → UTC по интервалам источника, O(log n) на интервал. Неоднозначность
+// решается детерминированно:
+//  - перекрытие (осенний перевод, время встречается дважды) - более ранний момент;
+//  - разрыв (весенний перевод, времени нет) - смещение до перехода: 02:30 → 03:30.
+static time_t sourceLocalToUtc(time_t local, const TzSource& src) {
+    // Оценка отличается от ответа не больше чем на разницу смещений (часы), а
+    // переходы отстоят на месяцы - ответ в интервале оценки или в соседнем
+    const DstIntervalCache guess = buildSourceInterval(local, src);
+    const DstIntervalCache around = buildSourceInterval(local - guess.offsetSec, src);
+
+    DstIntervalCache candidates[3];
+    uint8_t count = 0;
+    if (around.validFrom != TZ_TIME_MIN) {
+        candidates[count++] = buildSourceInterval(around.validFrom - 1, src);
+    }
+    candidates[count++] = around;
+    if (around.validUntil != TZ_TIME_MAX) {
+        candidates[count++] = buildSourceInterval(around.validUntil, src);
+    }
+
+    // Кандидаты идут по времени: первый подходящий - самый ранний момент
+    for (uint8_t i = 0; i < count; i++) {
+        const time_t utc = local - candidates[i].offsetSec;
+        if (utc >= candidates[i].validFrom && utc < candidates[i].validUntil) {
+            return utc;
+        }
+    }
+
+    // Разрыв: местного времени нет ни в одном интервале
+    for (uint8_t i = 0; i + 1 < count; i++) {
+        const time_t change = candidates[i].validUntil;
+        if (local - candidates[i].offsetSec >= change && local - candidates[i + 1].offsetSec < change) {
+            return local - candidates[i].offsetSec;
+        }
+    }
+    return local - around.offsetSec;
+}
+
+// Зона tzdb для config.timezone_name; повторный поиск только при смене имени.
+// Имя и зона публикуются вместе: конвертации на обоих ядрах не видят имя новой
+// зоны рядом с указателем старой.
+struct ActiveTzdbZone {
+    const TzdbZone* zone;
+    char name[sizeof(config.time_config.timezone_name)];
+};
+
+static SeqlockSlot<ActiveTzdbZone> activeTzdbZoneSlot = {};
+
+static const TzdbZone* resolveActiveTzdbZone() {
+    ActiveTzdbZone active;
+    (void)readSeqlockSlot(activeTzdbZoneSlot, active);
+    if (strcmp(active.name, config.time_config.timezone_name) != 0) {
+        strlcpy(active.name, config.time_config.timezone_name, sizeof(active.name));
+        active.zone = tzdbFindZone(active.name);
+        (void)writeSeqlockSlot(activeTzdbZoneSlot, active);
+    }
+    return active.zone;
+}
+
+// Компилирует config.tz_posix, если строка изменилась с прошлой компиляции;
+// published/generation - действующее правило и номер его публикации
+static bool refreshPosixRule(PublishedTzRule& published, uint32_t& generation) {
+    generation = readSeqlockSlot(posixRuleSlot, published);
+    if (strcmp(published.source, config.time_config.tz_posix) == 0) {
+        return published.valid;
+    }
+    PublishedTzRule compiled = {};
+    strlcpy(compiled.source, config.time_config.tz_posix, sizeof(compiled.source));
+    compiled.valid = (compiled.source[0] != '\0') && compilePosixRule(compiled.source, compiled.rule);
+    generation = writeSeqlockSlot(posixRuleSlot, compiled);
+    published = compiled;
+    invalidateDstCache();
+    if (compiled.source[0] != '\0' && !compiled.valid) {
+        Serial.printf("\n[TZ] Ошибка разбора POSIX правил: %s", compiled.source);
+    }
+    return compiled.valid;
+}
+
+static bool refreshPosixRule() {
+    PublishedTzRule published;
+    uint32_t generation;
+    return refreshPosixRule(published, generation);
+}
+
+// Захватывает правила текущей зоны ezTime; пересборка только при изменении строки
+static void captureEzTimeRule() {
+    String posix = localTZ.getPosix();
+    if (posix.length() == 0) {
+        return;
+    }
+    PublishedTzRule current;
+    (void)readSeqlockSlot(ezTimeRuleSlot, current);
+    if (current.valid && strcmp(current.source, posix.c_str()) == 0) {
+        return;
+    }
+
+    PublishedTzRule compiled = {};
+    if (!compilePosixRule(posix.c_str(), compiled.rule)) {
+        const PublishedTzRule none = {};
+        (void)writeSeqlockSlot(ezTimeRuleSlot, none);
+        Serial.printf("\n[TZ] Правила ezTime не поддерживаются: %s", posix.c_str());
+        return;
+    }
+    strlcpy(compiled.source, posix.c_str(), sizeof(compiled.source));
+    compiled.valid = true;
+    (void)writeSeqlockSlot(ezTimeRuleSlot, compiled);
+    ezTimeFallbackWarned = false;
+    invalidateDstCache();
+    invalidateTimeSnapshot();
+    Serial.printf("\n[TZ] Правила ezTime: %s", compiled.source);
+}
+
+static void dropEzTimeRule() {
+    const PublishedTzRule none = {};
+    (void)writeSeqlockSlot(ezTimeRuleSlot, none);
+    ezTimeFallbackWarned = false;
+    invalidateDstCache();
+}
+
 // ===== ВСПОМОГАТЕЛЬНЫЕ ФУНКЦИИ СРАВНЕНИЯ ПРАВИЛ DST =====
 static bool getEzTimeDstState(time_t utc, bool &isdst, int16_t &offset_minutes) {
     String tzname;
@@ -276,18 +853,18 @@ static bool getEzTimeTransitionsForYear(int year, time_t *transitions, uint8_t &
     return true;
 }
 
-static bool getTableTransitionsForYear(const TimezonePreset* preset, int year, time_t *transitions, uint8_t &count) {
+// Смены летнего/зимнего времени источника за год (не больше двух, как у ezTime)
+static void getSourceTransitionsForYear(const TzSource& src, int year, time_t *transitions, uint8_t &count) {
     count = 0;
-    if (!preset || preset->dst_start_month == 0 || preset->dst_offset == preset->std_offset) {
-        return true;
+    const time_t end = makeUtcTime(year + 1, 1, 1, 0, 0, 0);
+    DstIntervalCache interval = buildSourceInterval(makeUtcTime(year, 1, 1, 0, 0, 0), src);
+    while (interval.validUntil < end && count < 2) {
+        const DstIntervalCache next = buildSourceInterval(interval.validUntil, src);
+        if (next.dst != interval.dst) {
+            transitions[count++] = interval.validUntil;
+        }
+        interval = next;
     }
-
-    transitions[count++] = calculateDSTTransition(year, preset->dst_start_month, preset->dst_start_week,
-                                                   preset->dst_start_dow, preset->dst_start_hour, preset->std_offset);
-    transitions[count++] = calculateDSTTransition(year, preset->dst_end_month, preset->dst_end_week,
-                                                   preset->dst_end_dow, preset->dst_end_hour, preset->dst_offset);
-    sortTransitions(transitions, count);
-    return true;
 }
 
 static void formatUtcTime(time_t t, char *buf, size_t len) {
@@ -301,8 +878,8 @@ static void formatUtcTime(time_t t, char *buf, size_t len) {
              tm_info->tm_hour, tm_info->tm_min);
 }
 
-bool compareDSTRulesWithEzTime(const TimezonePreset* preset, int startYear, int yearsToCheck, bool printDetails) {
-    if (!preset || yearsToCheck <= 0) {
+static bool compareSourceWithEzTime(const TzSource& src, int startYear, int yearsToCheck, bool printDetails) {
+    if (yearsToCheck <= 0) {
         return true;
     }
 
@@ -320,7 +897,7 @@ bool compareDSTRulesWithEzTime(const TimezonePreset* preset, int startYear, int
             return true;
         }
 
-        getTableTransitionsForYear(preset, year, table_trans, table_count);
+        getSourceTransitionsForYear(src, year, table_trans, table_count);
 
         bool year_match = (ez_count == table_count);
         if (year_match) {
@@ -340,21 +917,21 @@ bool compareDSTRulesWithEzTime(const TimezonePreset* preset, int startYear, int
             if (ez_count == 0) {
                 Serial.print("\n║   ezTime:  DST не используется");
             } else {
-                char buf1[32];
-                char buf2[32];
+                char buf1[64];
+                char buf2[64];
                 formatUtcTime(ez_trans[0], buf1, sizeof(buf1));
                 formatUtcTime(ez_trans[1], buf2, sizeof(buf2));
                 Serial.printf("\n║   ezTime:  %s | %s", buf1, buf2);
             }
 
             if (table_count == 0) {
-                Serial.print("\n║   Таблица: DST не используется");
+                Serial.print("\n║   Офлайн:  DST не используется");
             } else {
-                char buf1[32];
-                char buf2[32];
+                char buf1[64];
+                char buf2[64];
                 formatUtcTime(table_trans[0], buf1, sizeof(buf1));
                 formatUtcTime(table_trans[1], buf2, sizeof(buf2));
-                Serial.printf("\n║   Таблица: %s | %s", buf1, buf2);
+                Serial.printf("\n║   Офлайн:  %s | %s", buf1, buf2);
             }
 
             Serial.printf("\n║   Итог: %s", year_match ? "СОВПАДАЮТ" : "РАСХОЖДЕНИЕ");
@@ -364,6 +941,13 @@ bool compareDSTRulesWithEzTime(const TimezonePreset* preset, int startYear, int
     return all_match;
 }
 
+bool compareDSTRulesWithEzTime(const TimezonePreset* preset, int startYear, int yearsToCheck, bool printDetails) {
+    if (!preset) {
+        return true;
+    }
+    return compareSourceWithEzTime(tzSourceFromPreset(preset), startYear, yearsToCheck, printDetails);
+}
+
 // ========== ИНИЦИАЛИЗАЦИЯ ==========
 
 bool initTimezone() {
@@ -392,6 +976,7 @@ bool initTimezone() {
         manualPreset.dst_end_dow = config.time_config.manual_dst_end_dow;
         manualPreset.dst_end_hour = config.time_config.manual_dst_end_hour;
         manualPresetActive = true;
+        invalidateDstCache();
         
         Serial.printf("\n[TZ] Инициализация: Ручная настройка (UTC%+d)", manualPreset.std_offset);
         if (manualPreset.dst_start_month > 0) {
@@ -401,14 +986,20 @@ bool initTimezone() {
         return true;
     }
     
-    // Находим preset для этой локации
-    const TimezonePreset* preset = findPresetByLocation(config.time_config.timezone_name);
-    if (!preset) {
+    // Находим локацию в tzdb или в таблице пресетов
+    const char* display_name = getZoneDisplayName(config.time_config.timezone_name);
+    if (!display_name) {
         Serial.printf("\n[TZ] Предупреждение: локация '%s' не найдена в таблице\n", config.time_config.timezone_name);
         return false;
     }
     
-    Serial.printf("\n[TZ] Инициализация: %s", preset->display_name);
+    Serial.printf("\n[TZ] Инициализация: %s", display_name);
+    if (tzdbFindZone(config.time_config.timezone_name)) {
+        Serial.printf("\n[TZ] Офлайн-правила: tzdb %s", tzdbVersion());
+    }
+
+    // Сохранённые офлайн-правила компилируются сразу после загрузки конфигурации
+    refreshPosixRule();
 
     ezTimeAvailable = false;
     return true;
@@ -416,175 +1007,114 @@ bool initTimezone() {
 
 // ========== КОНВЕРТАЦИЯ ВРЕМЕНИ ==========
 
-time_t utcToLocal(time_t utc) {
-    // === РЕЖИМ 1: ezTime (online с автоматическими правилами DST) ===
-    if (config.time_config.automatic_localtime && ezTimeAvailable) {
-        String tzname;
-        bool isdst = false;
-        int16_t offset_minutes = 0;
-        
-        // Пытаемся получить время через ezTime
-        time_t local = localTZ.tzTime(utc, UTC_TIME, tzname, isdst, offset_minutes);
-        
-        // ПРОВЕРКА: если ezTime вернул некорректное значение (нет связи с сервером)
-        // Признак: tzname пустой и offset_minutes == 0 (обычно ezTime не инициализирован)
-        bool eztime_failed = (tzname.length() == 0 && offset_minutes == 0);
-        
-        // Если ezTime работает нормально - используем его результат
-        if (!eztime_failed) {
-            // Обновляем кэшированные значения для отображения
-            // ВАЖНО: ezTime использует POSIX формат, где знаки инвертированы!
-            // POSIX: CET-1 означает UTC+1 (минус = восток от UTC)
-            config.time_config.current_offset = -(offset_minutes / 60);
-            config.time_config.current_dst_active = isdst;
-            
-            return local;
-        }
-        
-        // ezTime недоступен - переключаемся на локальную таблицу
-        Serial.print("\n[TZ] ⚠️  ezTime недоступен (нет интернета?), переключение на локальную таблицу");
-    }
+// Восстанавливает ручной пресет из config, если он ещё не активирован
+static const TimezonePreset* restoreManualPreset() {
+    if (strcmp(config.time_config.timezone_name, "MANUAL") != 0) return nullptr;
+    if (config.time_config.manual_std_offset == 0 && config.time_config.manual_dst_offset == 0) return nullptr;
+
+    manualPreset.std_offset = config.time_config.manual_std_offset;
+    manualPreset.dst_offset = config.time_config.manual_dst_offset;
+    manualPreset.dst_start_month = config.time_config.manual_dst_start_month;
+    manualPreset.dst_start_week = config.time_config.manual_dst_start_week;
+    manualPreset.dst_start_dow = config.time_config.manual_dst_start_dow;
+    manualPreset.dst_start_hour = config.time_config.manual_dst_start_hour;
+    manualPreset.dst_end_month = config.time_config.manual_dst_end_month;
+    manualPreset.dst_end_week = config.time_config.manual_dst_end_week;
+    manualPreset.dst_end_dow = config.time_config.manual_dst_end_dow;
+    manualPreset.dst_end_hour = config.time_config.manual_dst_end_hour;
+    manualPresetActive = true;
+    invalidateDstCache();
+    return &manualPreset;
+}
 
-    // === РЕЖИМ 1b: Офлайн POSIX правила (если есть) ===
-    if (config.time_config.automatic_localtime &&
-        config.time_config.tz_posix[0] != '\0' &&
-        strcmp(config.time_config.tz_posix_zone, config.time_config.timezone_name) == 0) {
-        if (localTZ.setPosix(String(config.time_config.tz_posix))) {
-            String tzname;
-            bool isdst = false;
-            int16_t offset_minutes = 0;
-            time_t local = localTZ.tzTime(utc, UTC_TIME, tzname, isdst, offset_minutes);
-            if (!(tzname.length() == 0 && offset_minutes == 0)) {
-                config.time_config.current_offset = -(offset_minutes / 60);
-                config.time_config.current_dst_active = isdst;
-                return local;
-            }
-        }
+// Офлайн-правила зоны без ezTime и сохранённого POSIX: база tzdb во flash
+// (история переходов и минутные смещения), иначе таблица пресетов (ручная
+// настройка, зоны вне tzdb). Эталон, с которым сверяется ezTime.
+static bool resolveOfflineTzSource(TzSource& out) {
+    const TzdbZone* zone = resolveActiveTzdbZone();
+    if (zone) {
+        out = tzSourceFromZone(zone);
+        return true;
     }
-    
-    // === РЕЖИМ 2: Локальная таблица (offline) или Fallback ===
-    
-    // Находим preset для текущей локации
     const TimezonePreset* preset = findPresetByLocation(config.time_config.timezone_name);
     if (!preset) {
-        // Проверяем, это ли Manual preset, который не был активирован
-        if (strcmp(config.time_config.timezone_name, "MANUAL") == 0) {
-            // Пытаемся восстановить Manual preset из config
-            if (config.time_config.manual_std_offset != 0 || config.time_config.manual_dst_offset != 0) {
-                // Есть сохраненные данные - активируем preset
-                manualPreset.std_offset = config.time_config.manual_std_offset;
-                manualPreset.dst_offset = config.time_config.manual_dst_offset;
-                manualPreset.dst_start_month = config.time_config.manual_dst_start_month;
-                manualPreset.dst_start_week = config.time_config.manual_dst_start_week;
-                manualPreset.dst_start_dow = config.time_config.manual_dst_start_dow;
-                manualPreset.dst_start_hour = config.time_config.manual_dst_start_hour;
-                manualPreset.dst_end_month = config.time_config.manual_dst_end_month;
-                manualPreset.dst_end_week = config.time_config.manual_dst_end_week;
-                manualPreset.dst_end_dow = config.time_config.manual_dst_end_dow;
-                manualPreset.dst_end_hour = config.time_config.manual_dst_end_hour;
-                manualPresetActive = true;
-                preset = &manualPreset;  // Используем восстановленный preset
-            }
-        }
-        
-        if (!preset) {
-            // Fallback: возвращаем UTC без изменений
-            if (strcmp(missingPresetWarnedZone, config.time_config.timezone_name) != 0) {
-                strlcpy(missingPresetWarnedZone, config.time_config.timezone_name, sizeof(missingPresetWarnedZone));
-                Serial.print("\n[TZ] Ошибка: preset не найден, используется UTC");
-            }
-            config.time_config.current_offset = 0;
-            config.time_config.current_dst_active = false;
-            return utc;
-        }
+        preset = restoreManualPreset();
     }
-
-    // preset снова найден: сбрасываем флаг одноразового предупреждения
-    missingPresetWarnedZone[0] = '\0';
-    
-    // Вычисляем, активен ли DST сейчас (по локальным правилам)
-    bool is_dst = calculateDSTStatus(utc, preset);
-    
-    // Выбираем соответствующее смещение
-    int8_t offset = is_dst ? preset->dst_offset : preset->std_offset;
-    
-    // Обновляем кэшированные значения
-    config.time_config.current_offset = offset;
-    config.time_config.current_dst_active = is_dst;
-    
-    // Применяем смещение
-    return utc + (offset * 3600);
+    if (!preset) {
+        return false;
+    }
+    out = tzSourceFromPreset(preset);
+    return true;
 }
 
-time_t localToUtc(time_t local) {
-    // === РЕЖИМ 1: ezTime (online) ===
+// Активный источник правил: ezTime (захваченные правила) → офлайн POSIX →
+// tzdb → таблица пресетов. false - пояс неизвестен.
+static bool resolveTzSource(TzSource& out) {
+    // === РЕЖИМ 1: ezTime (online с автоматическими правилами DST) ===
     if (config.time_config.automatic_localtime && ezTimeAvailable) {
-        String tzname;
-        bool isdst = false;
-        int16_t offset_minutes = 0;
-        
-        time_t utc = localTZ.tzTime(local, LOCAL_TIME, tzname, isdst, offset_minutes);
-        
-        // ПРОВЕРКА: если ezTime вернул некорректное значение
-        bool eztime_failed = (tzname.length() == 0 && offset_minutes == 0);
-        
-        // Если ezTime работает - возвращаем результат
-        if (!eztime_failed) {
-            return utc;
+        PublishedTzRule captured;
+        const uint32_t generation = readSeqlockSlot(ezTimeRuleSlot, captured);
+        if (captured.valid) {
+            out = tzSourceFromRule(&ezTimeRuleSlot, captured.rule, generation);
+            return true;
+        }
+        // Правила ezTime ещё не захвачены - таблица; предупреждаем один раз
+        if (!ezTimeFallbackWarned) {
+            ezTimeFallbackWarned = true;
+            Serial.print("\n[TZ] ⚠️  ezTime недоступен (нет интернета?), переключение на локальную таблицу");
         }
-        
-        Serial.print("\n[TZ] ⚠️  ezTime недоступен, fallback на локальную таблицу");
     }
 
     // === РЕЖИМ 1b: Офлайн POSIX правила (если есть) ===
+    PublishedTzRule posix;
+    uint32_t posixGeneration;
     if (config.time_config.automatic_localtime &&
         config.time_config.tz_posix[0] != '\0' &&
-        strcmp(config.time_config.tz_posix_zone, config.time_config.timezone_name) == 0) {
-        if (localTZ.setPosix(String(config.time_config.tz_posix))) {
-            String tzname;
-            bool isdst = false;
-            int16_t offset_minutes = 0;
-            time_t utc = localTZ.tzTime(local, LOCAL_TIME, tzname, isdst, offset_minutes);
-            if (!(tzname.length() == 0 && offset_minutes == 0)) {
-                return utc;
-            }
-        }
+        strcmp(config.time_config.tz_posix_zone, config.time_config.timezone_name) == 0 &&
+        refreshPosixRule(posix, posixGeneration)) {
+        out = tzSourceFromRule(&posixRuleSlot, posix.rule, posixGeneration);
+        return true;
     }
-    
-    // === РЕЖИМ 2: Локальная таблица (offline) или Fallback ===
-    
-    const TimezonePreset* preset = findPresetByLocation(config.time_config.timezone_name);
-    if (!preset) {
-        // Проверяем, это ли Manual preset, который не был активирован
-        if (strcmp(config.time_config.timezone_name, "MANUAL") == 0) {
-            // Пытаемся восстановить Manual preset из config
-            if (config.time_config.manual_std_offset != 0 || config.time_config.manual_dst_offset != 0) {
-                // Есть сохраненные данные - активируем preset
-                manualPreset.std_offset = config.time_config.manual_std_offset;
-                manualPreset.dst_offset = config.time_config.manual_dst_offset;
-                manualPreset.dst_start_month = config.time_config.manual_dst_start_month;
-                manualPreset.dst_start_week = config.time_config.manual_dst_start_week;
-                manualPreset.dst_start_dow = config.time_config.manual_dst_start_dow;
-                manualPreset.dst_start_hour = config.time_config.manual_dst_start_hour;
-                manualPreset.dst_end_month = config.time_config.manual_dst_end_month;
-                manualPreset.dst_end_week = config.time_config.manual_dst_end_week;
-                manualPreset.dst_end_dow = config.time_config.manual_dst_end_dow;
-                manualPreset.dst_end_hour = config.time_config.manual_dst_end_hour;
-                manualPresetActive = true;
-                preset = &manualPreset;  // Используем восстановленный preset
-            }
-        }
-        
-        if (!preset) {
-            return local;  // Fallback
-        }
+
+    // === РЕЖИМЫ 2-3: tzdb во flash, таблица пресетов ===
+    if (resolveOfflineTzSource(out)) {
+        // Зона снова найдена: сбрасываем флаг одноразового предупреждения
+        missingPresetWarnedZone[0] = '\0';
+        return true;
     }
-    
-    // Примерная оценка: используем текущее кэшированное значение DST
-    // (точное вычисление требует итеративного подхода)
-    int8_t offset = config.time_config.current_dst_active ? preset->dst_offset : preset->std_offset;
-    
-    return local - (offset * 3600);
+
+    // === Fallback: UTC ===
+    if (strcmp(missingPresetWarnedZone, config.time_config.timezone_name) != 0) {
+        strlcpy(missingPresetWarnedZone, config.time_config.timezone_name, sizeof(missingPresetWarnedZone));
+        Serial.print("\n[TZ] Ошибка: preset не найден, используется UTC");
+        config.time_config.current_offset = 0;
+        config.time_config.current_dst_active = false;
+    }
+    return false;
+}
+
+time_t utcToLocal(time_t utc) {
+    bool isDst = false;
+    return utcToLocal(utc, isDst);
+}
+
+time_t utcToLocal(time_t utc, bool &isDst) {
+    TzSource src;
+    if (!resolveTzSource(src)) {
+        isDst = false;
+        return utc;  // Fallback: UTC без изменений
+    }
+    const DstIntervalCache interval = lookupSourceInterval(utc, src, true);
+    isDst = interval.dst;
+    return utc + interval.offsetSec;
+}
+
+time_t localToUtc(time_t local) {
+    TzSource src;
+    if (!resolveTzSource(src)) {
+        return local;  // Fallback
+    }
+    return sourceLocalToUtc(local, src);
 }
 
 // ========== УСТАНОВКА ЧАСОВОГО ПОЯСА ==========
@@ -592,9 +1122,9 @@ time_t localToUtc(time_t local) {
 bool setTimezone(const char* tz_name) {
     if (!tz_name) return false;
     
-    // Проверяем, есть ли этот пояс в таблице
-    const TimezonePreset* preset = findPresetByLocation(tz_name);
-    if (!preset) {
+    // Проверяем, есть ли этот пояс в tzdb или в таблице пресетов
+    const char* display_name = getZoneDisplayName(tz_name);
+    if (!display_name) {
         Serial.printf("\n[TZ] Ошибка: географическая зона '%s' не найдена в таблице", tz_name);
         return false;
     }
@@ -603,7 +1133,7 @@ bool setTimezone(const char* tz_name) {
     strncpy(config.time_config.timezone_name, tz_name, sizeof(config.time_config.timezone_name));
     config.time_config.timezone_name[sizeof(config.time_config.timezone_name)-1] = '\0';
     
-    Serial.printf("\n[TZ] Данные о времени найдены в таблице: %s", preset->display_name);
+    Serial.printf("\n[TZ] Данные о времени найдены в таблице: %s", display_name);
 
     // Любая неручная зона включает автоматический режим и автосинхронизацию
     if (strcmp(tz_name, "MANUAL") != 0) {
@@ -611,9 +1141,14 @@ bool setTimezone(const char* tz_name) {
         config.time_config.auto_sync_enabled = true;
     }
       
+    // Правила ezTime захвачены для прежней зоны - до следующей синхронизации таблица/POSIX
+    dropEzTimeRule();
+
     // Принудительно обновляем current_offset через utcToLocal (для режима таблицы)
+    invalidateDstCache();
     time_t now = time(nullptr);
     utcToLocal(now);
+    invalidateTimeSnapshot();
     
     return true;
 }
@@ -626,15 +1161,110 @@ bool setTimezoneOffset(int8_t offset) {
     
     // Отключаем ezTime и автоматический режим
     ezTimeAvailable = false;
+    dropEzTimeRule();
     config.time_config.automatic_localtime = false;
     config.time_config.current_offset = offset;
     config.time_config.current_dst_active = false;
+    invalidateDstCache();
+    invalidateTimeSnapshot();
     
     return true;
 }
 
 // ========== ФУНКЦИИ ОТЛАДКИ ==========
 
+// tz bench: нс на конвертацию до (calculateDSTStatus на каждый вызов) и после (кэш интервала)
+void runTimezoneBenchmark() {
+    static constexpr uint32_t TZ_BENCH_ITERATIONS = 20000;
+    static constexpr time_t TZ_BENCH_STEP_SEC = 61;  // ~2 недели на прогон, внутри одного интервала
+    static constexpr int TZ_BENCH_FIRST_YEAR = 1970;
+    static constexpr uint32_t TZ_BENCH_YEARS = 68;    // Без выхода за 32-битный time_t
+
+    const TimezonePreset* preset = findPresetByLocation(config.time_config.timezone_name);
+    if (!preset) {
+        preset = &TIMEZONE_PRESETS[0];
+    }
+
+    time_t base = getCurrentUTCTime();
+    if (base < 1600000000) {
+        base = 1735689600;  // 2025-01-01, если часы ещё не установлены
+    }
+
+    volatile int64_t sink = 0;
+    const uint32_t rebuildsBefore = dstCacheRebuilds.load(std::memory_order_relaxed);
+    multi_heap_info_t heapBefore;
+    heap_caps_get_info(&heapBefore, MALLOC_CAP_DEFAULT);
+
+    int64_t startUs = esp_timer_get_time();
+    for (uint32_t i = 0; i < TZ_BENCH_ITERATIONS; i++) {
+        const time_t utc = base + static_cast<time_t>(i) * TZ_BENCH_STEP_SEC;
+        const bool dst = calculateDSTStatus(utc, preset);
+        sink = sink + utc + (dst ? preset->dst_offset : preset->std_offset) * 3600;
+    }
+    const int64_t uncachedUs = esp_timer_get_time() - startUs;
+
+    const TzdbZone* zone = tzdbFindZone(preset->zone_name);
+    const TzSource source = zone ? tzSourceFromZone(zone) : tzSourceFromPreset(preset);
+    startUs = esp_timer_get_time();
+    for (uint32_t i = 0; i < TZ_BENCH_ITERATIONS; i++) {
+        const time_t utc = base + static_cast<time_t>(i) * TZ_BENCH_STEP_SEC;
+        sink = sink + utc + lookupSourceInterval(utc, source, false).offsetSec;
+    }
+    const int64_t cachedUs = esp_timer_get_time() - startUs;
+
+    startUs = esp_timer_get_time();
+    for (uint32_t i = 0; i < TZ_BENCH_ITERATIONS; i++) {
+        sink = sink + utcToLocal(base + static_cast<time_t>(i) * TZ_BENCH_STEP_SEC);
+    }
+    const int64_t fullUs = esp_timer_get_time() - startUs;
+
+    startUs = esp_timer_get_time();
+    for (uint32_t i = 0; i < TZ_BENCH_ITERATIONS; i++) {
+        sink = sink + localToUtc(base + static_cast<time_t>(i) * TZ_BENCH_STEP_SEC);
+    }
+    const int64_t inverseUs = esp_timer_get_time() - startUs;
+
+    // Составные части расчёта без кэша; правило ЕС - чтобы замер не зависел от пояса
+    startUs = esp_timer_get_time();
+    for (uint32_t i = 0; i < TZ_BENCH_ITERATIONS; i++) {
+        sink = sink + calculateDSTTransition(TZ_BENCH_FIRST_YEAR + i % TZ_BENCH_YEARS, 3, 5, 0, 1, 0);
+    }
+    const int64_t transitionUs = esp_timer_get_time() - startUs;
+
+    startUs = esp_timer_get_time();
+    for (uint32_t i = 0; i < TZ_BENCH_ITERATIONS; i++) {
+        sink = sink + daysFromCivil(TZ_BENCH_FIRST_YEAR + i % TZ_BENCH_YEARS, 1 + i % 12, 1 + i % 28);
+    }
+    const int64_t civilUs = esp_timer_get_time() - startUs;
+
+    multi_heap_info_t heapAfter;
+    heap_caps_get_info(&heapAfter, MALLOC_CAP_DEFAULT);
+
+    // Бенчмарк сдвигал кэш по времени - возвращаем текущий интервал
+    invalidateDstCache();
+    utcToLocal(getCurrentUTCTime());
+    (void)sink;
+
+    const uint32_t rebuilds = dstCacheRebuilds.load(std::memory_order_relaxed) - rebuildsBefore;
+    Serial.printf("\n[TZ] Бенчмарк: %s, %u конвертаций", preset->zone_name, (unsigned)TZ_BENCH_ITERATIONS);
+    Serial.printf("\n[TZ]   без кэша (calculateDSTStatus): %lu нс/конв.",
+                  (unsigned long)(uncachedUs * 1000 / TZ_BENCH_ITERATIONS));
+    Serial.printf("\n[TZ]   кэш интервала:                 %lu нс/конв. (пересчётов: %lu)",
+                  (unsigned long)(cachedUs * 1000 / TZ_BENCH_ITERATIONS), (unsigned long)rebuilds);
+    Serial.printf("\n[TZ]   utcToLocal() целиком:          %lu нс/конв.",
+                  (unsigned long)(fullUs * 1000 / TZ_BENCH_ITERATIONS));
+    Serial.printf("\n[TZ]   localToUtc() целиком:          %lu нс/конв.",
+                  (unsigned long)(inverseUs * 1000 / TZ_BENCH_ITERATIONS));
+    Serial.printf("\n[TZ]   calculateDSTTransition():      %lu нс/вызов",
+                  (unsigned long)(transitionUs * 1000 / TZ_BENCH_ITERATIONS));
+    Serial.printf("\n[TZ]   daysFromCivil():               %lu нс/вызов",
+                  (unsigned long)(civilUs * 1000 / TZ_BENCH_ITERATIONS));
+    // Конвертации работают без кучи: блоки и свободная память не должны меняться
+    Serial.printf("\n[TZ]   куча: блоков %+ld, свободно %+ld байт",
+                  (long)heapAfter.allocated_blocks - (long)heapBefore.allocated_blocks,
+                  (long)heapAfter.total_free_bytes - (long)heapBefore.total_free_bytes);
+}
+
 void printTimezoneInfo() {
     Serial.print("\n╔═══════════════════════════════════════════════════════");
     Serial.print("\n║                  ТЕКУЩИЕ НАСТРОЙКИ");
@@ -669,11 +1299,26 @@ void printTimezoneInfo() {
             } else {
                 Serial.print("\n║ DST: Неактивен (стандартное время)");
             }
+        } else if (const TzdbZone* zone = tzdbFindZone(config.time_config.timezone_name)) {
+            char offset_str[24];
+            Serial.printf("\n║ Географическая зона: %s", zone->name);
+            formatUtcOffset(offset_str, sizeof(offset_str), zone->stdOffsetMin);
+            Serial.printf("\n║ Базовое смещение: %s", offset_str);
+            if (zone->hasDst) {
+                formatUtcOffset(offset_str, sizeof(offset_str), zone->dstOffsetMin);
+                Serial.printf("\n║ Переход на летнее/зимнее время: используется (летнее %s)", offset_str);
+            } else {
+                Serial.print("\n║ Переход на летнее/зимнее время: не используется");
+            }
         } else {
             Serial.printf("\n║ Географическая зона: %s", config.time_config.timezone_name);
             Serial.print("\n║ ОШИБКА: Географическая зона не найдена в таблице");
         }
     }
+    if (tzdbFindZone(config.time_config.timezone_name)) {
+        Serial.printf("\n║ Офлайн-правила: tzdb %s (%u зон, с историей переходов)",
+                      tzdbVersion(), (unsigned)tzdbZoneCount());
+    }
 
     Serial.printf("\n║ Автосинхронизация по UTC: %s", config.time_config.auto_sync_enabled ? "ВКЛЮЧЕНА" : "ОТКЛЮЧЕНА");
     if (config.time_config.automatic_localtime && config.time_config.auto_sync_enabled) {
@@ -739,14 +1384,14 @@ void listAvailableTimezones() {
         }
         
         // Форматируем данные
-        char offset_str[12];
+        char offset_str[16];
         const char* dst_str;
         
         if (p->dst_start_month > 0 && p->dst_offset != p->std_offset) {
-            sprintf(offset_str, "UTC%+d/%+d", p->std_offset, p->dst_offset);
+            snprintf(offset_str, sizeof(offset_str), "UTC%+d/%+d", p->std_offset, p->dst_offset);
             dst_str = "Есть";
         } else {
-            sprintf(offset_str, "UTC%+d", p->std_offset);
+            snprintf(offset_str, sizeof(offset_str), "UTC%+d", p->std_offset);
             dst_str = "Нет ";
         }
         
@@ -765,6 +1410,36 @@ void listAvailableTimezones() {
         for (int j = 0; j < padding; j++) Serial.print(" ");
         Serial.printf(" ║ %-11s ║ %-5s ║", offset_str, dst_str);
     }
+
+    // Зоны только из tzdb (дробные смещения) - номера продолжают список пресетов
+    const uint8_t extra_count = getExtraZonesCount();
+    if (extra_count > 0) {
+        Serial.print("\n╠════╬═══════════════════════════════════════╬═════════════╬══════╣");
+        Serial.print("\n║    ║ ДРУГИЕ ЗОНЫ (tzdb)                    ║             ║      ║");
+        Serial.print("\n╠════╬═══════════════════════════════════════╬═════════════╬══════╣");
+    }
+    for (uint8_t i = 0; i < extra_count; i++) {
+        const TzdbZone* zone = getExtraZoneByIndex(i);
+        char offset_str[24];
+        formatUtcOffset(offset_str, sizeof(offset_str), zone->stdOffsetMin);
+        if (zone->hasDst) {
+            char dst_str[16];
+            formatUtcOffset(dst_str, sizeof(dst_str), zone->dstOffsetMin);
+            strlcat(offset_str, "/", sizeof(offset_str));
+            strlcat(offset_str, dst_str + 3, sizeof(offset_str));  // без "UTC"
+        }
+
+        int visual_len = 0;
+        for (const char* s = zone->displayName; *s; s++) {
+            if ((*s & 0xC0) != 0x80) visual_len++;
+        }
+        int padding = 37 - visual_len;
+        if (padding < 0) padding = 0;
+
+        Serial.printf("\n║ %-2d ║ %s", PRESETS_COUNT + i + 1, zone->displayName);
+        for (int j = 0; j < padding; j++) Serial.print(" ");
+        Serial.printf(" ║ %-11s ║ %-5s ║", offset_str, zone->hasDst ? "Есть" : "Нет ");
+    }
     
     Serial.print("\n╚════╩═══════════════════════════════════════╩═════════════╩══════╝");
   Serial.print("\n\n╭─────────────────────────────────────────────────────────────────╮");
@@ -782,11 +1457,19 @@ bool savePosixOverride(const char* tz_name) {
     String posix = localTZ.getPosix();
     if (posix.length() == 0) return false;
 
+    // Сохраняем только правило, которое офлайн-путь сможет вычислить
+    TzRule probe;
+    if (!compilePosixRule(posix.c_str(), probe)) {
+        Serial.printf("\n[TZ] POSIX правила не поддерживаются: %s", posix.c_str());
+        return false;
+    }
+
     strncpy(config.time_config.tz_posix, posix.c_str(), sizeof(config.time_config.tz_posix));
     config.time_config.tz_posix[sizeof(config.time_config.tz_posix) - 1] = '\0';
     strncpy(config.time_config.tz_posix_zone, tz_name, sizeof(config.time_config.tz_posix_zone));
     config.time_config.tz_posix_zone[sizeof(config.time_config.tz_posix_zone) - 1] = '\0';
     config.time_config.tz_posix_updated = time(nullptr);
+    refreshPosixRule();
     return true;
 }
 
@@ -798,10 +1481,30 @@ bool clearPosixOverrideIfZone(const char* tz_name) {
     config.time_config.tz_posix[0] = '\0';
     config.time_config.tz_posix_zone[0] = '\0';
     config.time_config.tz_posix_updated = 0;
+    refreshPosixRule();
     return true;
 }
 
-bool getEzTimeData(time_t utc, int8_t &offset_hours, bool &dst_active) {
+bool getOfflineZoneState(time_t utc, int32_t &offset_min, bool &dst_active) {
+    TzSource src;
+    if (!resolveOfflineTzSource(src)) {
+        return false;
+    }
+    const DstIntervalCache interval = buildSourceInterval(utc, src);
+    offset_min = interval.offsetSec / 60;
+    dst_active = interval.dst;
+    return true;
+}
+
+bool compareOfflineRulesWithEzTime(int startYear, int yearsToCheck, bool printDetails) {
+    TzSource src;
+    if (!resolveOfflineTzSource(src)) {
+        return true;
+    }
+    return compareSourceWithEzTime(src, startYear, yearsToCheck, printDetails);
+}
+
+bool getEzTimeData(time_t utc, int32_t &offset_min, bool &dst_active) {
     if (!config.time_config.automatic_localtime) return false;
 
     if (!localTZ.setLocation(String(config.time_config.timezone_name))) {
@@ -822,9 +1525,10 @@ bool getEzTimeData(time_t utc, int8_t &offset_hours, bool &dst_active) {
         localTZ.tzTime(utc, UTC_TIME, tzname, isdst, offset_minutes);
 
         if (tzname.length() > 0 || offset_minutes != 0) {
-            offset_hours = -(offset_minutes / 60);
+            captureEzTimeRule();
+            offset_min = -offset_minutes;  // ezTime: запад положителен
             dst_active = isdst;
-            config.time_config.current_offset = offset_hours;
+            config.time_config.current_offset = static_cast<int8_t>(offset_min / 60);
             config.time_config.current_dst_active = dst_active;
             return true;
         }
@@ -952,19 +1656,19 @@ void setupManualOffset() {
                 Serial.print("День недели (0=Вск, 1=Пнд, ..., 6=Сбт): ");
                 while (!Serial.available()) { delay(100); }
                 manualPreset.dst_start_dow = Serial.readStringUntil('\n').toInt();
-                if (manualPreset.dst_start_dow < 0 || manualPreset.dst_start_dow > 6) {
+                if (manualPreset.dst_start_dow > 6) {
                     Serial.print("✖ Ошибка: День недели должен быть от 0 до 6. Попробуйте снова.\n");
                 }
-            } while (manualPreset.dst_start_dow < 0 || manualPreset.dst_start_dow > 6);
+            } while (manualPreset.dst_start_dow > 6);
             
             do {
                 Serial.print("Час перехода (0-23): ");
                 while (!Serial.available()) { delay(100); }
                 manualPreset.dst_start_hour = Serial.readStringUntil('\n').toInt();
-                if (manualPreset.dst_start_hour < 0 || manualPreset.dst_start_hour > 23) {
+                if (manualPreset.dst_start_hour > 23) {
                     Serial.print("✖ Ошибка: Час должен быть от 0 до 23. Попробуйте снова.\n");
                 }
-            } while (manualPreset.dst_start_hour < 0 || manualPreset.dst_start_hour > 23);
+            } while (manualPreset.dst_start_hour > 23);
             
             Serial.print("\nКОНЕЦ DST (переход на зимнее время):\n");
             
@@ -990,19 +1694,19 @@ void setupManualOffset() {
                 Serial.print("День недели (0=Вск, 1=Пнд, ..., 6=Сбт): ");
                 while (!Serial.available()) { delay(100); }
                 manualPreset.dst_end_dow = Serial.readStringUntil('\n').toInt();
-                if (manualPreset.dst_end_dow < 0 || manualPreset.dst_end_dow > 6) {
+                if (manualPreset.dst_end_dow > 6) {
                     Serial.print("✖ Ошибка: День недели должен быть от 0 до 6. Попробуйте снова.\n");
                 }
-            } while (manualPreset.dst_end_dow < 0 || manualPreset.dst_end_dow > 6);
+            } while (manualPreset.dst_end_dow > 6);
             
             do {
                 Serial.print("Час перехода (0-23): ");
                 while (!Serial.available()) { delay(100); }
                 manualPreset.dst_end_hour = Serial.readStringUntil('\n').toInt();
-                if (manualPreset.dst_end_hour < 0 || manualPreset.dst_end_hour > 23) {
+                if (manualPreset.dst_end_hour > 23) {
                     Serial.print("✖ Ошибка: Час должен быть от 0 до 23. Попробуйте снова.\n");
                 }
-            } while (manualPreset.dst_end_hour < 0 || manualPreset.dst_end_hour > 23);
+            } while (manualPreset.dst_end_hour > 23);
         }
     } else {
         // DST не используется
@@ -1036,6 +1740,8 @@ void setupManualOffset() {
     
     // Активируем ручной preset
     manualPresetActive = true;
+    invalidateDstCache();
+    invalidateTimeSnapshot();
     
     // Пересчитываем текущее смещение
     time_t now = time(nullptr);
@@ -1339,3 +2045,252 @@ void compareDSTRules() {
         Serial.print(" готово\n");
     }
 }
+
+// Обход utc ∈ [from, to) с шагом stepSec. Свойства обратной конвертации:
+//  - localToUtc(utcToLocal(utc)) == utc, а в перекрытии - более ранний момент
+//    с тем же местным временем;
+//  - местное время из разрыва сдвигается вперёд на длину разрыва.
+static uint32_t verifySourceRoundTrip(const TzSource& src, const char* name,
+                                      time_t from, time_t to, time_t stepSec, uint32_t& checked) {
+    static constexpr uint32_t TZ_VERIFY_PRINT_LIMIT = 3;
+    uint32_t failures = 0;
+    DstIntervalCache current = buildSourceInterval(from, src);
+
+    for (time_t utc = from; utc < to; utc += stepSec) {
+        while (utc >= current.validUntil) {
+            const DstIntervalCache next = buildSourceInterval(current.validUntil, src);
+            const int32_t gap = next.offsetSec - current.offsetSec;
+            if (gap > 0) {
+                // Середина разрыва: местного времени нет, ждём сдвиг вперёд
+                const time_t gapLocal = current.validUntil + current.offsetSec + gap / 2;
+                const time_t expected = current.validUntil + gap / 2;
+                const time_t back = sourceLocalToUtc(gapLocal, src);
+                checked++;
+                if (back != expected) {
+                    if (++failures <= TZ_VERIFY_PRINT_LIMIT) {
+                        Serial.printf("\n[TZ]   %s: разрыв local=%ld → %ld, ожидалось %ld",
+                                      name, (long)gapLocal, (long)back, (long)expected);
+                    }
+                }
+            }
+            current = next;
+        }
+
+        const time_t local = utc + current.offsetSec;
+        const time_t back = sourceLocalToUtc(local, src);
+        bool ok = back == utc;
+        if (!ok && back < utc) {
+            // Перекрытие: допустим только более ранний момент с тем же местным временем
+            ok = back + buildSourceInterval(back, src).offsetSec == local;
+        }
+        checked++;
+        if (!ok && ++failures <= TZ_VERIFY_PRINT_LIMIT) {
+            Serial.printf("\n[TZ]   %s: utc=%ld local=%ld → %ld",
+                          name, (long)utc, (long)local, (long)back);
+        }
+        if ((checked & 0x3FFF) == 0) {
+            vTaskDelay(1);  // Не держим задачу меню: watchdog и дисплей
+        }
+    }
+    return failures;
+}
+
+// tz verify: текущий пояс поминутно, all - все пресеты и зоны tzdb с шагом 15 минут
+// (смещения и моменты переходов всех зон кратны 15 минутам)
+bool runTimezoneRoundTripCheck(bool allZones, int years, time_t stepSec) {
+    static constexpr time_t TZ_VERIFY_STEP_SEC = 60;
+    static constexpr time_t TZ_VERIFY_ALL_STEP_SEC = 15 * 60;
+
+    if (stepSec <= 0) stepSec = allZones ? TZ_VERIFY_ALL_STEP_SEC : TZ_VERIFY_STEP_SEC;
+    if (years < 1) years = 10;
+    if (years > 130) years = 130;
+
+    time_t now = getCurrentUTCTime();
+    if (now < 1600000000) {
+        now = 1735689600;  // 2025-01-01, если часы ещё не установлены
+    }
+    const int startYear = civilYearFromUtc(now);
+    if (sizeof(time_t) < 8 && startYear + years > 2038) {
+        years = 2038 - startYear;  // 32-битный time_t заканчивается 2038-01-19
+    }
+    const time_t from = makeUtcTime(startYear, 1, 1, 0, 0, 0);
+    const time_t to = makeUtcTime(startYear + years, 1, 1, 0, 0, 0);
+
+    uint32_t checked = 0;
+    uint32_t failures = 0;
+    uint16_t zones = 0;
+    const int64_t startUs = esp_timer_get_time();
+
+    if (!allZones) {
+        TzSource src;
+        if (!resolveTzSource(src)) {
+            Serial.print("\n[TZ] Часовой пояс не определён - проверять нечего");
+            return false;
+        }
+        Serial.printf("\n[TZ] Проверка localToUtc: %s, %d-%d, шаг %ld с",
+                      config.time_config.timezone_name, startYear, startYear + years - 1,
+                      (long)stepSec);
+        failures = verifySourceRoundTrip(src, config.time_config.timezone_name,
+                                         from, to, stepSec, checked);
+        zones = 1;
+    } else {
+        Serial.printf("\n[TZ] Проверка localToUtc: все зоны, %d-%d, шаг %ld с",
+                      startYear, startYear + years - 1, (long)stepSec);
+        for (uint8_t i = 0; i < PRESETS_COUNT; i++) {
+            const TimezonePreset* preset = &TIMEZONE_PRESETS[i];
+            failures += verifySourceRoundTrip(tzSourceFromPreset(preset), preset->zone_name,
+                                              from, to, stepSec, checked);
+            zones++;
+        }
+        for (uint16_t i = 0; i < tzdbZoneCount(); i++) {
+            const TzdbZone* zone = tzdbZoneAt(i);
+            failures += verifySourceRoundTrip(tzSourceFromZone(zone), zone->name,
+                                              from, to, stepSec, checked);
+            zones++;
+        }
+    }
+
+    const int64_t elapsedMs = (esp_timer_get_time() - startUs) / 1000;
+    Serial.printf("\n[TZ] Зон: %u, проверок: %lu, ошибок: %lu, %lu мс",
+                  (unsigned)zones, (unsigned long)checked, (unsigned long)failures,
+                  (unsigned long)elapsedMs);
+    Serial.print(failures == 0 ? "\n[TZ] ✅ Обратная конвертация точна" : "\n[TZ] ❌ Есть расхождения");
+    return failures == 0;
+}
+
+// xorshift32: воспроизводимая последовательность по seed
+static inline uint32_t tzFuzzNext(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// tz fuzz: случайные моменты 1970-2100 по всем пресетам и зонам tzdb. Проверяются
+// интервал (содержит момент, кэш совпадает с пересчётом), обратная конвертация,
+// год из civilYearFromUtc, пресет против calculateDSTStatus и против tzdb
+// (снимок zoneinfo) там, где у зоны уже действует текущее правило.
+bool runTimezoneFuzz(uint32_t samples, uint32_t seed) {
+    static constexpr uint32_t TZ_FUZZ_PRINT_LIMIT = 5;
+    if (samples == 0) samples = 100000;
+    if (seed == 0) seed = 0x2545F491;
+
+    const time_t from = makeUtcTime(1970, 1, 1, 0, 0, 0);
+    const time_t to = (sizeof(time_t) < 8) ? makeUtcTime(2038, 1, 1, 0, 0, 0)
+                                           : makeUtcTime(2100, 1, 1, 0, 0, 0);
+    const uint64_t span = static_cast<uint64_t>(to - from);
+    const uint16_t sourcesCount = PRESETS_COUNT + tzdbZoneCount();
+
+    uint32_t state = seed;
+    uint32_t intervalErrors = 0;
+    uint32_t cacheErrors = 0;
+    uint32_t inverseErrors = 0;
+    uint32_t civilErrors = 0;
+    uint32_t tableErrors = 0;
+    uint32_t tzdbMismatches = 0;
+    uint32_t tzdbCompared = 0;
+    uint32_t printed = 0;
+
+    Serial.printf("\n[TZ] Fuzz: %lu выборок, seed 0x%08lX, зон: %u",
+                  (unsigned long)samples, (unsigned long)seed, (unsigned)sourcesCount);
+
+    const int64_t startUs = esp_timer_get_time();
+    for (uint32_t n = 0; n < samples; n++) {
+        const uint32_t high = tzFuzzNext(state);
+        const uint64_t r = (static_cast<uint64_t>(high) << 32) | tzFuzzNext(state);
+        const time_t utc = from + static_cast<time_t>(r % span);
+        const uint16_t index = tzFuzzNext(state) % sourcesCount;
+
+        const TimezonePreset* preset = nullptr;
+        const TzdbZone* zone = nullptr;
+        TzSource src;
+        if (index < PRESETS_COUNT) {
+            preset = &TIMEZONE_PRESETS[index];
+            src = tzSourceFromPreset(preset);
+        } else {
+            zone = tzdbZoneAt(index - PRESETS_COUNT);
+            src = tzSourceFromZone(zone);
+        }
+        const char* name = preset ? preset->zone_name : zone->name;
+
+        const DstIntervalCache interval = buildSourceInterval(utc, src);
+        bool ok = utc >= interval.validFrom && utc < interval.validUntil;
+        if (!ok) intervalErrors++;
+
+        // Кэш: заполнение и попадание в другой точке того же интервала
+        if (ok) {
+            lookupSourceInterval(utc, src, false);
+            const time_t width = interval.validUntil - interval.validFrom;
+            time_t probe = utc;
+            if (interval.validFrom != TZ_TIME_MIN && interval.validUntil != TZ_TIME_MAX && width > 0) {
+                probe = interval.validFrom + static_cast<time_t>(tzFuzzNext(state) % static_cast<uint64_t>(width));
+            }
+            const DstIntervalCache cached = lookupSourceInterval(probe, src, false);
+            if (cached.offsetSec != interval.offsetSec || cached.dst != interval.dst) {
+                cacheErrors++;
+                ok = false;
+            }
+        }
+
+        const time_t local = utc + interval.offsetSec;
+        const time_t back = sourceLocalToUtc(local, src);
+        if (back != utc && !(back < utc && back + buildSourceInterval(back, src).offsetSec == local)) {
+            inverseErrors++;
+            ok = false;
+        }
+
+        const int year = civilYearFromUtc(utc);
+        if (utc < makeUtcTime(year, 1, 1, 0, 0, 0) || utc >= makeUtcTime(year + 1, 1, 1, 0, 0, 0)) {
+            civilErrors++;
+            ok = false;
+        }
+
+        // Две независимые реализации правила пресета
+        if (preset && calculateDSTStatus(utc, preset) != interval.dst) {
+            tableErrors++;
+            ok = false;
+        }
+
+        // Таблица пресетов против tzdb - расхождение данных, не кода
+        if (zone) {
+            TzdbSpan explicitSpan;
+            const TimezonePreset* twin = findPresetByLocation(zone->name);
+            if (twin && !tzdbExplicitSpan(zone, utc, explicitSpan)) {
+                tzdbCompared++;
+                const DstIntervalCache table = buildSourceInterval(utc, tzSourceFromPreset(twin));
+                // Только смещение: у Europe/Dublin в tzdb «летнее» - зимнее время (отрицательный DST)
+                if (table.offsetSec != interval.offsetSec) {
+                    if (++tzdbMismatches <= TZ_FUZZ_PRINT_LIMIT) {
+                        Serial.printf("\n[TZ]   %s: utc=%ld пресет %ld/%d, tzdb %ld/%d",
+                                      name, (long)utc, (long)table.offsetSec, table.dst ? 1 : 0,
+                                      (long)interval.offsetSec, interval.dst ? 1 : 0);
+                    }
+                }
+            }
+        }
+
+        if (!ok && ++printed <= TZ_FUZZ_PRINT_LIMIT) {
+            Serial.printf("\n[TZ]   %s: utc=%ld интервал [%ld, %ld) смещение %ld, обратно %ld",
+                          name, (long)utc, (long)interval.validFrom, (long)interval.validUntil,
+                          (long)interval.offsetSec, (long)back);
+        }
+        if ((n & 0xFFF) == 0xFFF) {
+            vTaskDelay(1);  // Не держим задачу меню: watchdog и дисплей
+        }
+    }
+    const int64_t elapsedUs = esp_timer_get_time() - startUs;
+
+    // Fuzz гонял кэш по чужим зонам - возвращаем текущий интервал
+    invalidateDstCache();
+    utcToLocal(getCurrentUTCTime());
+
+    const uint32_t errors = intervalErrors + cacheErrors + inverseErrors + civilErrors + tableErrors;
+    Serial.printf("\n[TZ]   интервал: %lu, кэш: %lu, localToUtc: %lu, год: %lu, пресет/calculateDSTStatus: %lu",
+                  (unsigned long)intervalErrors, (unsigned long)cacheErrors, (unsigned long)inverseErrors,
+                  (unsigned long)civilErrors, (unsigned long)tableErrors);
+    Serial.printf("\n[TZ]   пресет против tzdb: %lu из %lu", (unsigned long)tzdbMismatches,
+                  (unsigned long)tzdbCompared);
+    Serial.printf("\n[TZ]   %lu нс/выборку", (unsigned long)(elapsedUs * 1000 / samples));
+    Serial.print(errors == 0 ? "\n[TZ] ✅ Ошибок нет" : "\n[TZ] ❌ Есть ошибки");
+    return errors == 0;
+}
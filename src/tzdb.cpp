@@ -0,0 +1,78 @@
+#include "tzdb.h"
+#include "tzdb_data.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr uint16_t TZDB_ZONES_COUNT = sizeof(TZDB_ZONES) / sizeof(TZDB_ZONES[0]);
+
+}  // namespace
+
+const TzdbZone* tzdbFindZone(const char* name) {
+    if (!name || name[0] == '\0') return nullptr;
+
+    uint16_t lo = 0;
+    uint16_t hi = TZDB_ZONES_COUNT;
+    while (lo < hi) {
+        const uint16_t mid = static_cast<uint16_t>((lo + hi) / 2);
+        const int cmp = strcmp(TZDB_ZONES[mid].name, name);
+        if (cmp == 0) return &TZDB_ZONES[mid];
+        if (cmp < 0) {
+            lo = static_cast<uint16_t>(mid + 1);
+        } else {
+            hi = mid;
+        }
+    }
+    return nullptr;
+}
+
+uint16_t tzdbZoneCount() {
+    return TZDB_ZONES_COUNT;
+}
+
+const TzdbZone* tzdbZoneAt(uint16_t index) {
+    return (index < TZDB_ZONES_COUNT) ? &TZDB_ZONES[index] : nullptr;
+}
+
+const char* tzdbVersion() {
+    return TZDB_VERSION;
+}
+
+bool tzdbExplicitSpan(const TzdbZone* zone, time_t utc, TzdbSpan& span) {
+    span.from = TZ_TIME_MIN;
+    span.until = TZ_TIME_MAX;
+    span.offsetSec = zone->initialOffsetMin * 60;
+    span.dst = zone->initialDst != 0;
+    if (zone->transitionCount == 0) {
+        return false;
+    }
+
+    const TzdbTransition* first = &TZDB_TRANSITIONS[zone->firstTransition];
+    const TzdbTransition* last = first + zone->transitionCount - 1;
+    if (utc >= last->utc) {
+        span.from = last->utc;
+        span.offsetSec = last->offsetMin * 60;
+        span.dst = last->dst != 0;
+        return false;
+    }
+
+    // Первый переход позже utc (upper_bound)
+    uint16_t lo = 0;
+    uint16_t hi = zone->transitionCount;
+    while (lo < hi) {
+        const uint16_t mid = static_cast<uint16_t>((lo + hi) / 2);
+        if (first[mid].utc <= utc) {
+            lo = static_cast<uint16_t>(mid + 1);
+        } else {
+            hi = mid;
+        }
+    }
+    span.until = first[lo].utc;
+    if (lo > 0) {
+        span.from = first[lo - 1].utc;
+        span.offsetSec = first[lo - 1].offsetMin * 60;
+        span.dst = first[lo - 1].dst != 0;
+    }
+    return true;
+}
@@ -0,0 +1,302 @@
+#include "wifi_fast_connect.h"
+
+#include "time_utils.h"
+
+#include <Preferences.h>
+#include <WiFi.h>
+#include <atomic>
+#include <esp_netif.h>
+#include <esp_netif_net_stack.h>
+#include <lwip/dhcp.h>
+#include <lwip/tcpip.h>
+
+namespace {
+
+constexpr const char* WIFI_CACHE_NS = "wifi_fc";
+constexpr const char* WIFI_CACHE_PARTITION = "cfg_nvs";
+constexpr const char* WIFI_CACHE_KEYS[2] = {"ap0", "ap1"};  // две сети из конфигурации
+constexpr uint32_t WIFI_CACHE_MAGIC = 0x57464343;  // WFCC
+constexpr uint32_t WIFI_CACHE_VERSION = 2;
+constexpr uint32_t WIFI_DIRECTED_TIMEOUT_MS = 2000;
+constexpr uint32_t WIFI_POLL_MS = 20;
+// Адрес из прошлой аренды используем только до её T1 (момент продления по RFC 2131):
+// при статическом адресе аренда на роутере не продлевается, и после T1 роутер вправе
+// отдать адрес другому. Срок выдаёт сервер в DHCPACK; сверху — не дольше суток.
+constexpr uint32_t WIFI_LEASE_MAX_AGE_SEC = 24UL * 3600UL;
+constexpr uint32_t WIFI_LEASE_READ_TIMEOUT_MS = 100;
+constexpr time_t WIFI_VALID_UTC_MIN = 1751785500;  // 2025-07-06 07:05 UTC, как в applyNtpTime()
+
+struct WifiCacheRecord {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t ssidHash;
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint8_t leaseValid;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns1;
+    uint32_t dns2;
+    uint32_t leaseUtc;       // когда адрес получен по DHCP
+    uint32_t leaseRenewSec;  // T1 из DHCPACK: столько секунд от leaseUtc адрес можно брать из кэша
+    uint32_t crc;
+};
+
+bool g_wifiCachePrefsFallbackWarned = false;
+
+uint32_t fnv1aHash(const uint8_t* bytes, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; ++i) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+uint32_t ssidHashOf(const char* ssid) {
+    return fnv1aHash(reinterpret_cast<const uint8_t*>(ssid), strlen(ssid));
+}
+
+uint32_t hashRecord(const WifiCacheRecord& rec) {
+    return fnv1aHash(reinterpret_cast<const uint8_t*>(&rec), sizeof(WifiCacheRecord) - sizeof(rec.crc));
+}
+
+bool beginCachePrefs(Preferences& prefs, bool readOnly) {
+    if (prefs.begin(WIFI_CACHE_NS, readOnly, WIFI_CACHE_PARTITION)) {
+        return true;
+    }
+
+    if (!g_wifiCachePrefsFallbackWarned) {
+        g_wifiCachePrefsFallbackWarned = true;
+        Serial.print("\n[SYSTEM][WARN] Раздел cfg_nvs недоступен для кэша WiFi, fallback на default NVS");
+    }
+
+    return prefs.begin(WIFI_CACHE_NS, readOnly);
+}
+
+bool readSlot(uint8_t slot, WifiCacheRecord& out) {
+    Preferences prefs;
+    if (!beginCachePrefs(prefs, true)) {
+        return false;
+    }
+    WifiCacheRecord rec = {};
+    const bool ok = prefs.getBytesLength(WIFI_CACHE_KEYS[slot]) == sizeof(rec) &&
+                    prefs.getBytes(WIFI_CACHE_KEYS[slot], &rec, sizeof(rec)) == sizeof(rec);
+    prefs.end();
+    if (!ok || rec.magic != WIFI_CACHE_MAGIC || rec.version != WIFI_CACHE_VERSION || rec.crc != hashRecord(rec)) {
+        return false;
+    }
+    out = rec;
+    return true;
+}
+
+bool writeSlot(uint8_t slot, WifiCacheRecord& rec) {
+    rec.magic = WIFI_CACHE_MAGIC;
+    rec.version = WIFI_CACHE_VERSION;
+    rec.crc = hashRecord(rec);
+
+    Preferences prefs;
+    if (!beginCachePrefs(prefs, false)) {
+        return false;
+    }
+    const size_t written = prefs.putBytes(WIFI_CACHE_KEYS[slot], &rec, sizeof(rec));
+    prefs.end();
+    return written == sizeof(rec);
+}
+
+// Слот с записью для этой сети; иначе — свободный или самый старый (для новой записи).
+int8_t findSlot(uint32_t ssidHash, WifiCacheRecord& out, bool& found) {
+    found = false;
+    int8_t freeSlot = -1;
+    int8_t oldestSlot = 0;
+    uint32_t oldestUtc = UINT32_MAX;
+    for (uint8_t i = 0; i < 2; ++i) {
+        WifiCacheRecord rec = {};
+        if (!readSlot(i, rec)) {
+            if (freeSlot < 0) {
+                freeSlot = static_cast<int8_t>(i);
+            }
+            continue;
+        }
+        if (rec.ssidHash == ssidHash) {
+            out = rec;
+            found = true;
+            return static_cast<int8_t>(i);
+        }
+        if (rec.leaseUtc < oldestUtc) {
+            oldestUtc = rec.leaseUtc;
+            oldestSlot = static_cast<int8_t>(i);
+        }
+    }
+    return (freeSlot >= 0) ? freeSlot : oldestSlot;
+}
+
+bool leaseIsFresh(const WifiCacheRecord& rec) {
+    if (!rec.leaseValid || rec.ip == 0 || rec.leaseRenewSec == 0) {
+        return false;
+    }
+    const time_t nowUtc = getCurrentUTCTime();
+    if (nowUtc < WIFI_VALID_UTC_MIN || nowUtc < static_cast<time_t>(rec.leaseUtc)) {
+        return false;
+    }
+    return static_cast<uint32_t>(nowUtc - static_cast<time_t>(rec.leaseUtc)) < rec.leaseRenewSec;
+}
+
+// --- Срок аренды из DHCP-клиента lwIP ---
+// Состояние клиента принадлежит задаче tcpip, поэтому читается через tcpip_callback().
+std::atomic<uint32_t> g_dhcpRenewSec{0};
+std::atomic<bool> g_dhcpRenewRead{false};
+
+void readDhcpRenewInTcpip(void* ctx) {
+    struct netif* lwipNetif = static_cast<struct netif*>(ctx);
+    const struct dhcp* dhcp = netif_dhcp_data(lwipNetif);
+    uint32_t renewSec = 0;
+    if (dhcp && dhcp->state == DHCP_STATE_BOUND) {
+        // Сервер мог не прислать T1: по RFC 2131 это половина срока аренды.
+        renewSec = (dhcp->offered_t1_renew != 0) ? dhcp->offered_t1_renew : dhcp->offered_t0_lease / 2;
+    }
+    g_dhcpRenewSec.store(renewSec, std::memory_order_relaxed);
+    g_dhcpRenewRead.store(true, std::memory_order_release);
+}
+
+// T1 текущей аренды STA в секундах; 0 — DHCP не в состоянии BOUND или срок не прочитан.
+uint32_t readDhcpRenewSec() {
+    esp_netif_t* sta = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+    struct netif* lwipNetif = sta ? static_cast<struct netif*>(esp_netif_get_netif_impl(sta)) : nullptr;
+    if (!lwipNetif) {
+        return 0;
+    }
+    g_dhcpRenewRead.store(false, std::memory_order_relaxed);
+    if (tcpip_callback(&readDhcpRenewInTcpip, lwipNetif) != ERR_OK) {
+        return 0;
+    }
+    const uint32_t startMs = millis();
+    while (!g_dhcpRenewRead.load(std::memory_order_acquire)) {
+        if (millis() - startMs >= WIFI_LEASE_READ_TIMEOUT_MS) {
+            return 0;
+        }
+        delay(1);
+    }
+    const uint32_t renewSec = g_dhcpRenewSec.load(std::memory_order_relaxed);
+    return (renewSec < WIFI_LEASE_MAX_AGE_SEC) ? renewSec : WIFI_LEASE_MAX_AGE_SEC;
+}
+
+void useDhcp() {
+    WiFi.config(IPAddress(static_cast<uint32_t>(0)), IPAddress(static_cast<uint32_t>(0)),
+                IPAddress(static_cast<uint32_t>(0)));
+}
+
+bool waitConnected(uint32_t startMs, uint32_t timeoutMs) {
+    while (WiFi.status() != WL_CONNECTED && (millis() - startMs) < timeoutMs) {
+        delay(WIFI_POLL_MS);
+    }
+    return WiFi.status() == WL_CONNECTED;
+}
+
+// Сохраняем только изменившееся: при статическом адресе запись обычно не меняется.
+void rememberConnection(int8_t slot, const WifiCacheRecord* previous, uint32_t ssidHash, bool viaDhcp) {
+    WifiCacheRecord rec = {};
+    if (previous) {
+        rec = *previous;
+    }
+    rec.ssidHash = ssidHash;
+    const uint8_t* bssid = WiFi.BSSID();
+    if (bssid) {
+        memcpy(rec.bssid, bssid, sizeof(rec.bssid));
+    }
+    rec.channel = static_cast<uint8_t>(WiFi.channel());
+
+    const time_t nowUtc = getCurrentUTCTime();
+    if (viaDhcp) {
+        // Без известного срока аренды (или часов) адрес не кэшируется: только BSSID/канал.
+        const uint32_t renewSec = (nowUtc >= WIFI_VALID_UTC_MIN) ? readDhcpRenewSec() : 0;
+        rec.ip = static_cast<uint32_t>(WiFi.localIP());
+        rec.gateway = static_cast<uint32_t>(WiFi.gatewayIP());
+        rec.subnet = static_cast<uint32_t>(WiFi.subnetMask());
+        rec.dns1 = static_cast<uint32_t>(WiFi.dnsIP(0));
+        rec.dns2 = static_cast<uint32_t>(WiFi.dnsIP(1));
+        rec.leaseUtc = static_cast<uint32_t>(nowUtc);
+        rec.leaseRenewSec = renewSec;
+        rec.leaseValid = (rec.ip != 0 && renewSec != 0) ? 1 : 0;
+    }
+
+    if (previous) {
+        WifiCacheRecord cmp = rec;
+        cmp.crc = previous->crc;
+        if (memcmp(&cmp, previous, sizeof(cmp)) == 0) {
+            return;
+        }
+    }
+    writeSlot(static_cast<uint8_t>(slot), rec);
+}
+
+} // namespace
+
+bool wifiFastConnect(const char* ssid, const char* pass, uint32_t timeoutMs,
+                     const char* logPrefix, WifiConnectInfo* info) {
+    WifiConnectInfo localInfo;
+    WifiConnectInfo& result = info ? *info : localInfo;
+    result = WifiConnectInfo();
+    if (!ssid || ssid[0] == '\0') {
+        return false;
+    }
+
+    const uint32_t startMs = millis();
+    const uint32_t ssidHash = ssidHashOf(ssid);
+    WifiCacheRecord cached = {};
+    bool haveCache = false;
+    const int8_t slot = findSlot(ssidHash, cached, haveCache);
+
+    // 1. Направленное подключение: без сканирования всех каналов, а при свежей
+    //    аренде — ещё и без обмена DHCP.
+    if (haveCache && cached.channel != 0) {
+        const bool staticLease = leaseIsFresh(cached);
+        if (staticLease) {
+            WiFi.config(IPAddress(cached.ip), IPAddress(cached.gateway), IPAddress(cached.subnet),
+                        IPAddress(cached.dns1), IPAddress(cached.dns2));
+        } else {
+            useDhcp();
+        }
+        WiFi.begin(ssid, pass, cached.channel, cached.bssid, true);
+        const uint32_t directedMs = (timeoutMs < WIFI_DIRECTED_TIMEOUT_MS) ? timeoutMs : WIFI_DIRECTED_TIMEOUT_MS;
+        if (waitConnected(startMs, directedMs)) {
+            result.directed = true;
+            result.cachedLease = staticLease;
+            result.connectMs = millis() - startMs;
+            Serial.printf("\n%s Быстрое подключение к %s за %lu мс (канал %u%s)", logPrefix, ssid,
+                          static_cast<unsigned long>(result.connectMs), static_cast<unsigned>(cached.channel),
+                          staticLease ? ", адрес из кэша" : "");
+            rememberConnection(slot, &cached, ssidHash, !staticLease);
+            return true;
+        }
+        Serial.printf("\n%s Быстрое подключение к %s не удалось, поиск сети", logPrefix, ssid);
+        WiFi.disconnect(false);
+        delay(50);
+    }
+
+    // 2. Обычное подключение со сканированием и DHCP
+    useDhcp();
+    WiFi.begin(ssid, pass);
+    if (!waitConnected(startMs, timeoutMs)) {
+        return false;
+    }
+    result.connectMs = millis() - startMs;
+    Serial.printf("\n%s Подключено к %s за %lu мс", logPrefix, ssid, static_cast<unsigned long>(result.connectMs));
+    rememberConnection(slot, haveCache ? &cached : nullptr, ssidHash, true);
+    return true;
+}
+
+void wifiFastConnectDropLease(const char* ssid) {
+    if (!ssid || ssid[0] == '\0') {
+        return;
+    }
+    WifiCacheRecord cached = {};
+    bool found = false;
+    const int8_t slot = findSlot(ssidHashOf(ssid), cached, found);
+    if (!found || !cached.leaseValid) {
+        return;
+    }
+    cached.leaseValid = 0;
+    writeSlot(static_cast<uint8_t>(slot), cached);
+}
@@ -0,0 +1,52 @@
+// "audio bench" на хосте: такты на отсчёт (ESP.getCycleCount() - TSC процессора)
+// у регулятора громкости с делением на 100 и у Q15, блок как у DMA-буфера.
+
+#include <Arduino.h>
+#include "audio_gain.h"
+
+#include <string.h>
+
+namespace {
+constexpr size_t BENCH_SAMPLES = 256 * 2;  // AUDIO_CHUNK_SAMPLES стереокадров, как в audio_task.cpp
+constexpr uint32_t BENCH_ROUNDS = 20000;
+int16_t g_source[BENCH_SAMPLES];
+int16_t g_work[BENCH_SAMPLES];
+
+// Указатели на функции: компилятор не встроит ядро в цикл замера
+void (*volatile g_reference)(int16_t*, size_t, uint8_t) = applyVolumePercentReference;
+void (*volatile g_q15)(int16_t*, size_t, uint16_t) = applyGainToInterleavedBuffer;
+
+double cyclesPerSample(uint64_t cycles) {
+    return static_cast<double>(cycles) / (static_cast<double>(BENCH_SAMPLES) * BENCH_ROUNDS);
+}
+}
+
+int main() {
+    uint32_t seed = 0x1234567U;
+    for (size_t i = 0; i < BENCH_SAMPLES; ++i) {
+        seed = seed * 1664525U + 1013904223U;
+        g_source[i] = static_cast<int16_t>(seed >> 16);
+    }
+
+    Serial.printf("%u отсчётов x %lu прогонов\n", static_cast<unsigned>(BENCH_SAMPLES),
+                  static_cast<unsigned long>(BENCH_ROUNDS));
+    for (const uint8_t volume : {30, 70, 99}) {
+        const uint16_t gainQ15 = volumePercentToGainQ15(volume);
+        uint64_t divideCycles = 0;
+        uint64_t q15Cycles = 0;
+        for (uint32_t round = 0; round < BENCH_ROUNDS; ++round) {
+            memcpy(g_work, g_source, sizeof(g_source));
+            uint32_t start = ESP.getCycleCount();
+            g_reference(g_work, BENCH_SAMPLES, volume);
+            divideCycles += ESP.getCycleCount() - start;
+
+            memcpy(g_work, g_source, sizeof(g_source));
+            start = ESP.getCycleCount();
+            g_q15(g_work, BENCH_SAMPLES, gainQ15);
+            q15Cycles += ESP.getCycleCount() - start;
+        }
+        Serial.printf("громкость %3u%%: деление на 100 %.2f такта/отсчёт, Q15 %.2f такта/отсчёт\n",
+                      volume, cyclesPerSample(divideCycles), cyclesPerSample(q15Cycles));
+    }
+    return 0;
+}
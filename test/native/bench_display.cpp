@@ -0,0 +1,154 @@
+// "disp bench" на хосте: DisplayManager + Nixie6SpiDriver прошивки против модели
+// 74HC595 (support/mock_gpio.h). Поток disp_refresh обслуживает переходы, как в main.cpp.
+// Сначала штатный runLatchBench() (трасса драйвера), затем независимая проверка по
+// защёлкам модели: итоговый кадр тика, отсутствие чужих кадров и двойных защёлок;
+// в плавных прогонах гамма меняется посреди перехода.
+
+#include "display/display_manager.h"
+#include "display/nixie_6_spi.h"
+#include "support/display_env.h"
+#include "support/mock_gpio.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+namespace {
+constexpr time_t LOCAL_START = 1735732795;  // 2025-01-01 11:59:55: переход через минуту и час
+constexpr uint16_t BENCH_TICKS = 20;
+constexpr uint16_t CHECK_TICKS = 12;
+constexpr uint32_t SETTLE_TIMEOUT_MS = 1000;
+
+std::atomic<bool> g_stop{false};
+unsigned g_failures = 0;
+
+void check(bool ok, const char* what, const char* tick) {
+    if (!ok) {
+        printf("\n  ОШИБКА %s: %s", tick, what);
+        g_failures++;
+    }
+}
+
+// Как displayRefreshTask() в main.cpp: сервис с периодом, который просит backend
+void refreshTask(DisplayManager* display) {
+    while (!g_stop.load()) {
+        display->serviceAnimations(millis());
+        const uint32_t serviceMs = display->animationServiceIntervalMs(millis());
+        std::this_thread::sleep_for(std::chrono::milliseconds(serviceMs > 0 ? serviceMs : 20));
+    }
+}
+
+void settle(const DisplayManager& display) {
+    const uint32_t startMs = millis();
+    while (display.hasActiveAnimation() && millis() - startMs < SETTLE_TIMEOUT_MS) {
+        delay(2);
+    }
+    delay(nixie6GetTransitionHoldMs() + 5);
+}
+
+void showLocal(DisplayManager& display, time_t local) {
+    tm t{};
+    gmtime_r(&local, &t);
+    display.updateFromLocalTime(t, millis(), 7, 0, 8, 0);
+}
+
+void formatDigits(time_t local, char* out, size_t outSize) {
+    tm t{};
+    gmtime_r(&local, &t);
+    snprintf(out, outSize, "%02d%02d%02d", t.tm_hour, t.tm_min, t.tm_sec);
+}
+
+struct CheckTotals {
+    unsigned long latches = 0;
+    unsigned long queued = 0;
+    int64_t updateUsMax = 0;
+};
+
+void checkTicks(DisplayManager& display, const char* label, CheckTotals& totals) {
+    showLocal(display, LOCAL_START);
+    settle(display);
+    (void)mockTakeLatches();
+
+    for (uint16_t i = 0; i < CHECK_TICKS; ++i) {
+        const time_t local = LOCAL_START + 1 + i;
+        char prev[8];
+        char expected[8];
+        formatDigits(local - 1, prev, sizeof(prev));
+        formatDigits(local, expected, sizeof(expected));
+        char tick[48];
+        snprintf(tick, sizeof(tick), "%s %s", label, expected);
+
+        const int64_t startUs = esp_timer_get_time();
+        showLocal(display, local);
+        const int64_t updateUs = esp_timer_get_time() - startUs;
+        totals.updateUsMax = updateUs > totals.updateUsMax ? updateUs : totals.updateUsMax;
+        if (nixie6IsSoftTransitionEnabled() && (i & 1U) != 0) {
+            // Две смены гаммы посреди перехода (engineering menu): переход доигрывает свою копию таблицы
+            const float gamma = nixie6GetTransitionGamma();
+            delay(nixie6GetTransitionDurationMs() / 3);
+            nixie6SetTransitionGamma(1.0f);
+            nixie6SetTransitionGamma(gamma);
+        }
+        settle(display);
+
+        const std::vector<MockLatch> latches = mockTakeLatches();
+        check(!latches.empty(), "кадр не защёлкнут", tick);
+        char digits[8] = "";
+        for (size_t k = 0; k < latches.size(); ++k) {
+            nixie6DecodeWire(latches[k].wire, digits, nullptr);
+            check(strcmp(digits, prev) == 0 || strcmp(digits, expected) == 0, "чужой кадр в переходе", tick);
+            // Серии DMA длиннее DMA_MAX_RUN_SLOTS повторяют кадр, прямые защёлки - нет
+            if (k > 0 && !latches[k].queued && !latches[k - 1].queued &&
+                memcmp(latches[k].wire, latches[k - 1].wire, 4) == 0) {
+                check(false, "двойная защёлка", tick);
+            }
+            totals.queued += latches[k].queued ? 1 : 0;
+        }
+        check(strcmp(digits, expected) == 0, "неверный итоговый кадр", tick);
+        if (!nixie6IsSoftTransitionEnabled()) {
+            check(latches.size() == 1, "без перехода - ровно одна защёлка", tick);
+        }
+        totals.latches += latches.size();
+    }
+}
+}
+
+int main() {
+    hostConfigureNixie6(NIX6_OUTPUT_REVERSE_INVERT);
+    DisplayManager display;
+    display.begin();
+    std::thread refresh(refreshTask, &display);
+
+    nixie6SetSoftTransitionEnabled(true);
+    const bool benchOk = display.runLatchBench(LOCAL_START, BENCH_TICKS);
+    check(benchOk, "runLatchBench() не запустился", "bench");
+    (void)mockTakeLatches();
+
+    struct {
+        Nix6OutputMode mode;
+        bool soft;
+        const char* label;
+    } const runs[] = {
+        {NIX6_OUTPUT_REVERSE_INVERT, true, "reverse/переход"},
+        {NIX6_OUTPUT_REVERSE_INVERT, false, "reverse/сразу"},
+        {NIX6_OUTPUT_STD, true, "std/переход"},
+        {NIX6_OUTPUT_STD, false, "std/сразу"},
+    };
+    for (const auto& run : runs) {
+        config.nix6_output_mode = run.mode;
+        nixie6SetSoftTransitionEnabled(run.soft);
+        CheckTotals totals;
+        checkTicks(display, run.label, totals);
+        printf("\n[HOST] %s: %u тиков, защёлок модели %lu (DMA %lu), update тика до %lld мкс",
+               run.label, static_cast<unsigned>(CHECK_TICKS), totals.latches, totals.queued,
+               static_cast<long long>(totals.updateUsMax));
+    }
+
+    g_stop = true;
+    refresh.join();
+    printf("\nошибок: %u\n", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
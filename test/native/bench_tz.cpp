@@ -0,0 +1,30 @@
+// "tz bench" на хосте: нс на конвертацию без кэша (calculateDSTStatus) и с кэшем
+// интервала для нескольких поясов. Код возврата проверяет только сброс кэша при
+// смене пояса: после setTimezone() смещение не должно остаться от прежней зоны.
+
+#include "support/tz_env.h"
+#include "timezone_manager.h"
+
+#include <stdio.h>
+
+int main() {
+    static const char* const ZONES[] = {"Europe/Warsaw", "America/New_York", "Australia/Sydney", "Asia/Tokyo"};
+    static constexpr time_t PROBE_UTC = 1751328000;  // 2025-07-01, лето северного полушария
+
+    hostSetCurrentUtc(1735689600);  // 2025-01-01
+
+    bool ok = true;
+    time_t prevLocal = 0;
+    for (const char* zone : ZONES) {
+        hostSelectZone(zone);
+        const time_t local = utcToLocal(PROBE_UTC);
+        if (local == prevLocal) {
+            printf("\n%s: смещение осталось от прежнего пояса", zone);
+            ok = false;
+        }
+        prevLocal = local;
+        runTimezoneBenchmark();
+        printf("\n");
+    }
+    return ok ? 0 : 1;
+}
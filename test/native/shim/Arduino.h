@@ -0,0 +1,157 @@
+#pragma once
+
+// Хостовая подмена Arduino-ESP32 для test/native: ровно то, что нужно
+// собираемым модулям прошивки. Serial печатает в stdout, время - steady_clock.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef struct hw_timer_s hw_timer_t;
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+// GPIO: запись попадает в мок (test/native/support/mock_gpio.*), чтение - 0
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogReadResolution(int bits);
+int digitalPinToInterrupt(int pin);
+void attachInterrupt(int irq, void (*isr)(), int mode);
+void detachInterrupt(int irq);
+float temperatureRead();
+
+size_t strlcpy(char* dst, const char* src, size_t size);
+size_t strlcat(char* dst, const char* src, size_t size);
+
+template <class T>
+T constrain(T x, T lo, T hi) {
+    return x < lo ? lo : (x > hi ? hi : x);
+}
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+long random(long maxValue);
+long random(long minValue, long maxValue);
+
+inline bool isDigit(int c) { return c >= '0' && c <= '9'; }
+inline bool isSpace(int c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+class String {
+public:
+    String(const char* s = "") : s_(s ? s : "") {}
+    String(const std::string& s) : s_(s) {}
+    explicit String(char c) : s_(1, c) {}
+    explicit String(int v) : s_(std::to_string(v)) {}
+    explicit String(unsigned v) : s_(std::to_string(v)) {}
+    explicit String(long v) : s_(std::to_string(v)) {}
+    explicit String(unsigned long v) : s_(std::to_string(v)) {}
+    explicit String(double v, int decimals = 2);
+
+    const char* c_str() const { return s_.c_str(); }
+    unsigned length() const { return static_cast<unsigned>(s_.size()); }
+    bool isEmpty() const { return s_.empty(); }
+    char operator[](unsigned i) const { return i < s_.size() ? s_[i] : 0; }
+    char charAt(unsigned i) const { return (*this)[i]; }
+
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(s_.c_str(), nullptr); }
+    int indexOf(char c, unsigned from = 0) const;
+    int indexOf(const char* str, unsigned from = 0) const;
+    int lastIndexOf(char c) const;
+    String substring(unsigned from) const;
+    String substring(unsigned from, unsigned to) const;
+    bool startsWith(const char* prefix) const { return s_.compare(0, strlen(prefix), prefix) == 0; }
+    bool endsWith(const char* suffix) const;
+    bool equals(const char* str) const { return s_ == str; }
+    bool equalsIgnoreCase(const char* str) const;
+    void replace(const char* from, const char* to);
+
+    String& operator+=(const String& rhs) { s_ += rhs.s_; return *this; }
+    String& operator+=(const char* rhs) { s_ += rhs; return *this; }
+    String& operator+=(char c) { s_ += c; return *this; }
+    String operator+(const String& rhs) const { return String(s_ + rhs.s_); }
+    String operator+(const char* rhs) const { return String(s_ + rhs); }
+    bool operator==(const char* rhs) const { return s_ == rhs; }
+    bool operator==(const String& rhs) const { return s_ == rhs.s_; }
+    bool operator!=(const char* rhs) const { return s_ != rhs; }
+
+private:
+    std::string s_;
+};
+
+String operator+(const char* lhs, const String& rhs);
+
+class Print {
+public:
+    size_t print(const char* s);
+    size_t print(const String& s) { return print(s.c_str()); }
+    size_t print(char c);
+    size_t print(int v);
+    size_t print(unsigned v);
+    size_t print(long v);
+    size_t print(unsigned long v);
+    size_t print(double v, int decimals = 2);
+    size_t println(const char* s = "");
+    size_t println(const String& s) { return println(s.c_str()); }
+    size_t println(int v);
+    size_t println(unsigned v);
+    size_t println(long v);
+    size_t println(unsigned long v);
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    size_t write(uint8_t c);
+    size_t write(const uint8_t* data, size_t size);
+};
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long) {}
+    int available() { return 0; }
+    int read() { return -1; }
+    String readStringUntil(char) { return String(); }
+    void flush();
+    void setTimeout(unsigned long) {}
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getCycleCount();
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getFreeHeap() { return 0; }
+    void restart() { abort(); }
+};
+
+extern EspClass ESP;
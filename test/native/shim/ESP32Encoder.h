@@ -0,0 +1,5 @@
+#pragma once
+
+#include "Arduino.h"
+
+class ESP32Encoder {};
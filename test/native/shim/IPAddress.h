@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+class String;
+
+class IPAddress {
+public:
+    IPAddress() : addr_(0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+        : addr_(static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) |
+                (static_cast<uint32_t>(c) << 16) | (static_cast<uint32_t>(d) << 24)) {}
+    IPAddress(uint32_t addr) : addr_(addr) {}
+    operator uint32_t() const { return addr_; }
+    uint8_t operator[](int i) const { return static_cast<uint8_t>(addr_ >> (8 * i)); }
+    bool operator==(const IPAddress& rhs) const { return addr_ == rhs.addr_; }
+    bool operator!=(const IPAddress& rhs) const { return addr_ != rhs.addr_; }
+    String toString() const;
+
+private:
+    uint32_t addr_;
+};
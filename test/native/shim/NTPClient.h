@@ -0,0 +1,9 @@
+#pragma once
+
+#include "Arduino.h"
+#include "WiFiUdp.h"
+
+class NTPClient {
+public:
+    NTPClient(UDP&, const char* = "pool.ntp.org", long = 0, unsigned long = 60000) {}
+};
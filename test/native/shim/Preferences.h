@@ -0,0 +1,9 @@
+#pragma once
+
+#include "Arduino.h"
+
+class Preferences {
+public:
+    bool begin(const char*, bool = false, const char* = nullptr) { return false; }
+    void end() {}
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Arduino.h"
+
+class DateTime {
+public:
+    DateTime(uint32_t t = 0) : t_(t) {}
+    uint32_t unixtime() const { return t_; }
+
+private:
+    uint32_t t_;
+};
+
+class RTC_DS3231 {};
@@ -0,0 +1,38 @@
+#pragma once
+
+// SPIClass на хосте: байты уходят в модель цепочки 74HC595 (support/mock_gpio.h),
+// CS/LATCH драйвер дёргает сам через digitalWrite().
+
+#include "Arduino.h"
+
+#define FSPI 0
+#define HSPI 1
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define SPI_MODE0 0
+
+class SPISettings {
+public:
+    SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0)
+        : clock_(clock), bitOrder_(bitOrder), dataMode_(dataMode) {}
+
+    uint32_t clock_;
+    uint8_t bitOrder_;
+    uint8_t dataMode_;
+};
+
+class SPIClass {
+public:
+    explicit SPIClass(uint8_t bus = HSPI) : bus_(bus) {}
+
+    bool begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1);
+    void end() {}
+    void beginTransaction(SPISettings settings);
+    void endTransaction();
+    uint8_t transfer(uint8_t data);
+    void transfer(void* data, uint32_t size);
+
+private:
+    uint8_t bus_;
+    uint32_t clockHz_ = 1000000;
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+// WiFi на хосте: всегда отключён.
+
+#include "Arduino.h"
+#include "IPAddress.h"
+#include "WiFiUdp.h"
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL,
+    WL_SCAN_COMPLETED,
+    WL_CONNECTED,
+    WL_CONNECT_FAILED,
+    WL_CONNECTION_LOST,
+    WL_DISCONNECTED
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class WiFiClass {
+public:
+    wl_status_t begin(const char*, const char* = nullptr, int32_t = 0, const uint8_t* = nullptr, bool = true) {
+        return WL_CONNECT_FAILED;
+    }
+    wl_status_t status() { return WL_DISCONNECTED; }
+    bool disconnect(bool = false, bool = false) { return true; }
+    bool mode(wifi_mode_t) { return true; }
+    wifi_mode_t getMode() { return WIFI_OFF; }
+    IPAddress localIP() { return IPAddress(); }
+    int32_t RSSI() { return 0; }
+};
+
+extern WiFiClass WiFi;
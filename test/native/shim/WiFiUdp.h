@@ -0,0 +1,11 @@
+#pragma once
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+class UDP {
+public:
+    virtual ~UDP() {}
+};
+
+class WiFiUDP : public UDP {};
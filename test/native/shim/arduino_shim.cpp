@@ -0,0 +1,454 @@
+#include "Arduino.h"
+#include "IPAddress.h"
+#include "WiFi.h"
+#include "Wire.h"
+#include "ezTime.h"
+#include "esp_heap_caps.h"
+
+#include <malloc.h>
+#include <stdarg.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+TwoWire Wire;
+Timezone UTC;
+
+namespace {
+using HostClock = std::chrono::steady_clock;
+const HostClock::time_point g_bootTime = HostClock::now();
+
+std::recursive_mutex g_criticalMutex;
+}
+
+// ========== ВРЕМЯ ==========
+
+int64_t esp_timer_get_time() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(HostClock::now() - g_bootTime).count();
+}
+
+uint32_t millis() {
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+}
+
+uint32_t micros() {
+    return static_cast<uint32_t>(esp_timer_get_time());
+}
+
+void delay(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us) {
+    const int64_t until = esp_timer_get_time() + us;
+    while (esp_timer_get_time() < until) {
+    }
+}
+
+void yield() {
+    std::this_thread::yield();
+}
+
+uint32_t EspClass::getCycleCount() {
+#if defined(__x86_64__) || defined(__i386__)
+    return static_cast<uint32_t>(__rdtsc());
+#else
+    return static_cast<uint32_t>(esp_timer_get_time() * 240);
+#endif
+}
+
+// ========== FreeRTOS ==========
+
+void hostEnterCritical(portMUX_TYPE* mux) {
+    (void)mux;
+    g_criticalMutex.lock();
+}
+
+void hostExitCritical(portMUX_TYPE* mux) {
+    (void)mux;
+    g_criticalMutex.unlock();
+}
+
+void (*hostTaskDelayHook)() = nullptr;
+
+void vTaskDelay(TickType_t ticks) {
+    if (hostTaskDelayHook) {
+        hostTaskDelayHook();
+    }
+    if (ticks == 0) {
+        std::this_thread::yield();
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+TickType_t xTaskGetTickCount() {
+    return millis();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    static thread_local int marker;
+    return &marker;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return new std::recursive_timed_mutex();
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+    return new std::recursive_timed_mutex();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    auto* m = static_cast<std::recursive_timed_mutex*>(sem);
+    if (ticks == portMAX_DELAY) {
+        m->lock();
+        return pdTRUE;
+    }
+    return m->try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    static_cast<std::recursive_timed_mutex*>(sem)->unlock();
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks) {
+    return xSemaphoreTake(sem, ticks);
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem) {
+    return xSemaphoreGive(sem);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    delete static_cast<std::recursive_timed_mutex*>(sem);
+}
+
+// ========== esp_timer ==========
+
+struct esp_timer {
+    esp_timer_create_args_t args{};
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::thread worker;
+    uint64_t generation = 0;
+    bool active = false;
+};
+
+namespace {
+void runHostTimer(esp_timer* timer, uint64_t generation, uint64_t periodUs, bool periodic) {
+    auto deadline = HostClock::now() + std::chrono::microseconds(periodUs);
+    std::unique_lock<std::mutex> lock(timer->mutex);
+    while (timer->generation == generation) {
+        if (timer->wake.wait_until(lock, deadline) != std::cv_status::timeout) {
+            continue;
+        }
+        if (timer->generation != generation) {
+            break;
+        }
+        if (!periodic) {
+            timer->active = false;
+        }
+        lock.unlock();
+        timer->args.callback(timer->args.arg);
+        lock.lock();
+        if (!periodic) {
+            break;
+        }
+        deadline += std::chrono::microseconds(periodUs);
+    }
+}
+
+esp_err_t startHostTimer(esp_timer_handle_t timer, uint64_t periodUs, bool periodic) {
+    if (timer == nullptr || periodUs == 0) {
+        return ESP_FAIL;
+    }
+    std::unique_lock<std::mutex> lock(timer->mutex);
+    if (timer->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (timer->worker.joinable()) {
+        // Прошлый поток уже вышел или выходит (generation сменилась в stop)
+        std::thread old = std::move(timer->worker);
+        lock.unlock();
+        if (old.get_id() == std::this_thread::get_id()) {
+            old.detach();
+        } else {
+            old.join();
+        }
+        lock.lock();
+    }
+    timer->active = true;
+    const uint64_t generation = ++timer->generation;
+    timer->worker = std::thread(runHostTimer, timer, generation, periodUs, periodic);
+    return ESP_OK;
+}
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out) {
+    if (args == nullptr || out == nullptr || args->callback == nullptr) {
+        return ESP_FAIL;
+    }
+    auto* timer = new esp_timer();
+    timer->args = *args;
+    *out = timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t periodUs) {
+    return startHostTimer(timer, periodUs, true);
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeoutUs) {
+    return startHostTimer(timer, timeoutUs, false);
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (timer == nullptr) {
+        return ESP_FAIL;
+    }
+    std::unique_lock<std::mutex> lock(timer->mutex);
+    if (!timer->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->active = false;
+    ++timer->generation;
+    timer->wake.notify_all();
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    if (timer == nullptr) {
+        return ESP_FAIL;
+    }
+    esp_timer_stop(timer);
+    if (timer->worker.joinable()) {
+        timer->worker.join();
+    }
+    delete timer;
+    return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer) {
+    std::lock_guard<std::mutex> lock(timer->mutex);
+    return timer->active;
+}
+
+// ========== КУЧА ==========
+
+void* heap_caps_malloc(size_t size, uint32_t caps) {
+    (void)caps;
+    return malloc(size);
+}
+
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    (void)caps;
+    return calloc(n, size);
+}
+
+void heap_caps_free(void* ptr) {
+    free(ptr);
+}
+
+void heap_caps_get_info(multi_heap_info_t* info, uint32_t caps) {
+    (void)caps;
+    const struct mallinfo2 mi = mallinfo2();
+    *info = {};
+    info->total_free_bytes = mi.fordblks;
+    info->total_allocated_bytes = mi.uordblks;
+}
+
+// ========== GPIO ==========
+
+// pinMode/digitalWrite/digitalRead - support/mock_gpio.cpp (модель 74HC595)
+
+int analogRead(uint8_t pin) {
+    (void)pin;
+    return 0;
+}
+
+void analogReadResolution(int bits) {
+    (void)bits;
+}
+
+int digitalPinToInterrupt(int pin) {
+    return pin;
+}
+
+void attachInterrupt(int irq, void (*isr)(), int mode) {
+    (void)irq;
+    (void)isr;
+    (void)mode;
+}
+
+void detachInterrupt(int irq) {
+    (void)irq;
+}
+
+float temperatureRead() {
+    return 25.0f;
+}
+
+// ========== СТРОКИ ==========
+
+size_t strlcpy(char* dst, const char* src, size_t size) {
+    const size_t len = strlen(src);
+    if (size > 0) {
+        const size_t n = std::min(len, size - 1);
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+
+size_t strlcat(char* dst, const char* src, size_t size) {
+    const size_t used = strnlen(dst, size);
+    if (used == size) {
+        return size + strlen(src);
+    }
+    return used + strlcpy(dst + used, src, size - used);
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+long random(long maxValue) {
+    return maxValue > 0 ? ::random() % maxValue : 0;
+}
+
+long random(long minValue, long maxValue) {
+    return minValue + random(maxValue - minValue);
+}
+
+String::String(double v, int decimals) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+    s_ = buf;
+}
+
+void String::trim() {
+    const size_t first = s_.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) {
+        s_.clear();
+        return;
+    }
+    s_ = s_.substr(first, s_.find_last_not_of(" \t\r\n") - first + 1);
+}
+
+void String::toLowerCase() {
+    for (char& c : s_) {
+        if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+    }
+}
+
+void String::toUpperCase() {
+    for (char& c : s_) {
+        if (c >= 'a' && c <= 'z') c = static_cast<char>(c - 'a' + 'A');
+    }
+}
+
+int String::indexOf(char c, unsigned from) const {
+    const size_t pos = s_.find(c, from);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+int String::indexOf(const char* str, unsigned from) const {
+    const size_t pos = s_.find(str, from);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+int String::lastIndexOf(char c) const {
+    const size_t pos = s_.rfind(c);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+String String::substring(unsigned from) const {
+    return from >= s_.size() ? String() : String(s_.substr(from));
+}
+
+String String::substring(unsigned from, unsigned to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s_.size()) return String();
+    return String(s_.substr(from, to - from));
+}
+
+bool String::endsWith(const char* suffix) const {
+    const size_t n = strlen(suffix);
+    return n <= s_.size() && s_.compare(s_.size() - n, n, suffix) == 0;
+}
+
+bool String::equalsIgnoreCase(const char* str) const {
+    return strcasecmp(s_.c_str(), str) == 0;
+}
+
+void String::replace(const char* from, const char* to) {
+    const size_t n = strlen(from);
+    if (n == 0) return;
+    for (size_t pos = s_.find(from); pos != std::string::npos; pos = s_.find(from, pos + strlen(to))) {
+        s_.replace(pos, n, to);
+    }
+}
+
+String operator+(const char* lhs, const String& rhs) {
+    return String(lhs) + rhs;
+}
+
+String IPAddress::toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(buf);
+}
+
+// ========== Serial ==========
+
+size_t Print::print(const char* s) {
+    return fputs(s, stdout) < 0 ? 0 : strlen(s);
+}
+
+size_t Print::print(char c) {
+    return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+size_t Print::print(int v) { return printf("%d", v); }
+size_t Print::print(unsigned v) { return printf("%u", v); }
+size_t Print::print(long v) { return printf("%ld", v); }
+size_t Print::print(unsigned long v) { return printf("%lu", v); }
+size_t Print::print(double v, int decimals) { return printf("%.*f", decimals, v); }
+
+size_t Print::println(const char* s) { return print(s) + print('\n'); }
+size_t Print::println(int v) { return print(v) + print('\n'); }
+size_t Print::println(unsigned v) { return print(v) + print('\n'); }
+size_t Print::println(long v) { return print(v) + print('\n'); }
+size_t Print::println(unsigned long v) { return print(v) + print('\n'); }
+
+size_t Print::printf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    const int n = vprintf(format, args);
+    va_end(args);
+    return n < 0 ? 0 : static_cast<size_t>(n);
+}
+
+size_t Print::write(uint8_t c) {
+    return print(static_cast<char>(c));
+}
+
+size_t Print::write(const uint8_t* data, size_t size) {
+    return fwrite(data, 1, size, stdout);
+}
+
+void HardwareSerial::flush() {
+    fflush(stdout);
+}
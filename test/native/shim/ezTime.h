@@ -0,0 +1,47 @@
+#pragma once
+
+// ezTime на хосте: сети нет, правила зоны не приходят (getPosix() пустой) -
+// timezone_manager работает на офлайн-правилах, как прошивка до синхронизации.
+
+#include "Arduino.h"
+
+#define UTC_TIME 1
+#define LOCAL_TIME 2
+#define NONE 0
+#define ERROR 1
+#define INFO 2
+#define DEBUG 3
+
+typedef enum { timeNotSet, timeNeedsSync, timeSet } timeStatus_t;
+
+class Timezone {
+public:
+    bool setLocation(const String& location = "") { (void)location; return false; }
+    bool setPosix(const String& posix) { posix_ = posix; return true; }
+    String getPosix() { return posix_; }
+    void setDefault() {}
+    time_t tzTime(time_t t, int, String& abbr, bool& dst, int16_t& offset) {
+        abbr = "UTC";
+        dst = false;
+        offset = 0;
+        return t;
+    }
+    time_t tzTime(time_t t = 0, int = LOCAL_TIME) { return t; }
+    String getTimezoneName(time_t = 0) { return String("UTC"); }
+    int16_t getOffset(time_t = 0) { return 0; }
+    bool isDST(time_t = 0) { return false; }
+    String dateTime(const String& = "") { return String(); }
+    String dateTime(time_t, const String& = "") { return String(); }
+
+private:
+    String posix_;
+};
+
+extern Timezone UTC;
+
+inline void waitForSync(uint16_t = 0) {}
+inline timeStatus_t timeStatus() { return timeNotSet; }
+inline void setInterval(uint16_t) {}
+inline void setDebug(int) {}
+inline void events() {}
+inline void setServer(const String&) {}
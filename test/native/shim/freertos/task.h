@@ -0,0 +1,12 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void*);
+
+void vTaskDelay(TickType_t ticks);
+// Хост: вызывается из vTaskDelay - тест видит состояние в точках уступки задачи
+extern void (*hostTaskDelayHook)();
+TickType_t xTaskGetTickCount();
+TaskHandle_t xTaskGetCurrentTaskHandle();
+#define taskYIELD() vTaskDelay(0)
@@ -0,0 +1,39 @@
+#include "display_env.h"
+
+#include "hardware.h"
+#include "mock_gpio.h"
+#include "platform_profile.h"
+
+Config config;
+
+namespace {
+uint8_t g_pwmLevel = 255;
+}
+
+void hostConfigureNixie6(Nix6OutputMode mode) {
+    config.clock_type = CLOCK_TYPE_NIXIE;
+    config.clock_digits = 6;
+    config.nix6_output_mode = mode;
+    config.brightness_control_enabled = false;
+    platformRefreshCapabilities();
+    mockShiftRegisterAttach(HSPI_CS_PIN, HSPI_SCK_PIN, HSPI_MOSI_PIN);
+}
+
+uint16_t readLightSensorFiltered(uint8_t samples, uint8_t adcResolutionBits) {
+    (void)samples;
+    (void)adcResolutionBits;
+    return 512;
+}
+
+void setDisplayPwmLevel(uint8_t level) {
+    g_pwmLevel = level;
+}
+
+uint8_t getDisplayPwmLevel() {
+    return g_pwmLevel;
+}
+
+// На хосте OE без PWM: окна гашения нет, как в прошивке до инициализации LEDC
+void waitDisplayBlankWindow(uint32_t leadUs) {
+    (void)leadUs;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "config.h"
+
+// Окружение DisplayManager/Nixie6SpiDriver на хосте: config, заглушки hardware.cpp.
+// Шина индикации - модель 74HC595 из mock_gpio.h на пинах HSPI_* прошивки.
+
+// Nixie 6 разрядов с заданным порядком вывода; регистр подключается к линиям HSPI_*
+void hostConfigureNixie6(Nix6OutputMode mode);
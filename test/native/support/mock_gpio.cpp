@@ -0,0 +1,93 @@
+#include "mock_gpio.h"
+
+#include "Arduino.h"
+#include "esp_timer.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace {
+constexpr uint8_t PIN_COUNT = 64;
+
+std::mutex g_gpioMutex;
+uint8_t g_levels[PIN_COUNT] = {};
+bool g_attached = false;
+uint8_t g_latchPin = 0;
+uint8_t g_sckPin = 0;
+uint8_t g_mosiPin = 0;
+uint32_t g_shiftRegister = 0;
+std::vector<MockLatch> g_latches;
+
+void latchLocked(int64_t atUs, bool queued) {
+    MockLatch latch{};
+    latch.atUs = atUs;
+    for (uint8_t i = 0; i < 4; ++i) {
+        latch.wire[i] = static_cast<uint8_t>(g_shiftRegister >> (24 - 8 * i));
+    }
+    latch.queued = queued;
+    g_latches.push_back(latch);
+}
+}
+
+void mockShiftRegisterAttach(uint8_t latchPin, uint8_t sckPin, uint8_t mosiPin) {
+    std::lock_guard<std::mutex> lock(g_gpioMutex);
+    g_attached = true;
+    g_latchPin = latchPin;
+    g_sckPin = sckPin;
+    g_mosiPin = mosiPin;
+    g_shiftRegister = 0;
+    g_latches.clear();
+}
+
+void mockShiftRegisterShiftByte(uint8_t value) {
+    std::lock_guard<std::mutex> lock(g_gpioMutex);
+    g_shiftRegister = (g_shiftRegister << 8) | value;
+}
+
+void mockShiftRegisterLatch(int64_t atUs, bool queued) {
+    std::lock_guard<std::mutex> lock(g_gpioMutex);
+    latchLocked(atUs, queued);
+}
+
+std::vector<MockLatch> mockTakeLatches() {
+    std::lock_guard<std::mutex> lock(g_gpioMutex);
+    std::vector<MockLatch> out;
+    out.swap(g_latches);
+    // Транзакции очереди записаны при постановке с будущим моментом защёлки
+    std::stable_sort(out.begin(), out.end(),
+                     [](const MockLatch& a, const MockLatch& b) { return a.atUs < b.atUs; });
+    return out;
+}
+
+uint8_t mockPinLevel(uint8_t pin) {
+    std::lock_guard<std::mutex> lock(g_gpioMutex);
+    return pin < PIN_COUNT ? g_levels[pin] : LOW;
+}
+
+// ========== Arduino GPIO ==========
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin >= PIN_COUNT) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(g_gpioMutex);
+    const bool rising = g_levels[pin] == LOW && value != LOW;
+    g_levels[pin] = value != LOW ? HIGH : LOW;
+    if (!g_attached || !rising) {
+        return;
+    }
+    if (pin == g_sckPin) {
+        g_shiftRegister = (g_shiftRegister << 1) | g_levels[g_mosiPin];
+    } else if (pin == g_latchPin) {
+        latchLocked(esp_timer_get_time(), false);
+    }
+}
+
+int digitalRead(uint8_t pin) {
+    return mockPinLevel(pin);
+}
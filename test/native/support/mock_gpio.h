@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// GPIO на хосте и модель цепочки 74HC595 индикации.
+// Регистр сдвигается фронтом CLK (bit-bang) или байтами SPI (SPIClass, spi_master),
+// фронт LATCH (digitalWrite или подъём CS в конце транзакции) переносит последние
+// 32 бита на выходы и попадает в журнал защёлок.
+
+struct MockLatch {
+    int64_t atUs;      // момент защёлки (esp_timer_get_time)
+    uint8_t wire[4];   // байты шины в порядке сдвига, как Nixie6LatchRecord::wire
+    bool queued;       // транзакция из очереди DMA (spi_device_queue_trans)
+};
+
+// Линии цепочки: до вызова регистр не подключён, digitalWrite() только запоминает уровни
+void mockShiftRegisterAttach(uint8_t latchPin, uint8_t sckPin, uint8_t mosiPin);
+void mockShiftRegisterShiftByte(uint8_t value);
+void mockShiftRegisterLatch(int64_t atUs, bool queued);
+
+// Журнал защёлок в порядке времени; забирается и очищается целиком
+std::vector<MockLatch> mockTakeLatches();
+
+uint8_t mockPinLevel(uint8_t pin);
@@ -0,0 +1,158 @@
+// SPIClass и SPI master ESP-IDF на хосте поверх модели 74HC595 (mock_gpio.h).
+
+#include "mock_gpio.h"
+
+#include "SPI.h"
+#include "driver/spi_master.h"
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// ========== SPIClass ==========
+
+bool SPIClass::begin(int8_t sck, int8_t miso, int8_t mosi, int8_t ss) {
+    (void)sck;
+    (void)miso;
+    (void)mosi;
+    (void)ss;
+    return true;
+}
+
+void SPIClass::beginTransaction(SPISettings settings) {
+    clockHz_ = settings.clock_;
+}
+
+void SPIClass::endTransaction() {}
+
+uint8_t SPIClass::transfer(uint8_t data) {
+    mockShiftRegisterShiftByte(data);
+    return 0;
+}
+
+void SPIClass::transfer(void* data, uint32_t size) {
+    auto* bytes = static_cast<uint8_t*>(data);
+    for (uint32_t i = 0; i < size; ++i) {
+        mockShiftRegisterShiftByte(bytes[i]);
+        bytes[i] = 0;  // MISO не подключён
+    }
+    delayMicroseconds(static_cast<uint32_t>(size * 8ULL * 1000000ULL / clockHz_));
+}
+
+// ========== spi_master ==========
+
+struct spi_device_t {
+    int clockHz = 0;
+    int queueSize = 0;
+    std::mutex mutex;
+    // Поставленные транзакции и моменты их окончания (= подъём CS)
+    std::deque<std::pair<spi_transaction_t*, int64_t>> inFlight;
+    int64_t busFreeUs = 0;
+};
+
+namespace {
+size_t transactionBytes(const spi_transaction_t* trans) {
+    return (trans->length + 7U) / 8U;
+}
+
+const uint8_t* transactionTx(const spi_transaction_t* trans) {
+    return (trans->flags & SPI_TRANS_USE_TXDATA) ? trans->tx_data : static_cast<const uint8_t*>(trans->tx_buffer);
+}
+
+// Шина под мьютексом устройства: транзакция начинается после предыдущей, данные
+// уходят в регистр сразу, защёлка записывается с моментом окончания.
+int64_t shiftTransactionLocked(spi_device_t* dev, const spi_transaction_t* trans, bool queued) {
+    const size_t bytes = transactionBytes(trans);
+    const int64_t nowUs = esp_timer_get_time();
+    const int64_t startUs = dev->busFreeUs > nowUs ? dev->busFreeUs : nowUs;
+    const int64_t doneUs = startUs + static_cast<int64_t>(trans->length * 1000000ULL / dev->clockHz);
+    const uint8_t* tx = transactionTx(trans);
+    for (size_t i = 0; i < bytes; ++i) {
+        mockShiftRegisterShiftByte(tx[i]);
+    }
+    mockShiftRegisterLatch(doneUs, queued);
+    dev->busFreeUs = doneUs;
+    return doneUs;
+}
+
+void sleepUntilUs(int64_t atUs) {
+    const int64_t waitUs = atUs - esp_timer_get_time();
+    if (waitUs > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(waitUs));
+    }
+}
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t* bus, spi_dma_chan_t dma) {
+    (void)host;
+    (void)dma;
+    return bus != nullptr ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host) {
+    (void)host;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t* dev,
+                             spi_device_handle_t* out) {
+    (void)host;
+    if (dev == nullptr || out == nullptr || dev->clock_speed_hz <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    auto* device = new spi_device_t();
+    device->clockHz = dev->clock_speed_hz;
+    device->queueSize = dev->queue_size;
+    *out = device;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t* trans, TickType_t ticksToWait) {
+    (void)ticksToWait;
+    std::lock_guard<std::mutex> lock(handle->mutex);
+    if (static_cast<int>(handle->inFlight.size()) >= handle->queueSize) {
+        return ESP_ERR_TIMEOUT;
+    }
+    handle->inFlight.emplace_back(trans, shiftTransactionLocked(handle, trans, true));
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t** trans,
+                                      TickType_t ticksToWait) {
+    const int64_t deadlineUs = (ticksToWait == portMAX_DELAY)
+                                   ? INT64_MAX
+                                   : esp_timer_get_time() + static_cast<int64_t>(ticksToWait) * 1000;
+    while (true) {
+        int64_t wakeUs = deadlineUs;
+        {
+            std::lock_guard<std::mutex> lock(handle->mutex);
+            const int64_t nowUs = esp_timer_get_time();
+            if (!handle->inFlight.empty()) {
+                if (handle->inFlight.front().second <= nowUs) {
+                    *trans = handle->inFlight.front().first;
+                    handle->inFlight.pop_front();
+                    return ESP_OK;
+                }
+                wakeUs = handle->inFlight.front().second < deadlineUs ? handle->inFlight.front().second : deadlineUs;
+            }
+            if (nowUs >= deadlineUs) {
+                return ESP_ERR_TIMEOUT;
+            }
+        }
+        sleepUntilUs(wakeUs == INT64_MAX ? esp_timer_get_time() + 1000 : wakeUs);
+    }
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t* trans) {
+    int64_t doneUs = 0;
+    {
+        std::lock_guard<std::mutex> lock(handle->mutex);
+        if (!handle->inFlight.empty()) {
+            return ESP_ERR_INVALID_STATE;  // как в IDF: опрос при непустой очереди недопустим
+        }
+        doneUs = shiftTransactionLocked(handle, trans, false);
+    }
+    sleepUntilUs(doneUs);
+    return ESP_OK;
+}
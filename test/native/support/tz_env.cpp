@@ -0,0 +1,33 @@
+#include "tz_env.h"
+
+#include "config.h"
+#include "menu_manager.h"
+#include "time_utils.h"
+#include "timezone_manager.h"
+
+Config config;
+
+namespace {
+time_t g_hostUtc = 0;
+}
+
+void hostSetCurrentUtc(time_t utc) {
+    g_hostUtc = utc;
+}
+
+bool hostSelectZone(const char* name) {
+    config.time_config.automatic_localtime = true;
+    config.time_config.tz_posix[0] = '\0';
+    config.time_config.tz_posix_zone[0] = '\0';
+    return setTimezone(name);
+}
+
+time_t getCurrentUTCTime() {
+    return g_hostUtc;
+}
+
+void invalidateTimeSnapshot() {}
+
+void saveConfig() {}
+
+void printMappingMenuCommands() {}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <time.h>
+
+// Окружение timezone_manager на хосте: config, заглушки time_utils/меню.
+
+// getCurrentUTCTime() тестов: фиксированный момент (0 - часы не установлены)
+void hostSetCurrentUtc(time_t utc);
+
+// Зона активна через setTimezone(), как из меню; false - зоны нет в базе
+bool hostSelectZone(const char* name);
@@ -0,0 +1,62 @@
+// Q15-регулятор громкости против эталона с делением на 100: каждая громкость
+// 0..100 на каждом значении int16. Допуск - 1 LSB, результат не громче входа.
+
+#include "audio_gain.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace {
+constexpr size_t ALL_SAMPLES = 65536;
+int16_t g_source[ALL_SAMPLES];
+int16_t g_q15[ALL_SAMPLES];
+int16_t g_reference[ALL_SAMPLES];
+}
+
+int main() {
+    for (size_t i = 0; i < ALL_SAMPLES; ++i) {
+        g_source[i] = static_cast<int16_t>(static_cast<int32_t>(i) + INT16_MIN);
+    }
+
+    int32_t worstDiff = 0;
+    unsigned failures = 0;
+    for (unsigned volume = 0; volume <= 100; ++volume) {
+        for (size_t i = 0; i < ALL_SAMPLES; ++i) {
+            g_q15[i] = g_source[i];
+            g_reference[i] = g_source[i];
+        }
+        applyGainToInterleavedBuffer(g_q15, ALL_SAMPLES, volumePercentToGainQ15(static_cast<uint8_t>(volume)));
+        applyVolumePercentReference(g_reference, ALL_SAMPLES, static_cast<uint8_t>(volume));
+
+        for (size_t i = 0; i < ALL_SAMPLES; ++i) {
+            const int32_t diff = abs(static_cast<int32_t>(g_q15[i]) - g_reference[i]);
+            worstDiff = (diff > worstDiff) ? diff : worstDiff;
+            const bool louder = abs(static_cast<int32_t>(g_q15[i])) > abs(static_cast<int32_t>(g_source[i]));
+            if ((diff > 1 || louder) && ++failures <= 5) {
+                printf("громкость %u%%: %d -> Q15 %d, эталон %d\n",
+                       volume, g_source[i], g_q15[i], g_reference[i]);
+            }
+        }
+    }
+
+    // Развёрнутый цикл и хвост: длины, не кратные четырём отсчётам
+    for (size_t length = 0; length <= 9; ++length) {
+        int16_t buf[9];
+        const uint16_t gain = volumePercentToGainQ15(37);
+        for (size_t i = 0; i < length; ++i) {
+            buf[i] = static_cast<int16_t>(1000 * (static_cast<int>(i) + 1) - 4500);
+        }
+        applyGainToInterleavedBuffer(buf, length, gain);
+        for (size_t i = 0; i < length; ++i) {
+            const int16_t expected = scaleSampleQ15(static_cast<int16_t>(1000 * (static_cast<int>(i) + 1) - 4500), gain);
+            if (buf[i] != expected && ++failures <= 10) {
+                printf("длина %zu, отсчёт %zu: %d, ожидалось %d\n", length, i, buf[i], expected);
+            }
+        }
+    }
+
+    printf("101 громкость x %zu отсчётов: макс. расхождение %d LSB, ошибок %u\n",
+           ALL_SAMPLES, static_cast<int>(worstDiff), failures);
+    return (failures == 0 && worstDiff <= 1) ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+// Обмен NTP против стенда-сервера на 127.0.0.1: часы сервера спешат на известное
+// смещение, путь туда и обратно задерживается одинаково, между T2 и T3 сервер
+// "обрабатывает" запрос. ntpParseReply() должен вернуть смещение с точностью до
+// миллисекунды и задержку без времени обработки; чужие и негодные ответы - отбросить.
+
+#include "ntp_packet.h"
+
+#include <arpa/inet.h>
+#include <esp_timer.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+namespace {
+constexpr int64_t LOCAL_EPOCH_US = 1735689600LL * 1000000LL;  // 2025-01-01: локальные часы клиента
+constexpr int64_t SERVER_AHEAD_US = 1234567;                   // насколько сервер впереди
+constexpr int64_t PATH_DELAY_US = 15000;                       // в каждую сторону
+constexpr int64_t SERVER_HOLD_US = 20000;                      // T2 -> T3 на сервере
+constexpr int64_t MAX_DELAY_US = 500000;
+constexpr int64_t OFFSET_TOLERANCE_US = 2000;
+constexpr int SAMPLES = 4;
+
+enum class Scenario : int { Normal, WrongOriginate, KissOfDeath, Unsynchronized, ClientMode, NegativeHold };
+
+std::atomic<int> g_scenario{static_cast<int>(Scenario::Normal)};
+std::atomic<bool> g_stop{false};
+unsigned g_failures = 0;
+
+void check(bool ok, const char* what) {
+    if (!ok) {
+        printf("ОШИБКА: %s\n", what);
+        g_failures++;
+    }
+}
+
+void sleepUs(int64_t us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+int64_t localUtcUs() {
+    return LOCAL_EPOCH_US + esp_timer_get_time();
+}
+
+// Кодер метки независим от ntp_packet.cpp: эра 0 до 2036, дальше перенос через 2^32
+void writeTimestamp(uint8_t* p, int64_t unixUs) {
+    const uint64_t sec = static_cast<uint64_t>(unixUs / 1000000 + NTP_UNIX_EPOCH_DELTA) & 0xFFFFFFFFULL;
+    const uint64_t frac = (static_cast<uint64_t>(unixUs % 1000000) << 32) / 1000000ULL;
+    for (int i = 0; i < 4; ++i) {
+        p[i] = static_cast<uint8_t>(sec >> (24 - 8 * i));
+        p[4 + i] = static_cast<uint8_t>(frac >> (24 - 8 * i));
+    }
+}
+
+void runServer(int sock) {
+    while (!g_stop.load()) {
+        uint8_t request[NTP_PACKET_SIZE];
+        sockaddr_in from{};
+        socklen_t fromLen = sizeof(from);
+        const ssize_t n = recvfrom(sock, request, sizeof(request), 0, reinterpret_cast<sockaddr*>(&from), &fromLen);
+        if (n != static_cast<ssize_t>(NTP_PACKET_SIZE)) {
+            continue;
+        }
+        const Scenario scenario = static_cast<Scenario>(g_scenario.load());
+
+        sleepUs(PATH_DELAY_US);
+        const int64_t t2 = localUtcUs() + SERVER_AHEAD_US;
+        sleepUs(SERVER_HOLD_US);
+        int64_t t3 = localUtcUs() + SERVER_AHEAD_US;
+        if (scenario == Scenario::NegativeHold) {
+            t3 = t2 - 1000;
+        }
+
+        uint8_t reply[NTP_PACKET_SIZE] = {0};
+        reply[0] = (0 << 6) | (4 << 3) | 4;  // LI = 0, VN = 4, Mode = 4 (сервер)
+        reply[1] = 2;
+        if (scenario == Scenario::KissOfDeath) reply[1] = 0;
+        if (scenario == Scenario::Unsynchronized) reply[0] = (3 << 6) | (4 << 3) | 4;
+        if (scenario == Scenario::ClientMode) reply[0] = (4 << 3) | 3;
+        memcpy(reply + 24, request + 40, 8);  // originate = transmit клиента
+        if (scenario == Scenario::WrongOriginate) reply[31] ^= 0x01;
+        writeTimestamp(reply + 32, t2);
+        writeTimestamp(reply + 40, t3);
+
+        sleepUs(PATH_DELAY_US);
+        sendto(sock, reply, sizeof(reply), 0, reinterpret_cast<sockaddr*>(&from), fromLen);
+    }
+}
+
+// Один обмен, как ntpSendRequest()/ntpReadReply() в time_utils.cpp
+NtpReplyStatus exchange(int sock, const sockaddr_in& server, uint32_t seq, NtpExchange& out, int64_t& localAtT4) {
+    NtpCookie cookie;
+    cookie.sec = seq;
+    cookie.frac = seq ^ 0x5A5AA5A5UL;
+    uint8_t packet[NTP_PACKET_SIZE];
+    ntpBuildRequest(packet, cookie);
+
+    const int64_t t1 = esp_timer_get_time();
+    sendto(sock, packet, sizeof(packet), 0, reinterpret_cast<const sockaddr*>(&server), sizeof(server));
+    uint8_t reply[NTP_PACKET_SIZE];
+    const ssize_t n = recv(sock, reply, sizeof(reply), 0);
+    const int64_t t4 = esp_timer_get_time();
+    localAtT4 = LOCAL_EPOCH_US + t4;
+    if (n != static_cast<ssize_t>(NTP_PACKET_SIZE)) {
+        printf("нет ответа стенда\n");
+        return NtpReplyStatus::BadTiming;
+    }
+    return ntpParseReply(reply, cookie, t1, t4, MAX_DELAY_US, out);
+}
+
+void checkTimestampDecoding() {
+    uint8_t ts[8];
+    writeTimestamp(ts, 1735689600LL * 1000000LL + 250000);
+    check(ntpTimestampToUnixUs(ts) == 1735689600LL * 1000000LL + 250000, "метка 2025 г.");
+
+    // 2036-02-07 06:28:16 UTC - секунды NTP переходят через 2^32 (эра 1)
+    const int64_t eraUs = (0x100000000LL - NTP_UNIX_EPOCH_DELTA + 10) * 1000000LL + 500000;
+    writeTimestamp(ts, eraUs);
+    check(ntpTimestampToUnixUs(ts) == eraUs, "метка после 2036 г. (эра 1)");
+
+    uint8_t request[NTP_PACKET_SIZE];
+    NtpCookie cookie;
+    cookie.sec = 0x01020304;
+    cookie.frac = 0xA0B0C0D0;
+    ntpBuildRequest(request, cookie);
+    check(request[0] == 0x23, "заголовок запроса LI=0 VN=4 Mode=3");
+    check(request[40] == 0x01 && request[43] == 0x04 && request[44] == 0xA0 && request[47] == 0xD0,
+          "метка-идентификатор в transmit timestamp");
+}
+}
+
+int main() {
+    checkTimestampDecoding();
+
+    const int serverSock = socket(AF_INET, SOCK_DGRAM, 0);
+    const int clientSock = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in server{};
+    server.sin_family = AF_INET;
+    server.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    server.sin_port = 0;
+    if (serverSock < 0 || clientSock < 0 ||
+        bind(serverSock, reinterpret_cast<sockaddr*>(&server), sizeof(server)) != 0) {
+        printf("не удалось открыть UDP на 127.0.0.1\n");
+        return 1;
+    }
+    socklen_t len = sizeof(server);
+    getsockname(serverSock, reinterpret_cast<sockaddr*>(&server), &len);
+    timeval timeout{1, 0};
+    setsockopt(serverSock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(clientSock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    std::thread serverThread(runServer, serverSock);
+
+    // Несколько замеров, остаётся минимальная задержка (как ntpAcceptSample)
+    NtpExchange best;
+    int64_t bestOffset = 0;
+    for (int i = 0; i < SAMPLES; ++i) {
+        NtpExchange sample;
+        int64_t localAtT4 = 0;
+        const NtpReplyStatus status = exchange(clientSock, server, 100 + i, sample, localAtT4);
+        check(status == NtpReplyStatus::Ok, "годный ответ стенда");
+        if (status == NtpReplyStatus::Ok && (i == 0 || sample.delayUs < best.delayUs)) {
+            best = sample;
+            bestOffset = sample.utcUs - localAtT4;
+        }
+    }
+    printf("смещение %+lld мкс (сервер впереди на %lld), задержка %lld мкс (путь 2 x %lld, обработка %lld)\n",
+           static_cast<long long>(bestOffset), static_cast<long long>(SERVER_AHEAD_US),
+           static_cast<long long>(best.delayUs), static_cast<long long>(PATH_DELAY_US),
+           static_cast<long long>(SERVER_HOLD_US));
+    const int64_t offsetError = bestOffset - SERVER_AHEAD_US;
+    check(offsetError > -OFFSET_TOLERANCE_US && offsetError < OFFSET_TOLERANCE_US, "смещение в пределах 2 мс");
+    check(best.delayUs >= 2 * PATH_DELAY_US && best.delayUs < 2 * PATH_DELAY_US + SERVER_HOLD_US,
+          "задержка без времени обработки на сервере");
+    check(best.stratum == 2, "stratum из ответа");
+
+    struct {
+        Scenario scenario;
+        NtpReplyStatus expected;
+        const char* what;
+    } const rejects[] = {
+        {Scenario::WrongOriginate, NtpReplyStatus::Foreign, "чужой originate"},
+        {Scenario::KissOfDeath, NtpReplyStatus::Rejected, "stratum 0 (kiss-o'-death)"},
+        {Scenario::Unsynchronized, NtpReplyStatus::Rejected, "LI = 3 (сервер не синхронизирован)"},
+        {Scenario::ClientMode, NtpReplyStatus::Rejected, "mode 3 в ответе"},
+        {Scenario::NegativeHold, NtpReplyStatus::BadTiming, "T3 раньше T2"},
+    };
+    uint32_t seq = 200;
+    for (const auto& r : rejects) {
+        g_scenario = static_cast<int>(r.scenario);
+        NtpExchange sample;
+        int64_t localAtT4 = 0;
+        check(exchange(clientSock, server, seq++, sample, localAtT4) == r.expected, r.what);
+    }
+
+    // Задержка выше предела: тот же годный ответ с пределом меньше пути
+    g_scenario = static_cast<int>(Scenario::Normal);
+    {
+        NtpCookie cookie;
+        cookie.sec = seq;
+        cookie.frac = seq ^ 0x5A5AA5A5UL;
+        uint8_t packet[NTP_PACKET_SIZE];
+        ntpBuildRequest(packet, cookie);
+        const int64_t t1 = esp_timer_get_time();
+        sendto(clientSock, packet, sizeof(packet), 0, reinterpret_cast<const sockaddr*>(&server), sizeof(server));
+        uint8_t reply[NTP_PACKET_SIZE];
+        const bool received = recv(clientSock, reply, sizeof(reply), 0) == static_cast<ssize_t>(NTP_PACKET_SIZE);
+        NtpExchange sample;
+        check(received && ntpParseReply(reply, cookie, t1, esp_timer_get_time(), PATH_DELAY_US, sample) ==
+                              NtpReplyStatus::BadTiming,
+              "задержка выше предела");
+    }
+
+    g_stop = true;
+    serverThread.join();
+    close(serverSock);
+    close(clientSock);
+
+    printf("ошибок: %u\n", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,53 @@
+// "tz fuzz" на хосте: тот же прогон, что и команда меню, но на миллионе выборок
+// и с несколькими seed; код возврата - итог runTimezoneFuzz().
+// Прогон по чужим зонам не должен менять current_offset активной зоны даже
+// посреди прогона: меню и дисплей читают его, пока fuzz уступает задачу.
+
+#include "config.h"
+#include "freertos/task.h"
+#include "support/tz_env.h"
+#include "timezone_manager.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+namespace {
+int8_t g_offsetBefore = 0;
+bool g_dstBefore = false;
+uint32_t g_leaks = 0;
+
+void checkActiveZonePublished() {
+    if (config.time_config.current_offset != g_offsetBefore ||
+        config.time_config.current_dst_active != g_dstBefore) {
+        g_leaks++;
+    }
+}
+}
+
+int main() {
+    static constexpr uint32_t SAMPLES = 1000000;
+    static constexpr uint32_t SEEDS[] = {0x2545F491, 0x9E3779B9, 0x00C0FFEE};
+    static constexpr time_t START_UTC = 1735689600;  // 2025-01-01
+
+    hostSetCurrentUtc(START_UTC);
+    hostSelectZone("Europe/Warsaw");
+
+    utcToLocal(START_UTC);  // setTimezone() публикует по time(nullptr) - часы хоста
+    g_offsetBefore = config.time_config.current_offset;
+    g_dstBefore = config.time_config.current_dst_active;
+    hostTaskDelayHook = checkActiveZonePublished;
+
+    bool ok = true;
+    for (const uint32_t seed : SEEDS) {
+        ok = runTimezoneFuzz(SAMPLES, seed) && ok;
+    }
+    hostTaskDelayHook = nullptr;
+    checkActiveZonePublished();
+    if (g_leaks != 0) {
+        printf("\nОШИБКА: current_offset/current_dst_active чужой зоны в %lu точках прогона\n",
+               (unsigned long)g_leaks);
+        ok = false;
+    }
+    printf("\n");
+    return ok ? 0 : 1;
+}
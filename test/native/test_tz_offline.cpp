@@ -0,0 +1,77 @@
+// Офлайн-эталон для сверки с ezTime: getOfflineZoneState() отдаёт правила tzdb с
+// минутами и не видит сохранённый POSIX, который важнее tzdb в utcToLocal().
+// Замена POSIX-строки сразу меняет конвертацию: интервал старого правила не
+// переживает новую публикацию.
+
+#include "config.h"
+#include "support/tz_env.h"
+#include "timezone_manager.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+constexpr time_t WINTER_UTC = 1736942400;  // 2025-01-15 12:00
+constexpr time_t SUMMER_UTC = 1752580800;  // 2025-07-15 12:00
+unsigned g_failures = 0;
+
+void check(bool ok, const char* what) {
+    if (!ok) {
+        printf("ОШИБКА: %s\n", what);
+        g_failures++;
+    }
+}
+
+void checkOffline(time_t utc, int32_t expectedMin, bool expectedDst, const char* what) {
+    int32_t offsetMin = 0;
+    bool dst = false;
+    check(getOfflineZoneState(utc, offsetMin, dst) && offsetMin == expectedMin && dst == expectedDst, what);
+}
+
+void checkFormat(int32_t offsetMin, const char* expected) {
+    char buf[16];
+    formatUtcOffset(buf, sizeof(buf), offsetMin);
+    if (strcmp(buf, expected) != 0) {
+        printf("ОШИБКА: formatUtcOffset(%ld) = %s, ожидалось %s\n", static_cast<long>(offsetMin), buf, expected);
+        g_failures++;
+    }
+}
+
+void setPosixOverride(const char* zone, const char* posix) {
+    strlcpy(config.time_config.tz_posix, posix, sizeof(config.time_config.tz_posix));
+    strlcpy(config.time_config.tz_posix_zone, zone, sizeof(config.time_config.tz_posix_zone));
+}
+}
+
+int main() {
+    hostSetCurrentUtc(WINTER_UTC);
+
+    check(hostSelectZone("Asia/Kolkata"), "Asia/Kolkata в базе");
+    checkOffline(WINTER_UTC, 330, false, "Asia/Kolkata: UTC+5:30");
+    check(utcToLocal(WINTER_UTC) - WINTER_UTC == 330 * 60, "Asia/Kolkata: utcToLocal");
+
+    // Сохранённый POSIX расходится с tzdb: конвертация по нему, эталон - tzdb
+    setPosixOverride("Asia/Kolkata", "IST-6");
+    check(utcToLocal(WINTER_UTC) - WINTER_UTC == 6 * 3600, "POSIX важнее tzdb");
+    checkOffline(WINTER_UTC, 330, false, "эталон без POSIX");
+    setPosixOverride("Asia/Kolkata", "IST-5:30");
+    check(utcToLocal(WINTER_UTC) - WINTER_UTC == 330 * 60, "новая POSIX-строка сразу в силе");
+    setPosixOverride("", "");
+
+    check(hostSelectZone("Asia/Kathmandu"), "Asia/Kathmandu в базе");
+    checkOffline(SUMMER_UTC, 345, false, "Asia/Kathmandu: UTC+5:45");
+
+    check(hostSelectZone("Europe/Warsaw"), "Europe/Warsaw в базе");
+    checkOffline(WINTER_UTC, 60, false, "Europe/Warsaw зимой");
+    checkOffline(SUMMER_UTC, 120, true, "Europe/Warsaw летом");
+
+    checkFormat(330, "UTC+5:30");
+    checkFormat(345, "UTC+5:45");
+    checkFormat(-180, "UTC-3");
+    checkFormat(-570, "UTC-9:30");
+    checkFormat(0, "UTC+0");
+
+    printf("ошибок: %u\n", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,20 @@
+// Свойство обратной конвертации (localToUtc после utcToLocal, разрывы и
+// перекрытия) на каждой минуте десятилетия 2025-2034: все пресеты таблицы и
+// все зоны tzdb, тем же verifySourceRoundTrip(), что и "tz verify all".
+
+#include "support/tz_env.h"
+#include "timezone_manager.h"
+
+#include <stdio.h>
+
+int main() {
+    static constexpr int YEARS = 10;
+    static constexpr time_t STEP_SEC = 60;
+
+    hostSetCurrentUtc(1735689600);  // 2025-01-01: от него считается десятилетие
+    hostSelectZone("Europe/Warsaw");
+
+    const bool ok = runTimezoneRoundTripCheck(true, YEARS, STEP_SEC);
+    printf("\n");
+    return ok ? 0 : 1;
+}
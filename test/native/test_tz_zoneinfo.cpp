@@ -0,0 +1,111 @@
+// utcToLocal() каждой зоны tzdb против системной zoneinfo (localtime_r с TZ=":Зона").
+// Шаг - час; если смещение меняется между соседними часами, момент перехода
+// находится делением пополам по zoneinfo и сверяется секунда в секунду.
+
+#include "support/tz_env.h"
+#include "timezone_manager.h"
+#include "tzdb.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace {
+constexpr time_t FROM_UTC = 0;               // 1970-01-01
+constexpr time_t TO_UTC = 4102444800;        // 2100-01-01
+constexpr time_t STEP_SEC = 3600;
+constexpr unsigned PRINT_LIMIT = 5;
+
+long systemOffset(time_t utc) {
+    tm local{};
+    localtime_r(&utc, &local);
+    return local.tm_gmtoff;
+}
+
+long firmwareOffset(time_t utc) {
+    return static_cast<long>(utcToLocal(utc) - utc);
+}
+
+struct ZoneResult {
+    unsigned long checked = 0;
+    unsigned long transitions = 0;
+    unsigned long mismatches = 0;
+};
+
+void compareAt(const char* name, time_t utc, long expected, ZoneResult& result) {
+    result.checked++;
+    const long actual = firmwareOffset(utc);
+    if (actual != expected && ++result.mismatches <= PRINT_LIMIT) {
+        printf("\n  %s: utc=%lld zoneinfo %+ld, прошивка %+ld",
+               name, static_cast<long long>(utc), expected, actual);
+    }
+}
+
+ZoneResult compareZone(const char* name) {
+    ZoneResult result;
+    long prevOffset = systemOffset(FROM_UTC);
+    compareAt(name, FROM_UTC, prevOffset, result);
+
+    for (time_t utc = FROM_UTC + STEP_SEC; utc < TO_UTC; utc += STEP_SEC) {
+        const long offset = systemOffset(utc);
+        if (offset != prevOffset) {
+            // Переход в (utc - STEP_SEC, utc]: первая секунда нового смещения
+            time_t lo = utc - STEP_SEC;
+            time_t hi = utc;
+            while (hi - lo > 1) {
+                const time_t mid = lo + (hi - lo) / 2;
+                (systemOffset(mid) == prevOffset ? lo : hi) = mid;
+            }
+            result.transitions++;
+            compareAt(name, hi - 1, prevOffset, result);
+            compareAt(name, hi, systemOffset(hi), result);
+            prevOffset = offset;
+        }
+        compareAt(name, utc, offset, result);
+    }
+    return result;
+}
+}
+
+int main() {
+    unsigned zones = 0;
+    unsigned skipped = 0;
+    unsigned long checked = 0;
+    unsigned long transitions = 0;
+    unsigned long mismatches = 0;
+
+    printf("tzdb %s против /usr/share/zoneinfo, 1970-2099, шаг %lld с\n",
+           tzdbVersion(), static_cast<long long>(STEP_SEC));
+
+    for (uint16_t i = 0; i < tzdbZoneCount(); i++) {
+        const char* name = tzdbZoneAt(i)->name;
+        char path[128];
+        snprintf(path, sizeof(path), "/usr/share/zoneinfo/%s", name);
+        if (access(path, R_OK) != 0) {
+            skipped++;
+            continue;
+        }
+
+        char tzValue[64];
+        snprintf(tzValue, sizeof(tzValue), ":%s", name);
+        setenv("TZ", tzValue, 1);
+        tzset();
+        if (!hostSelectZone(name)) {
+            printf("\n  %s: setTimezone() отказал", name);
+            mismatches++;
+            continue;
+        }
+
+        const ZoneResult r = compareZone(name);
+        zones++;
+        checked += r.checked;
+        transitions += r.transitions;
+        mismatches += r.mismatches;
+    }
+
+    printf("\nЗон: %u (нет в zoneinfo: %u), проверок: %lu, переходов: %lu, расхождений: %lu\n",
+           zones, skipped, checked, transitions, mismatches);
+    return (zones > 0 && mismatches == 0) ? 0 : 1;
+}
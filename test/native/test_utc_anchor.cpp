@@ -0,0 +1,80 @@
+// Счёт секунд опоры UTC по фронтам SQW (utc_anchor.h), как в timeSourceOnSqwEdge():
+// после записи DS3231 на границе секунды первый спад SQW приходит через 1 с плюс
+// остаток поправки записи и должен сдвигать секунду ровно на 1; от опоры-чтения
+// первый фронт начинает следующую секунду в любой фазе.
+
+#include "utc_anchor.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+namespace {
+constexpr int64_t WRITE_TRIM_MAX_US = 5000;    // UTC_ALIGNED_WRITE_TRIM_MAX_US
+constexpr int64_t DRIFT_MAX_PPB = 200000;      // UTC_DRIFT_MAX_PPB
+constexpr int EDGES = 3600;
+
+unsigned g_failures = 0;
+
+void check(bool ok, const char* what, long long a, long long b) {
+    if (!ok) {
+        if (++g_failures <= 10) {
+            printf("ОШИБКА: %s (%lld, %lld)\n", what, a, b);
+        }
+    }
+}
+
+// Опора как UtcAnchor: секунда, момент и известна ли фаза
+struct Anchor {
+    int64_t utc;
+    int64_t atUs;
+    bool phaseKnown;
+};
+
+int64_t onEdge(Anchor& anchor, int64_t edgeUs) {
+    const int64_t seconds = utcSecondsToSqwEdge(edgeUs - anchor.atUs, anchor.phaseKnown);
+    anchor.utc += seconds;
+    anchor.atUs = edgeUs;
+    anchor.phaseKnown = true;
+    return seconds;
+}
+
+// Запись на границе: спады через 1 с + ошибка фазы, esp_timer уходит на driftPpb
+void checkAfterWrite(int64_t phaseErrorUs, int64_t driftPpb) {
+    Anchor anchor{1735689600, 5000000, true};
+    const int64_t startUtc = anchor.utc;
+    for (int k = 1; k <= EDGES; ++k) {
+        const int64_t edgeUs = 5000000 + phaseErrorUs + k * (1000000 + driftPpb / 1000);
+        const int64_t seconds = onEdge(anchor, edgeUs);
+        check(seconds == 1, k == 1 ? "первый фронт после записи" : "фронт от фронта", phaseErrorUs, seconds);
+    }
+    check(anchor.utc == startUtc + EDGES, "секунды за час после записи", anchor.utc - startUtc, EDGES);
+}
+}
+
+int main() {
+    for (int64_t phaseErrorUs = -WRITE_TRIM_MAX_US; phaseErrorUs <= WRITE_TRIM_MAX_US; phaseErrorUs += 250) {
+        checkAfterWrite(phaseErrorUs, 0);
+        checkAfterWrite(phaseErrorUs, DRIFT_MAX_PPB - 1);
+        checkAfterWrite(phaseErrorUs, -(DRIFT_MAX_PPB - 1));
+    }
+    // Без поправки (первая запись): фаза SQW может уйти на сотни мс, секунда - нет
+    checkAfterWrite(400000, 0);
+    checkAfterWrite(-400000, 0);
+
+    // Пропущенные фронты (задача тика занята): N секунд, а не N +- 1
+    for (int missed = 1; missed <= 60; ++missed) {
+        Anchor anchor{0, 0, true};
+        check(onEdge(anchor, missed * 1000000LL + 3000) == missed, "пропущенные фронты", missed, 0);
+    }
+
+    // Опора от чтения регистра в фазе phase: секунда S началась phase назад, первый
+    // фронт (начало S + 1) - через 1 с - phase
+    for (int64_t phaseUs = 1; phaseUs < 1000000; phaseUs += 997) {
+        Anchor anchor{100, 0, false};
+        const int64_t seconds = onEdge(anchor, 1000000 - phaseUs);
+        check(seconds == 1, "первый фронт после чтения", phaseUs, seconds);
+    }
+
+    printf("ошибок: %u\n", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}